@@ -99,6 +99,19 @@ impl AssetHub {
     /// 4. 立即返回 Handle。
     pub fn load_texture(&mut self, path: PathBuf) -> AssetTextureHandle {
         let _span = tracy_client::span!("load_texture");
+        self.request_texture(path, None)
+    }
+
+    /// 请求解码内存中的纹理 (如模型内嵌的 png / jpg)
+    ///
+    /// 与 load_texture 相同，只是数据不从文件读取；key 相当于文件路径，
+    /// 用于去重和 get_texture_by_path，相同 key 的数据只解码一次
+    pub fn load_texture_from_memory(&mut self, key: PathBuf, data: Vec<u8>) -> AssetTextureHandle {
+        let _span = tracy_client::span!("load_texture_from_memory");
+        self.request_texture(key, Some(data))
+    }
+
+    fn request_texture(&mut self, path: PathBuf, data: Option<Vec<u8>>) -> AssetTextureHandle {
         if let Some(&handle) = self.texture_cache.get(&path) {
             return handle;
         }
@@ -110,7 +123,7 @@ impl AssetHub {
         log::info!("Request load texture: {:?}", path);
 
         // 发送 IO 请求到后台线程
-        self.asset_loader.request_load(AssetLoadRequest { path, handle });
+        self.asset_loader.request_load(AssetLoadRequest { path, handle, data });
 
         handle
     }
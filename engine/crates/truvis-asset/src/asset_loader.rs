@@ -9,6 +9,8 @@ use std::thread;
 pub struct AssetLoadRequest {
     pub path: PathBuf,
     pub handle: AssetTextureHandle,
+    /// 已在内存中的编码数据 (如模型内嵌的 png / jpg)，为 None 时从 path 读取文件
+    pub data: Option<Vec<u8>>,
     // pub params: AssetParams, // Future expansion
 }
 
@@ -142,7 +144,10 @@ fn load_texture_task(req: AssetLoadRequest) -> LoadResult {
     let _span = tracy_client::span!("load_texture_task");
     log::info!("Loading texture: {:?}", req.path);
 
-    let img_result = image::open(&req.path);
+    let img_result = match &req.data {
+        Some(data) => image::load_from_memory(data),
+        None => image::open(&req.path),
+    };
 
     match img_result {
         Ok(img) => {
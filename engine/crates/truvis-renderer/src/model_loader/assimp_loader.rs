@@ -10,6 +10,44 @@ use truvis_scene::components::mesh::Mesh;
 use truvis_scene::guid_new_type::{InstanceHandle, MaterialHandle, MeshHandle};
 use truvis_scene::scene_manager::SceneManager;
 
+thread_local! {
+    /// truvixx 导入阶段对应的 Tracy span，按区间的嵌套顺序压栈
+    /// Tracy 未运行时压入 None，保证出栈与入栈一一对应
+    static TRUVIXX_ZONES: std::cell::RefCell<Vec<Option<tracy_client::Span>>> =
+        const { std::cell::RefCell::new(Vec::new()) };
+}
+
+/// truvixx 的性能分析区间回调：将导入阶段转发为 Tracy span
+///
+/// 同一区间的开始和结束在同一线程中调用，因此用线程局部的栈保存 span
+unsafe extern "C" fn forward_profile_zone(
+    _user_data: *mut std::ffi::c_void,
+    name: *const std::ffi::c_char,
+    begin: u32,
+) {
+    TRUVIXX_ZONES.with_borrow_mut(|zones| {
+        if begin == 0 {
+            zones.pop();
+            return;
+        }
+        let span = tracy_client::Client::running().map(|client| {
+            let name = unsafe { std::ffi::CStr::from_ptr(name) }.to_str().unwrap_or("truvixx");
+            client.span_alloc(Some(name), "", file!(), line!(), 0)
+        });
+        zones.push(span);
+    });
+}
+
+/// 从场景中读取的一个 mesh 的顶点流和索引，直接引用 truvixx 内存 (零拷贝)
+struct MeshSource<'a> {
+    mesh_idx: u32,
+    positions: &'a [glam::Vec3],
+    normals: &'a [glam::Vec3],
+    tangents: &'a [glam::Vec3],
+    uvs: &'a [glam::Vec2],
+    indices: &'a [u32],
+}
+
 /// Assimp 场景加载器
 ///
 /// 封装 Assimp 库，提供场景加载功能。支持多种 3D 模型格式（FBX、GLTF、OBJ 等）。
@@ -27,7 +65,8 @@ pub struct AssimpSceneLoader {
     scene_handle: truvixx::TruvixxSceneHandle,
     model_name: String,
 
-    meshes: Vec<MeshHandle>,
+    /// 与场景 mesh 一一对应；校验后没有剩余三角形的 mesh 不上传，为 None
+    meshes: Vec<Option<MeshHandle>>,
     mats: Vec<MaterialHandle>,
     instances: Vec<InstanceHandle>,
 }
@@ -45,9 +84,11 @@ impl AssimpSceneLoader {
         let model_file = model_file.to_str().unwrap();
         let c_model_file = std::ffi::CString::new(model_file).unwrap();
 
+        // 异步加载：CPU 侧导入剩余 mesh 的同时，已就绪的 mesh 可以先上传并构建 BLAS
+        let load_options = Self::load_options();
         let loader = unsafe {
-            let _span = tracy_client::span!("truvixx_scene_load");
-            truvixx::truvixx_scene_load(c_model_file.as_ptr())
+            let _span = tracy_client::span!("truvixx_scene_load_async");
+            truvixx::truvixx_scene_load_async(c_model_file.as_ptr(), &load_options, None, std::ptr::null_mut())
         };
         let model_name = model_file.split('/').next_back().unwrap();
 
@@ -63,12 +104,15 @@ impl AssimpSceneLoader {
             mesh.build_blas();
             scene_manager.register_mesh(mesh)
         });
-        scene_loader.load_mats(|mat| {
-            if !mat.diffuse_map.is_empty() {
-                asset_hub.load_texture(std::path::PathBuf::from(&mat.diffuse_map));
+        {
+            let _span = tracy_client::span!("truvixx_scene_wait");
+            let status = unsafe { truvixx::truvixx_scene_wait(loader) };
+            if status != truvixx::TruvixxLoadStatus_TruvixxLoadStatusSuccess {
+                log::error!("Failed to load scene: {}", model_file);
             }
-            scene_manager.register_mat(mat)
-        });
+        }
+        Self::log_stats(loader, model_file);
+        scene_loader.load_mats(asset_hub, |mat| scene_manager.register_mat(mat));
         scene_loader.load_instance(|ins| scene_manager.register_instance(ins));
 
         {
@@ -79,13 +123,216 @@ impl AssimpSceneLoader {
         scene_loader.instances
     }
 
-    unsafe fn create_mesh(scene_handle: truvixx::TruvixxSceneHandle, mesh_idx: u32, model_name: &str) -> Mesh {
+    /// 批量加载多个场景文件
+    ///
+    /// 所有文件在 truvixx 的线程池上同时导入；所有文件的材质统一去重，
+    /// 每个唯一材质只注册一次，每个唯一贴图只加载一次
+    ///
+    /// # return
+    /// 与 model_files 一一对应，每个场景的所有 instance id；加载失败的场景为空
+    pub fn load_scenes(
+        model_files: &[&std::path::Path],
+        scene_manager: &mut SceneManager,
+        asset_hub: &mut AssetHub,
+    ) -> Vec<Vec<InstanceHandle>> {
+        let _span = tracy_client::span!("AssimpSceneLoader::load_scenes");
+
+        let model_files = model_files.iter().map(|model_file| model_file.to_str().unwrap()).collect_vec();
+        let c_model_files =
+            model_files.iter().map(|model_file| std::ffi::CString::new(*model_file).unwrap()).collect_vec();
+        let c_paths = c_model_files.iter().map(|model_file| model_file.as_ptr()).collect_vec();
+
+        let load_options = Self::load_options();
+        let scene_set = unsafe {
+            let _span = tracy_client::span!("truvixx_scene_set_load");
+            truvixx::truvixx_scene_set_load(c_paths.as_ptr(), c_paths.len() as u32, &load_options)
+        };
+
+        let shared_mats = Self::load_shared_mats(scene_set, |mat| scene_manager.register_mat(mat), asset_hub);
+
+        let mut all_instances = Vec::with_capacity(model_files.len());
+        for (scene_idx, model_file) in model_files.iter().enumerate() {
+            let scene_handle = unsafe { truvixx::truvixx_scene_set_get(scene_set, scene_idx as u32) };
+            if unsafe { truvixx::truvixx_scene_poll(scene_handle) }
+                != truvixx::TruvixxLoadStatus_TruvixxLoadStatusSuccess
+            {
+                log::error!("Failed to load scene: {}", model_file);
+                all_instances.push(vec![]);
+                continue;
+            }
+            Self::log_stats(scene_handle, model_file);
+
+            let mut scene_loader = AssimpSceneLoader {
+                scene_handle,
+                model_name: model_file.split('/').next_back().unwrap().to_string(),
+                meshes: vec![],
+                mats: vec![],
+                instances: vec![],
+            };
+            scene_loader.load_mesh(|mut mesh| {
+                mesh.build_blas();
+                scene_manager.register_mesh(mesh)
+            });
+
+            // 场景材质 -> 去重后的材质
+            let mat_cnt = unsafe { truvixx::truvixx_scene_material_count(scene_handle) } as usize;
+            let remap = unsafe { truvixx::truvixx_scene_set_get_material_remap(scene_set, scene_idx as u32) };
+            if mat_cnt > 0 {
+                let remap = unsafe { std::slice::from_raw_parts(remap, mat_cnt) };
+                scene_loader.mats = remap.iter().map(|shared_idx| shared_mats[*shared_idx as usize]).collect_vec();
+            }
+
+            scene_loader.load_instance(|ins| scene_manager.register_instance(ins));
+            all_instances.push(scene_loader.instances);
+        }
+
+        {
+            let _span = tracy_client::span!("truvixx_scene_set_free");
+            unsafe { truvixx::truvixx_scene_set_free(scene_set) };
+        }
+
+        all_instances
+    }
+
+    /// 所有场景共用的加载选项
+    ///
+    /// - 紧凑模式：转换完成后立即释放 Assimp 场景，降低峰值内存
+    /// - 纯变换 / 分组节点不产生 instance
+    /// - 转换后修复 mesh 几何 (越界 / 退化三角形、NaN、法线长度)，避免坏数据进入 BLAS 构建
+    /// - 导入阶段以 Tracy span 的形式出现在加载线程 / 线程池线程上
+    fn load_options() -> truvixx::TruvixxSceneLoadOptions {
+        truvixx::TruvixxSceneLoadOptions {
+            release_source: 1,
+            skip_empty_nodes: 1,
+            validate_meshes: 1,
+            profile_zone_callback: Some(forward_profile_zone),
+            ..Default::default()
+        }
+    }
+
+    /// 注册场景集合中去重后的材质，每个唯一的 base color 纹理只加载一次
+    ///
+    /// # return
+    /// 去重后材质下标 -> 材质 id
+    fn load_shared_mats(
+        scene_set: truvixx::TruvixxSceneSetHandle,
+        mat_register: impl FnMut(Material) -> MaterialHandle,
+        asset_hub: &mut AssetHub,
+    ) -> Vec<MaterialHandle> {
+        let _span = tracy_client::span!("load_shared_mats");
+        let mat_cnt = unsafe { truvixx::truvixx_scene_set_material_count(scene_set) };
+        let texture_cnt = unsafe { truvixx::truvixx_scene_set_texture_count(scene_set) };
+
+        let mut records = vec![truvixx::TruvixxMaterialRecord::default(); mat_cnt as usize];
+        let mut textures = vec![truvixx::TruvixxTextureRecord::default(); texture_cnt as usize];
+        let res = unsafe { truvixx::truvixx_scene_set_fill_materials(scene_set, records.as_mut_ptr()) };
+        if res != truvixx::ResType_ResTypeSuccess {
+            panic!("Failed to get shared materials");
+        }
+        let res = unsafe { truvixx::truvixx_scene_set_fill_textures(scene_set, textures.as_mut_ptr()) };
+        if res != truvixx::ResType_ResTypeSuccess {
+            panic!("Failed to get shared textures");
+        }
+
+        let strings = unsafe {
+            let ptr = truvixx::truvixx_scene_set_get_strings(scene_set);
+            let size = truvixx::truvixx_scene_set_strings_size(scene_set);
+            if ptr.is_null() { &[] } else { std::slice::from_raw_parts(ptr as *const u8, size as usize) }
+        };
+
+        Self::register_mats(strings, &records, &textures, asset_hub, mat_register)
+    }
+
+    /// 根据纹理清单请求加载材质用到的纹理，然后注册所有材质
+    ///
+    /// 目前 Material 只使用 base color 纹理，其余槽位只保留路径
+    fn register_mats(
+        strings: &[u8],
+        records: &[truvixx::TruvixxMaterialRecord],
+        textures: &[truvixx::TruvixxTextureRecord],
+        asset_hub: &mut AssetHub,
+        mut mat_register: impl FnMut(Material) -> MaterialHandle,
+    ) -> Vec<MaterialHandle> {
+        let base_color_slot = truvixx::TruvixxTextureSlot_TruvixxTextureSlotBaseColor as usize;
+        let normal_slot = truvixx::TruvixxTextureSlot_TruvixxTextureSlotNormal as usize;
+        let mut texture_keys = vec![None; textures.len()];
+        for texture_idx in records.iter().map(|record| record.textures[base_color_slot]).unique() {
+            if texture_idx != truvixx::TRUVIXX_NO_TEXTURE {
+                texture_keys[texture_idx as usize] =
+                    Self::load_texture(strings, &textures[texture_idx as usize], asset_hub);
+            }
+        }
+
+        // 路径类的槽位：外部纹理为绝对路径，内嵌纹理为 AssetHub 中的键
+        let texture_key = |texture_idx: u32, slot_path: truvixx::TruvixxStringRef| -> String {
+            match texture_keys.get(texture_idx as usize) {
+                Some(Some(key)) => key.clone(),
+                _ => Self::get_str(strings, slot_path).to_string(),
+            }
+        };
+
+        records
+            .iter()
+            .map(|record| {
+                mat_register(Material {
+                    base_color: unsafe { std::mem::transmute::<truvixx::TruvixxFloat4, glam::Vec4>(record.base_color) },
+                    emissive: unsafe { std::mem::transmute::<truvixx::TruvixxFloat4, glam::Vec4>(record.emissive) },
+                    metallic: record.metallic,
+                    roughness: record.roughness,
+                    opaque: record.opacity,
+
+                    diffuse_map: texture_key(record.textures[base_color_slot], record.diffuse_map),
+                    normal_map: texture_key(record.textures[normal_slot], record.normal_map),
+                })
+            })
+            .collect_vec()
+    }
+
+    /// 请求加载纹理清单中的一项，解码在 AssetHub 的后台线程池中进行
+    ///
+    /// # return
+    /// 纹理在 AssetHub 中的键；无法加载的纹理返回 None
+    fn load_texture(
+        strings: &[u8],
+        texture: &truvixx::TruvixxTextureRecord,
+        asset_hub: &mut AssetHub,
+    ) -> Option<String> {
+        if texture.embedded == 0 {
+            let path = Self::get_str(strings, texture.path);
+            asset_hub.load_texture(std::path::PathBuf::from(path));
+            return Some(path.to_string());
+        }
+
+        // 未压缩的内嵌纹理 (BGRA8 texel) 很少见，暂不支持
+        if texture.width != 0 {
+            log::warn!("Unsupported uncompressed embedded texture: {}", Self::get_str(strings, texture.path));
+            return None;
+        }
+
+        // 内嵌纹理没有文件路径，以内容哈希作为键，不同模型中相同的内嵌纹理只解码一次
+        let key = format!("truvixx-embedded/{:016x}.{}", texture.hash, Self::get_str(strings, texture.format_hint));
+        let data = unsafe { std::slice::from_raw_parts(texture.data as *const u8, texture.size as usize) }.to_vec();
+        asset_hub.load_texture_from_memory(std::path::PathBuf::from(&key), data);
+        Some(key)
+    }
+
+    /// 读取一个 mesh 的零拷贝视图
+    ///
+    /// 没有顶点或索引的 mesh 返回 None：例如所有三角形都退化 (面积为 0) 的 mesh，校验时会被全部移除，
+    /// 这样的 mesh 不能上传，也不能构建 BLAS
+    ///
+    /// # Safety
+    /// mesh 已就绪，且返回值使用期间句柄不会被 reload / free
+    unsafe fn read_mesh<'a>(scene_handle: truvixx::TruvixxSceneHandle, mesh_idx: u32) -> Option<MeshSource<'a>> {
         unsafe {
             let mut mesh_info = truvixx::TruvixxMeshInfo::default();
             let res = truvixx::truvixx_mesh_get_info(scene_handle, mesh_idx, &mut mesh_info as *mut _);
             if res != truvixx::ResType_ResTypeSuccess {
                 panic!("Failed to get mesh info for mesh {}", mesh_idx);
             }
+            if mesh_info.vertex_count == 0 || mesh_info.index_count == 0 {
+                return None;
+            }
 
             let position_ptr = truvixx::truvixx_mesh_get_positions(scene_handle, mesh_idx);
             let normal_ptr = truvixx::truvixx_mesh_get_normals(scene_handle, mesh_idx);
@@ -95,124 +342,169 @@ impl AssimpSceneLoader {
                 panic!("Mesh {} is missing vertex attributes", mesh_idx);
             }
 
-            let positions =
-                std::slice::from_raw_parts(position_ptr as *const glam::Vec3, mesh_info.vertex_count as usize);
-            let normals = std::slice::from_raw_parts(normal_ptr as *const glam::Vec3, mesh_info.vertex_count as usize);
-            let tangents =
-                std::slice::from_raw_parts(tangent_ptr as *const glam::Vec3, mesh_info.vertex_count as usize);
-            let uvs = std::slice::from_raw_parts(uv_ptr as *const glam::Vec2, mesh_info.vertex_count as usize);
-
-            let vertex_buffer = VertexLayoutSoA3D::create_vertex_buffer(
-                positions,
-                normals,
-                tangents,
-                uvs,
-                format!("{}-mesh-{}", model_name, mesh_idx),
-            );
-
             let indices_ptr = truvixx::truvixx_mesh_get_indices(scene_handle, mesh_idx);
             if indices_ptr.is_null() {
                 panic!("Mesh {} has no index data", mesh_idx);
             }
 
-            let indices = std::slice::from_raw_parts(indices_ptr, mesh_info.index_count as usize);
-
-            let index_buffer =
-                GfxIndex32Buffer::new_device_local(indices.len(), format!("{}-mesh-{}-indices", model_name, mesh_idx));
-            index_buffer.transfer_data_sync(indices);
-
-            // 只有 single geometry 的 mesh
-            Mesh {
-                geometries: vec![RtGeometry {
-                    vertex_buffer,
-                    index_buffer,
-                }],
-                blas: None,
-                blas_device_address: None,
-                name: format!("{}-{}", model_name, mesh_idx),
-            }
+            let vertex_cnt = mesh_info.vertex_count as usize;
+            Some(MeshSource {
+                mesh_idx,
+                positions: std::slice::from_raw_parts(position_ptr as *const glam::Vec3, vertex_cnt),
+                normals: std::slice::from_raw_parts(normal_ptr as *const glam::Vec3, vertex_cnt),
+                tangents: std::slice::from_raw_parts(tangent_ptr as *const glam::Vec3, vertex_cnt),
+                uvs: std::slice::from_raw_parts(uv_ptr as *const glam::Vec2, vertex_cnt),
+                indices: std::slice::from_raw_parts(indices_ptr, mesh_info.index_count as usize),
+            })
+        }
+    }
+
+    /// 创建 GPU 顶点 / 索引 buffer
+    ///
+    /// 上传经过 Gfx 共享的临时 command pool 和队列，需要在同一线程中串行调用
+    fn create_mesh(source: &MeshSource, model_name: &str) -> Mesh {
+        let mesh_idx = source.mesh_idx;
+        let vertex_buffer = VertexLayoutSoA3D::create_vertex_buffer(
+            source.positions,
+            source.normals,
+            source.tangents,
+            source.uvs,
+            format!("{}-mesh-{}", model_name, mesh_idx),
+        );
+
+        let index_buffer = GfxIndex32Buffer::new_device_local(
+            source.indices.len(),
+            format!("{}-mesh-{}-indices", model_name, mesh_idx),
+        );
+        index_buffer.transfer_data_sync(source.indices);
+
+        // 只有 single geometry 的 mesh
+        Mesh {
+            geometries: vec![RtGeometry {
+                vertex_buffer,
+                index_buffer,
+            }],
+            blas: None,
+            blas_device_address: None,
+            name: format!("{}-{}", model_name, mesh_idx),
         }
     }
 
+    /// 输出导入耗时和统计，用于发现导入器自身的性能回退
+    fn log_stats(scene_handle: truvixx::TruvixxSceneHandle, model_file: &str) {
+        let mut stats = truvixx::TruvixxLoadStats::default();
+        if unsafe { truvixx::truvixx_scene_get_stats(scene_handle, &mut stats) } != truvixx::ResType_ResTypeSuccess {
+            return;
+        }
+
+        let to_ms = |ns: u64| ns as f64 / 1.0e6;
+        let phases = stats
+            .phase_ns
+            .iter()
+            .enumerate()
+            .filter(|(_, ns)| **ns > 0)
+            .map(|(phase, ns)| {
+                let name = unsafe {
+                    std::ffi::CStr::from_ptr(truvixx::truvixx_load_phase_name(phase as truvixx::TruvixxLoadPhase))
+                };
+                format!("{}: {:.2}ms", name.to_string_lossy(), to_ms(*ns))
+            })
+            .join(", ");
+
+        log::info!(
+            "Loaded {} in {:.2}ms (cache: {}): {} meshes, {} materials, {} instances, {} vertices, {} indices, \
+             {} dropped faces, {} repaired meshes ({} triangles removed), scene {:.1} MiB, source {:.1} MiB",
+            model_file,
+            to_ms(stats.total_ns),
+            stats.from_cache != 0,
+            stats.mesh_count,
+            stats.material_count,
+            stats.instance_count,
+            stats.vertex_count,
+            stats.index_count,
+            stats.dropped_face_count,
+            stats.repaired_mesh_count,
+            stats.removed_triangle_count,
+            stats.scene_bytes as f64 / (1024.0 * 1024.0),
+            stats.source_bytes as f64 / (1024.0 * 1024.0),
+        );
+        log::info!("Load phases of {}: {}", model_file, phases);
+    }
+
     /// 加载场景中基础的几何体
+    ///
+    /// 按 mesh 就绪顺序逐个读取、上传并注册，直到异步加载结束且所有 mesh 都已取出；
+    /// 空 mesh (见 read_mesh) 跳过，引用它们的 instance 也不会创建
     fn load_mesh(&mut self, mut mesh_register: impl FnMut(Mesh) -> MeshHandle) {
         let _span = tracy_client::span!("load_mesh");
-        let mesh_cnt = unsafe { truvixx::truvixx_scene_mesh_count(self.scene_handle) };
-
-        let mesh_uuids = (0..mesh_cnt)
-            .map(|mesh_idx| unsafe {
-                let mesh = Self::create_mesh(self.scene_handle, mesh_idx, &self.model_name);
-                mesh_register(mesh)
-            })
-            .collect_vec();
 
-        self.meshes = mesh_uuids;
-    }
+        let scene_handle = self.scene_handle;
+        let pop_ready_mesh = || {
+            let mut mesh_idx = 0_u32;
+            let res = unsafe {
+                truvixx::truvixx_scene_pop_ready_mesh(scene_handle, truvixx::TRUVIXX_WAIT_INFINITE, &mut mesh_idx)
+            };
+            (res == truvixx::ResType_ResTypeSuccess).then_some(mesh_idx)
+        };
 
-    unsafe fn create_mat(scene_handle: truvixx::TruvixxSceneHandle, mat_idx: u32) -> Material {
-        unsafe {
-            let mut mat = truvixx::TruvixxMat::default();
-            let res = truvixx::truvixx_material_get(scene_handle, mat_idx, &mut mat as *mut _);
-            if res != truvixx::ResType_ResTypeSuccess {
-                panic!("Failed to get material {}", mat_idx);
+        // 外层 None 表示 mesh 尚未就绪
+        let mut mesh_uuids: Vec<Option<Option<MeshHandle>>> = Vec::new();
+        while let Some(mesh_idx) = pop_ready_mesh() {
+            if mesh_uuids.is_empty() {
+                let mesh_cnt = unsafe { truvixx::truvixx_scene_pending_mesh_count(scene_handle) };
+                mesh_uuids.resize(mesh_cnt as usize, None);
             }
 
-            Material {
-                base_color: std::mem::transmute::<truvixx::TruvixxFloat4, glam::Vec4>(mat.base_color),
-                emissive: std::mem::transmute::<truvixx::TruvixxFloat4, glam::Vec4>(mat.emissive),
-                metallic: mat.metallic,
-                roughness: mat.roughness,
-                opaque: mat.opacity,
+            let mesh_uuid = match unsafe { Self::read_mesh(scene_handle, mesh_idx) } {
+                Some(source) => Some(mesh_register(Self::create_mesh(&source, &self.model_name))),
+                None => {
+                    log::warn!("Skipping empty mesh {} of {}", mesh_idx, self.model_name);
+                    None
+                }
+            };
+            mesh_uuids[mesh_idx as usize] = Some(mesh_uuid);
+        }
 
-                diffuse_map: std::ffi::CStr::from_ptr(mat.diffuse_map.as_ptr()).to_str().unwrap().to_string(),
-                normal_map: std::ffi::CStr::from_ptr(mat.normal_map.as_ptr()).to_str().unwrap().to_string(),
-            }
+        self.meshes = mesh_uuids
+            .into_iter()
+            .enumerate()
+            .map(|(mesh_idx, mesh_uuid)| mesh_uuid.unwrap_or_else(|| panic!("Mesh {} was never ready", mesh_idx)))
+            .collect_vec();
+    }
+
+    /// 场景字符串 blob，材质 / instance 记录中的字符串都引用其中的区间
+    fn strings(&self) -> &[u8] {
+        unsafe {
+            let ptr = truvixx::truvixx_scene_get_strings(self.scene_handle);
+            let size = truvixx::truvixx_scene_strings_size(self.scene_handle);
+            if ptr.is_null() { &[] } else { std::slice::from_raw_parts(ptr as *const u8, size as usize) }
         }
     }
 
-    /// 加载场景中的所有材质
-    fn load_mats(&mut self, mut mat_register: impl FnMut(Material) -> MaterialHandle) {
+    fn get_str(strings: &[u8], str_ref: truvixx::TruvixxStringRef) -> &str {
+        let begin = str_ref.offset as usize;
+        let end = begin + str_ref.length as usize;
+        std::str::from_utf8(&strings[begin..end]).unwrap()
+    }
+
+    /// 加载场景中的所有材质及其纹理
+    fn load_mats(&mut self, asset_hub: &mut AssetHub, mat_register: impl FnMut(Material) -> MaterialHandle) {
         let _span = tracy_client::span!("load_mats");
         let mat_cnt = unsafe { truvixx::truvixx_scene_material_count(self.scene_handle) };
+        let texture_cnt = unsafe { truvixx::truvixx_scene_texture_count(self.scene_handle) };
 
-        let mat_uuids = (0..mat_cnt)
-            .map(|mat_idx| unsafe {
-                let mat = Self::create_mat(self.scene_handle, mat_idx);
-                mat_register(mat)
-            })
-            .collect_vec();
-
-        self.mats = mat_uuids;
-    }
-
-    unsafe fn create_instance(&self, instance_idx: u32, instance: truvixx::TruvixxInstance) -> Vec<Instance> {
-        let mut mesh_indices = vec![0_u32; instance.mesh_count as usize];
-        let mut mat_indices = vec![0_u32; instance.mesh_count as usize];
-
-        let res = unsafe {
-            truvixx::truvixx_instance_get_refs(
-                self.scene_handle,
-                instance_idx,
-                mesh_indices.as_mut_ptr(),
-                mat_indices.as_mut_ptr(),
-            )
-        };
+        let mut records = vec![truvixx::TruvixxMaterialRecord::default(); mat_cnt as usize];
+        let mut textures = vec![truvixx::TruvixxTextureRecord::default(); texture_cnt as usize];
+        let res = unsafe { truvixx::truvixx_scene_fill_materials(self.scene_handle, records.as_mut_ptr()) };
         if res != truvixx::ResType_ResTypeSuccess {
-            panic!("Failed to get instance {} refs", instance_idx);
+            panic!("Failed to get materials");
+        }
+        let res = unsafe { truvixx::truvixx_scene_fill_textures(self.scene_handle, textures.as_mut_ptr()) };
+        if res != truvixx::ResType_ResTypeSuccess {
+            panic!("Failed to get textures");
         }
 
-        let mesh_uuids = mesh_indices.iter().map(|mesh_idx| self.meshes[*mesh_idx as usize]);
-        let mat_uuids = mat_indices.iter().map(|mat_idx| self.mats[*mat_idx as usize]);
-
-        std::iter::zip(mesh_uuids, mat_uuids)
-            .map(|(mesh_uuid, mat_uuid)| Instance {
-                transform: unsafe {
-                    std::mem::transmute::<truvixx::TruvixxFloat4x4, glam::Mat4>(instance.world_transform)
-                },
-                mesh: mesh_uuid,
-                materials: vec![mat_uuid],
-            })
-            .collect_vec()
+        self.mats = Self::register_mats(self.strings(), &records, &textures, asset_hub, mat_register);
     }
 
     /// 加载场景中的所有 instance
@@ -221,27 +513,101 @@ impl AssimpSceneLoader {
     ///
     /// 因此将 Assimp 中的一个 Instance 拆分为多个 Instance，将其 geometry
     /// 提升为 mesh
-    fn load_instance(&mut self, instance_register: impl FnMut(Instance) -> InstanceHandle) {
+    fn load_instance(&mut self, mut instance_register: impl FnMut(Instance) -> InstanceHandle) {
         let _span = tracy_client::span!("load_instance");
         let instance_cnt = unsafe { truvixx::truvixx_scene_instance_count(self.scene_handle) };
-        let instances = (0..instance_cnt)
-            .filter_map(|instance_idx| {
-                let mut instance = truvixx::TruvixxInstance::default();
-                let res =
-                    unsafe { truvixx::truvixx_instance_get(self.scene_handle, instance_idx, &mut instance as *mut _) };
-                if res != truvixx::ResType_ResTypeSuccess {
-                    panic!("Failed to get instance {}", instance_idx);
-                }
 
-                // 排除空间点，比如 camera, light
-                if instance.mesh_count == 0 { None } else { Some((instance_idx, instance)) }
-            })
-            .flat_map(|(instance_idx, instance_info)| unsafe {
-                self.create_instance(instance_idx, instance_info).into_iter()
+        let mut records = vec![truvixx::TruvixxInstanceRecord::default(); instance_cnt as usize];
+        let res = unsafe { truvixx::truvixx_scene_fill_instances(self.scene_handle, records.as_mut_ptr()) };
+        if res != truvixx::ResType_ResTypeSuccess {
+            panic!("Failed to get instances");
+        }
+
+        let (mesh_refs, mat_refs) = unsafe {
+            let ref_cnt = truvixx::truvixx_scene_instance_ref_count(self.scene_handle) as usize;
+            let mesh_refs = truvixx::truvixx_scene_get_instance_mesh_refs(self.scene_handle);
+            let mat_refs = truvixx::truvixx_scene_get_instance_material_refs(self.scene_handle);
+            if ref_cnt == 0 {
+                (&[][..], &[][..])
+            } else {
+                (std::slice::from_raw_parts(mesh_refs, ref_cnt), std::slice::from_raw_parts(mat_refs, ref_cnt))
+            }
+        };
+
+        let meshes = &self.meshes;
+        let mats = &self.mats;
+        let instances = records
+            .iter()
+            // 排除空间点，比如 camera, light
+            .filter(|instance| instance.mesh_count != 0)
+            .flat_map(|instance| {
+                let refs = instance.ref_offset as usize..(instance.ref_offset + instance.mesh_count) as usize;
+                let transform =
+                    unsafe { std::mem::transmute::<truvixx::TruvixxFloat4x4, glam::Mat4>(instance.world_transform) };
+                std::iter::zip(&mesh_refs[refs.clone()], &mat_refs[refs]).filter_map(move |(mesh_idx, mat_idx)| {
+                    Some(Instance {
+                        transform,
+                        mesh: meshes[*mesh_idx as usize]?,
+                        materials: vec![mats[*mat_idx as usize]],
+                    })
+                })
             })
-            .map(instance_register)
+            .map(&mut instance_register)
             .collect_vec();
 
         self.instances = instances
     }
 }
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    /// 第一个对象是正常的三角形，第二个对象只有一个三点共线的三角形
+    const DEGENERATE_OBJ: &str = "\
+o valid
+v 0 0 0
+v 1 0 0
+v 0 1 0
+f 1 2 3
+o degenerate
+v 0 0 0
+v 1 1 1
+v 2 2 2
+f 4 5 6
+";
+
+    #[test]
+    fn test_all_degenerate_mesh_is_skipped() {
+        let path = std::env::temp_dir().join(format!("truvis-degenerate-{}.obj", std::process::id()));
+        std::fs::write(&path, DEGENERATE_OBJ).unwrap();
+        let c_path = std::ffi::CString::new(path.to_str().unwrap()).unwrap();
+
+        let options = AssimpSceneLoader::load_options();
+        let scene_handle = unsafe { truvixx::truvixx_scene_load_ex(c_path.as_ptr(), &options) };
+        assert_eq!(
+            unsafe { truvixx::truvixx_scene_poll(scene_handle) },
+            truvixx::TruvixxLoadStatus_TruvixxLoadStatusSuccess
+        );
+
+        let mesh_cnt = unsafe { truvixx::truvixx_scene_mesh_count(scene_handle) };
+        assert_eq!(mesh_cnt, 2);
+
+        let mut empty_meshes = 0;
+        for mesh_idx in 0..mesh_cnt {
+            let Some(source) = (unsafe { AssimpSceneLoader::read_mesh(scene_handle, mesh_idx) }) else {
+                let mut validation = truvixx::TruvixxMeshValidation::default();
+                unsafe { truvixx::truvixx_mesh_get_validation(scene_handle, mesh_idx, &mut validation) };
+                assert_eq!(validation.degenerate_triangles, 1);
+                empty_meshes += 1;
+                continue;
+            };
+            assert_eq!(source.positions.len(), 3);
+            assert_eq!(source.indices.len(), 3);
+        }
+        assert_eq!(empty_meshes, 1);
+
+        unsafe { truvixx::truvixx_scene_free(scene_handle) };
+        let _ = std::fs::remove_file(&path);
+    }
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "TruvixxAssimp/scene_data.hpp"
+
+#include <array>
+#include <cstdint>
+#include <span>
+
+namespace truvixx
+{
+
+/// 单个顶点的骨骼影响累加器，只保留权重最大的 4 个
+struct SkinAccumulator
+{
+public:
+    /// 加入一个骨骼影响，权重不大于 0 的忽略
+    void add(uint32_t joint, float weight) noexcept;
+
+    /// 归一化并打包为 unorm8 (和为 255，舍入误差计入最大的权重)；没有骨骼影响时全部为 0
+    [[nodiscard]] TruvixxSkinVertex pack() const noexcept;
+
+private:
+    std::array<uint32_t, 4> joints_{};
+    std::array<float, 4> weights_{}; ///< 从大到小排列
+};
+
+/// 一组关键帧的取值范围 (量化用)
+[[nodiscard]] TruvixxTransformRange compute_transform_range(std::span<const TruvixxNodeTransform> keys) noexcept;
+
+[[nodiscard]] TruvixxQuantizedTransform
+quantize_transform(const TruvixxNodeTransform& transform, const TruvixxTransformRange& range) noexcept;
+
+/// 反量化，旋转重新归一化
+[[nodiscard]] TruvixxNodeTransform
+dequantize_transform(const TruvixxQuantizedTransform& transform, const TruvixxTransformRange& range) noexcept;
+
+/// TRS -> 列主序矩阵 (T * R * S)
+[[nodiscard]] TruvixxFloat4x4 compose_transform(const TruvixxNodeTransform& transform) noexcept;
+
+/// 采样片段在 time 时刻所有节点的局部变换
+///
+/// 读取相邻两帧做线性插值 (旋转为 nlerp，导入时已保证相邻帧的四元数在同一半球)，不分配内存。
+/// 没有动画通道的节点取 rest 姿态
+/// @param time 秒；loop 为 true 时对 duration 取模，否则限制在 [0, duration]
+/// @param out_pose 长度至少为 scene.node_count()
+void sample_animation(
+    const SceneData& scene,
+    const AnimationClip& clip,
+    float time,
+    bool loop,
+    std::span<TruvixxNodeTransform> out_pose
+) noexcept;
+
+/// 由局部变换计算所有节点的全局矩阵 (列主序)，按节点顺序一次遍历 (父节点总在子节点之前)
+/// @param pose 长度至少为 scene.node_count()，可以是 sample_animation() 的结果
+/// @param out_matrices 长度至少为 scene.node_count()
+void compute_node_matrices(
+    const SceneData& scene,
+    std::span<const TruvixxNodeTransform> pose,
+    std::span<TruvixxFloat4x4> out_matrices
+) noexcept;
+
+/// 蒙皮矩阵：节点全局矩阵 * 逆绑定矩阵，与 MeshInfo::joint_nodes 一一对应
+///
+/// 结果把绑定姿态的顶点变换到场景空间，与 glTF 一致，不需要再乘 mesh 所在实例的 world_transform。
+/// 找不到节点的关节输出单位矩阵
+/// @param node_matrices compute_node_matrices() 的结果
+/// @param out_matrices 长度至少为 mesh.joint_nodes.size()
+void compute_skin_matrices(
+    const MeshInfo& mesh,
+    std::span<const TruvixxFloat4x4> node_matrices,
+    std::span<TruvixxFloat4x4> out_matrices
+) noexcept;
+
+/// 采样片段在 time 时刻某个 mesh 的变形权重，片段中没有该 mesh 的通道时输出 MorphTarget::default_weight
+/// @param out_weights 长度至少为 mesh 的变形目标数量
+void sample_morph_weights(
+    const SceneData& scene,
+    const AnimationClip& clip,
+    float time,
+    bool loop,
+    uint32_t mesh_idx,
+    std::span<float> out_weights
+) noexcept;
+
+} // namespace truvixx
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "TruvixxAssimp/scene_data.hpp"
+
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+#include <assimp/scene.h>
+
+namespace truvixx
+{
+
+/// 单个蒙皮 mesh 的最大关节数，TruvixxSkinVertex::joints 为 8 位下标
+inline constexpr uint32_t MAX_SKIN_JOINTS = 256;
+
+/// aiNode 与 SceneData::skeleton_nodes 下标的对应关系，只在导入期间有效 (名称引用 aiScene 中的字符串)
+struct NodeLookup
+{
+    std::vector<const aiNode*> nodes;                               ///< 与 skeleton_nodes 一一对应
+    std::unordered_map<std::string_view, uint32_t> index_of_name; ///< 同名节点取层序中的第一个
+
+    /// @return 找不到时返回 NO_NODE
+    [[nodiscard]] uint32_t find(std::string_view name) const noexcept;
+};
+
+/// 按层序将节点树写入 scene.skeleton_nodes，顺序与 SceneImporter 遍历实例的顺序一致
+[[nodiscard]] NodeLookup import_skeleton(const aiNode* root, SceneData& scene);
+
+/// 骨骼 -> 关节表、逆绑定矩阵和每个顶点的蒙皮数据，没有骨骼的 mesh 保持不变
+/// 超过 MAX_SKIN_JOINTS 的骨骼被丢弃 (正常情况下 aiProcess_SplitByBoneCount 已拆分)
+void import_skin(const aiMesh* mesh, const NodeLookup& lookup, MeshInfo& out_mesh);
+
+/// 变形目标 -> 稀疏的顶点偏移，out_mesh 的顶点流需已填写
+///
+/// aiAnimMesh 中是变形后的绝对位置 / 法线，与 mesh 的差值即偏移，只保留偏移非零的顶点
+void import_morph_targets(const aiMesh* mesh, MeshInfo& out_mesh);
+
+/// 动画重采样参数
+struct AnimationImportSettings
+{
+    float sample_rate = 30.f; ///< 目标帧率
+    bool quantize = false;    ///< 关键帧量化存储
+};
+
+/// 动画片段以固定帧率重采样，写入 scene.animations 及其关键帧数组
+///
+/// 关键帧之间按线性插值 (旋转为 slerp)，片段时间范围之外取首尾关键帧；
+/// 每个通道相邻帧的四元数调整到同一半球，运行时可以直接 nlerp
+/// @param output_of_source aiMesh -> 输出 mesh，被合并的为 UINT32_MAX；用于定位变形通道对应的 mesh
+/// @param scene mesh_infos 的变形目标需已填写
+void import_animations(
+    const aiScene* ai_scene,
+    const NodeLookup& lookup,
+    std::span<const uint32_t> output_of_source,
+    const AnimationImportSettings& settings,
+    SceneData& scene
+);
+
+} // namespace truvixx
@@ -71,6 +71,114 @@ typedef union
     float v[2];
 } TruvixxFloat2;
 
+/// meshlet 描述 (与 meshopt_Meshlet 布局一致)
+typedef struct
+{
+    unsigned int vertex_offset;   ///< meshlet 顶点表中的起始下标
+    unsigned int triangle_offset; ///< meshlet 三角形表中的起始字节 (4 字节对齐)
+    unsigned int vertex_count;
+    unsigned int triangle_count;
+} TruvixxMeshlet;
+
+/// 轴对齐包围盒，min 任一分量大于 max 时表示空
+typedef struct
+{
+    TruvixxFloat3 min;
+    TruvixxFloat3 max;
+} TruvixxAabb;
+
+/// 实例化批次：引用同一 (mesh, 材质) 的所有实例
+/// 变换保存在场景的批次变换数组中，[transform_offset, transform_offset + instance_count)
+typedef struct
+{
+    unsigned int mesh_index;
+    unsigned int material_index;
+    unsigned int transform_offset; ///< 批次变换数组中的起始下标
+    unsigned int instance_count;
+} TruvixxInstanceBatch;
+
+/// 蒙皮顶点：最多 4 个骨骼影响
+/// joints 为 mesh 关节表中的下标；weights 为 unorm8，和为 255，没有骨骼影响的顶点全部为 0
+typedef struct
+{
+    unsigned char joints[4];
+    unsigned char weights[4]; ///< 按权重从大到小排列
+} TruvixxSkinVertex;
+
+/// 变形目标中单个顶点的偏移 (稀疏存储，只包含有偏移的顶点)
+typedef struct
+{
+    unsigned int vertex; ///< mesh 顶点下标
+    TruvixxFloat3 position;
+    TruvixxFloat3 normal; ///< mesh 没有法线时为 0
+} TruvixxMorphDelta;
+
+/// 节点的局部变换 (TRS)，矩阵 = T * R * S
+typedef struct
+{
+    TruvixxFloat3 translation;
+    TruvixxFloat4 rotation; ///< 单位四元数 (x, y, z, w)
+    TruvixxFloat3 scale;
+} TruvixxNodeTransform;
+
+/// 量化的节点局部变换 (动画关键帧)
+/// translation / scale 为相对通道范围 (TruvixxTransformRange) 的 unorm16，rotation 为 snorm16 四元数
+typedef struct
+{
+    unsigned short translation[3];
+    short rotation[4];
+    unsigned short scale[3];
+} TruvixxQuantizedTransform;
+
+/// 量化动画通道的取值范围，反量化: value = min + q / 65535 * extent
+typedef struct
+{
+    TruvixxFloat3 translation_min;
+    TruvixxFloat3 translation_extent;
+    TruvixxFloat3 scale_min;
+    TruvixxFloat3 scale_extent;
+} TruvixxTransformRange;
+
+/// GPU 实例记录，与 shader share/scene.slangi 中的 Instance 布局一致 (std430, 144 字节)
+/// 实例的第 i 个 submesh: geometry = instance_geometry_map[geometry_indirect_idx + i]，材质同理
+typedef struct
+{
+    unsigned int geometry_indirect_idx;
+    unsigned int geometry_count;
+    unsigned int material_indirect_idx;
+    unsigned int material_count;
+    TruvixxFloat4x4 model;     ///< 列主序
+    TruvixxFloat4x4 inv_model; ///< 列主序
+} TruvixxGpuInstance;
+
+/// GPU 材质记录，与 shader share/material.slangi 中的 PBRMaterial 布局一致 (std430, 64 字节)
+typedef struct
+{
+    TruvixxFloat3 base_color;
+    float metallic;
+    TruvixxFloat3 emissive;
+    float roughness;
+    int diffuse_map;                       ///< bindless SRV handle，没有纹理时为 -1 (INVALID_TEX_ID)
+    unsigned int diffuse_map_sampler_type; ///< ESamplerType
+    int normal_map;
+    unsigned int normal_map_sampler_type;
+    float opaque;
+    float _padding_1;
+    float _padding_2;
+    float _padding_3;
+} TruvixxGpuMaterial;
+
+/// GPU geometry 记录，与 shader share/geometry.slangi 中的 Geometry 布局一致 (std430, 40 字节)
+/// 每个字段为 buffer device address，索引为 32 位
+typedef struct
+{
+    unsigned long long position_buffer;
+    unsigned long long normal_buffer;
+    unsigned long long tangent_buffer;
+    unsigned long long uv_buffer;
+    unsigned long long index_buffer;
+} TruvixxGpuGeometry;
+
 #ifdef __cplusplus
 }
 #endif
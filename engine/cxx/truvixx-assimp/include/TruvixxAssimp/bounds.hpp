@@ -0,0 +1,24 @@
+#pragma once
+
+#include "TruvixxAssimp/base_type.h"
+
+#include <cstdint>
+
+namespace truvixx
+{
+
+/// 空包围盒 (min = +inf, max = -inf)，与任何包围盒合并都得到对方
+[[nodiscard]] TruvixxAabb empty_aabb() noexcept;
+
+[[nodiscard]] bool is_empty(const TruvixxAabb& aabb) noexcept;
+
+/// 顶点的包围盒，SSE2 可用时按 4 个顶点一组做 min/max 归约
+[[nodiscard]] TruvixxAabb compute_aabb(const TruvixxFloat3* positions, uint32_t count) noexcept;
+
+/// 变换后的包围盒 (按矩阵每个分量的正负取 min/max，结果仍包含所有变换后的顶点)
+[[nodiscard]] TruvixxAabb transform_aabb(const TruvixxAabb& aabb, const TruvixxFloat4x4& transform) noexcept;
+
+/// 合并两个包围盒
+[[nodiscard]] TruvixxAabb merge_aabb(const TruvixxAabb& a, const TruvixxAabb& b) noexcept;
+
+} // namespace truvixx
@@ -0,0 +1,155 @@
+#pragma once
+
+#include "TruvixxAssimp/scene_data.hpp"
+#include "TruvixxAssimp/string_table.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <vector>
+
+namespace truvixx
+{
+
+// 场景缓存 (scene_cache) 和分块场景文件 (tiled_scene) 共用的二进制布局与读写工具
+//
+// 文件中所有 offset 都是相对文件起始的字节偏移，每段数据 16 字节对齐，读取时全部做边界检查
+
+inline constexpr uint64_t CACHE_ALIGNMENT = 16;
+
+struct CachedString
+{
+    uint64_t offset; ///< 相对字符串 blob 起始，与 StringRef::offset 一致
+    uint64_t length;
+};
+
+struct CachedMaterial
+{
+    TruvixxFloat4 base_color;
+    TruvixxFloat4 emissive;
+    float roughness;
+    float metallic;
+    float opacity;
+    float _pad0;
+
+    CachedString name;
+    CachedString diffuse_map;
+    CachedString normal_map;
+
+    uint32_t textures[TEXTURE_SLOT_COUNT]; ///< 即 MaterialData::textures
+    uint32_t _pad1[3];
+};
+
+struct CachedTexture
+{
+    CachedString path;
+    CachedString format_hint;
+    uint64_t data_offset; ///< 内嵌纹理数据，外部纹理为 0
+    uint64_t size;
+    uint64_t hash; ///< 外部纹理的哈希读取后会重新计算
+    uint32_t width;
+    uint32_t height;
+    uint32_t embedded;
+    uint32_t _pad0;
+};
+
+struct CachedInstance
+{
+    TruvixxFloat4x4 world_transform;
+    CachedString name;
+    uint64_t refs_index; ///< 即 InstanceData::ref_offset
+    uint32_t mesh_count;
+    uint32_t node;
+    TruvixxAabb world_bounds;
+};
+
+/// 顺序写入 + 回写 header 的辅助类
+struct CacheWriter
+{
+    std::ofstream out;
+    uint64_t offset = 0;
+
+    void write(const void* data, const size_t size)
+    {
+        out.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+        offset += size;
+    }
+
+    void align()
+    {
+        constexpr char zeros[CACHE_ALIGNMENT] = {};
+        const uint64_t padding = (CACHE_ALIGNMENT - offset % CACHE_ALIGNMENT) % CACHE_ALIGNMENT;
+        write(zeros, padding);
+    }
+
+    /// 对齐后写入一段数据，返回其偏移
+    template <typename T>
+    uint64_t write_section(const T* data, const size_t count)
+    {
+        align();
+        const uint64_t section_offset = offset;
+        write(data, count * sizeof(T));
+        return section_offset;
+    }
+};
+
+/// 带边界检查的缓存读取视图
+struct CacheView
+{
+    const std::byte* base;
+    uint64_t size;
+
+    [[nodiscard]] bool contains(const uint64_t offset, const uint64_t bytes) const noexcept
+    {
+        return offset <= size && bytes <= size - offset;
+    }
+
+    template <typename T>
+    [[nodiscard]] const T* get(const uint64_t offset, const uint64_t count) const noexcept
+    {
+        if (offset % alignof(T) != 0 || count > size / sizeof(T) || !contains(offset, count * sizeof(T)))
+            return nullptr;
+        return reinterpret_cast<const T*>(base + offset);
+    }
+};
+
+/// 将缓存中的一段数组拷贝到 vector
+template <typename T>
+[[nodiscard]] bool read_array(const CacheView& view, const uint64_t offset, const uint64_t count, std::vector<T>& out)
+{
+    const auto* data = view.get<T>(offset, count);
+    if (!data)
+        return false;
+    out.assign(data, data + count);
+    return true;
+}
+
+[[nodiscard]] CachedString to_cached(StringRef ref);
+
+/// 校验并转换为 StringRef
+[[nodiscard]] bool from_cached(const StringTable& strings, const CachedString& str, StringRef& out);
+
+[[nodiscard]] CachedMaterial to_cached(const MaterialData& mat);
+
+/// 校验字符串和纹理下标
+[[nodiscard]] bool from_cached(const StringTable& strings, const CachedMaterial& cached, uint32_t texture_count, MaterialData& out);
+
+/// @param data_offset 内嵌纹理数据在文件中的偏移，外部纹理为 0
+[[nodiscard]] CachedTexture to_cached(const TextureData& texture, uint64_t data_offset);
+
+/// 内嵌纹理的 data 指向 view 的内存
+[[nodiscard]] bool from_cached(const CacheView& view, const StringTable& strings, const CachedTexture& cached, TextureData& out);
+
+[[nodiscard]] CachedInstance to_cached(const InstanceData& inst);
+
+/// @param refs_size mesh 引用数组的长度
+/// @param node_count 节点数，instance 的节点下标需在范围内
+[[nodiscard]] bool from_cached(
+    const StringTable& strings,
+    const CachedInstance& cached,
+    uint64_t refs_size,
+    uint32_t node_count,
+    InstanceData& out
+);
+
+} // namespace truvixx
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "TruvixxAssimp/base_type.h"
+#include "TruvixxAssimp/scene_data.hpp"
+
+#include <cstdint>
+#include <span>
+
+namespace truvixx
+{
+
+// GPU 场景表：与 shader 侧 GPUScene 引用的 Instance / PBRMaterial / Geometry 以及两个间接索引表布局一致，
+// 所有表写入同一块内存，上传时只需一次拷贝，GPUScene 中的指针为 buffer 地址 + 对应段的偏移
+
+static_assert(sizeof(TruvixxGpuInstance) == 144);
+static_assert(sizeof(TruvixxGpuMaterial) == 64);
+static_assert(sizeof(TruvixxGpuGeometry) == 40);
+
+/// 与 shader 侧 INVALID_TEX_ID 一致
+inline constexpr int32_t INVALID_SRV_HANDLE = -1;
+
+/// 与 shader 侧 ESamplerType::LinearRepeat 一致
+inline constexpr uint32_t DEFAULT_GPU_SAMPLER_TYPE = 2;
+
+/// 各段之间的对齐
+inline constexpr uint64_t GPU_TABLE_ALIGNMENT = 16;
+
+/// 写入 GPU 场景表时的下标偏移，用于把多个场景放进同一组 GPU buffer
+struct GpuTableParams
+{
+    uint32_t material_base = 0; ///< 场景第 0 个材质在 all_mats 中的下标
+    uint32_t geometry_base = 0; ///< 场景第 0 个 mesh 在 all_geometries 中的下标
+    uint32_t indirect_base = 0; ///< 场景第 0 个引用在两个间接索引表中的下标
+
+    uint32_t sampler_type = DEFAULT_GPU_SAMPLER_TYPE; ///< 所有纹理使用的 ESamplerType
+
+    /// SceneData::textures 下标 -> bindless SRV handle；越界或为空时视为没有纹理
+    std::span<const int32_t> texture_handles;
+};
+
+/// GPU 场景表在目标内存中的布局 (字节偏移，相对目标内存起始)
+///
+/// 依次为 instance | material | geometry | geometry 间接索引 | 材质间接索引，每段按 GPU_TABLE_ALIGNMENT 对齐
+struct GpuTableLayout
+{
+    uint64_t instance_offset = 0;
+    uint64_t material_offset = 0;
+    uint64_t geometry_offset = 0;
+    uint64_t geometry_map_offset = 0;
+    uint64_t material_map_offset = 0;
+    uint64_t total_size = 0;
+
+    uint32_t instance_count = 0;
+    uint32_t material_count = 0;
+    uint32_t geometry_count = 0; ///< 即 mesh 数量，每个 mesh 是一个 geometry
+    uint32_t ref_count = 0;      ///< 每个间接索引表的长度
+};
+
+[[nodiscard]] GpuTableLayout compute_gpu_table_layout(const SceneData& scene) noexcept;
+
+/// 一般 4x4 矩阵的逆 (余子式展开)，不可逆时返回单位矩阵
+[[nodiscard]] TruvixxFloat4x4 inverse_matrix(const TruvixxFloat4x4& m) noexcept;
+
+/// 写入所有实例记录，实例数量较多时并行计算逆矩阵
+/// 两个间接索引都为 indirect_base + InstanceData::ref_offset
+/// @param out 大小 >= instance_count
+void write_gpu_instances(const SceneData& scene, const GpuTableParams& params, TruvixxGpuInstance* out);
+
+/// 写入所有材质记录，diffuse_map / normal_map 取 BaseColor / Normal 槽位的纹理
+/// @param out 大小 >= material_count
+void write_gpu_materials(const SceneData& scene, const GpuTableParams& params, TruvixxGpuMaterial* out);
+
+/// 写入两个间接索引表：instance_mesh_refs + geometry_base，instance_material_refs + material_base
+/// @param geometry_map / material_map 大小 >= instance_mesh_refs.size()
+void write_gpu_indirect_maps(
+    const SceneData& scene,
+    const GpuTableParams& params,
+    uint32_t* geometry_map,
+    uint32_t* material_map
+) noexcept;
+
+} // namespace truvixx
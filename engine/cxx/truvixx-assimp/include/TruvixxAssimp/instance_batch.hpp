@@ -0,0 +1,14 @@
+#pragma once
+
+#include "TruvixxAssimp/scene_data.hpp"
+
+namespace truvixx
+{
+
+/// 将所有实例对 mesh 的引用按 (mesh, 材质) 分组为实例化批次
+///
+/// 结果写入 scene.instance_batches / scene.batch_transforms，每个 (实例, mesh) 引用恰好属于一个批次
+/// 批次按 (mesh, 材质) 首次出现的顺序排列，批次内的变换保持实例顺序，因此结果是确定的
+void build_instance_batches(SceneData& scene);
+
+} // namespace truvixx
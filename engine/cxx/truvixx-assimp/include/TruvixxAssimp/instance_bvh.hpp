@@ -0,0 +1,78 @@
+#pragma once
+
+#include "TruvixxAssimp/base_type.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace truvixx
+{
+
+struct SceneData;
+
+/// 叶节点最多包含的实例数
+inline constexpr uint32_t BVH_MAX_LEAF_SIZE = 4;
+
+/// SAH 分桶数
+inline constexpr uint32_t BVH_BIN_COUNT = 16;
+
+/// BVH 节点，按深度优先顺序线性存放：左子节点紧跟在父节点之后
+struct BvhNode
+{
+    TruvixxAabb bounds;
+    uint32_t first = 0; ///< 叶节点：instance_indices 中的起始下标；内部节点：右子节点下标
+    uint32_t count = 0; ///< 叶节点的实例数，0 表示内部节点
+
+    [[nodiscard]]
+    bool is_leaf() const noexcept
+    {
+        return count > 0;
+    }
+};
+
+/// 实例世界包围盒上的 BVH (SceneLoadOptions::build_instance_bvh)
+///
+/// 构建完成后只读，所有查询都可以在多个线程中同时调用
+struct InstanceBvh
+{
+    std::vector<BvhNode> nodes;             ///< nodes[0] 为根节点，为空表示没有可索引的实例
+    std::vector<uint32_t> instance_indices; ///< 叶节点引用的实例下标
+    std::vector<TruvixxAabb> leaf_bounds;   ///< 与 instance_indices 一一对应的实例包围盒，叶节点内逐个测试时不必回访实例
+
+    [[nodiscard]]
+    bool empty() const noexcept
+    {
+        return nodes.empty();
+    }
+};
+
+/// 射线，参数范围 [t_min, t_max]
+struct BvhRay
+{
+    TruvixxFloat3 origin;
+    TruvixxFloat3 direction; ///< 不要求归一化
+    float t_min = 0.f;
+    float t_max = 0.f;
+};
+
+/// 射线命中的实例
+struct BvhRayHit
+{
+    uint32_t instance_index = 0;
+    float t = 0.f; ///< 射线进入实例包围盒的参数
+};
+
+/// 以 binned SAH 在实例 world_bounds 上构建 BVH，包围盒为空的实例不参与
+void build_instance_bvh(SceneData& scene);
+
+/// 与包围盒相交的实例，结果追加到 out
+void query_aabb(const InstanceBvh& bvh, const TruvixxAabb& box, std::vector<uint32_t>& out);
+
+/// 与视锥相交 (或在其内部) 的实例，结果追加到 out
+/// @param planes 6 个平面 (xyz = 指向视锥内部的法线, w = d)，点 p 在内侧当且仅当 dot(n, p) + d >= 0
+void query_frustum(const InstanceBvh& bvh, const TruvixxFloat4 planes[6], std::vector<uint32_t>& out);
+
+/// 包围盒与射线相交的实例，结果追加到 out，按 t 从近到远排序
+void query_ray(const InstanceBvh& bvh, const BvhRay& ray, std::vector<BvhRayHit>& out);
+
+} // namespace truvixx
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string_view>
+#include <vector>
+
+namespace truvixx
+{
+
+struct TextureData;
+
+/// 可选的 Assimp 后处理步骤 (位掩码)
+///
+/// 三角化、顶点去重、按图元类型拆分、UV 翻转总是执行，不在此列
+enum PostProcessStep : uint32_t
+{
+    PostProcessGenNormals = 1u << 0,                ///< aiProcess_GenNormals, 仅为缺少法线的 mesh 生成
+    PostProcessCalcTangents = 1u << 1,              ///< aiProcess_CalcTangentSpace
+    PostProcessImproveCacheLocality = 1u << 2,      ///< aiProcess_ImproveCacheLocality
+    PostProcessOptimizeMeshes = 1u << 3,            ///< aiProcess_OptimizeMeshes, 合并 mesh 以减少 draw call
+    PostProcessRemoveRedundantMaterials = 1u << 4, ///< aiProcess_RemoveRedundantMaterials
+
+    PostProcessDefault = PostProcessGenNormals | PostProcessCalcTangents,
+};
+
+/// 保留的顶点属性 (位掩码)，position 和索引总是保留
+enum VertexAttribute : uint32_t
+{
+    VertexAttributeNormal = 1u << 0,
+    VertexAttributeTangent = 1u << 1, ///< 生成切线需要法线，保留 tangent 时 normal 也会保留
+    VertexAttributeUv = 1u << 2,
+
+    VertexAttributeAll = VertexAttributeNormal | VertexAttributeTangent | VertexAttributeUv,
+};
+
+/// 单个 LOD 层级的简化参数
+struct LodLevelSettings
+{
+    /// 目标索引数量相对 LOD0 的比例，(0, 1]
+    float target_ratio = 0.5f;
+
+    /// 允许的最大误差，相对 mesh 尺寸，例如 0.01 表示 1%
+    float target_error = 0.01f;
+};
+
+/// 性能分析区间回调，每个导入阶段 (见 LoadPhase) 开始时以 begin = true、结束时以 begin = false 调用
+///
+/// 同一区间的开始和结束在同一线程中，区间在线程内严格嵌套；name 是静态字符串
+using ProfileZoneHook = std::function<void(const char* name, bool begin)>;
+
+/// 纹理清单中的一项确定后调用 (哈希已计算，内嵌纹理的 data 在场景释放前有效)
+///
+/// 用于在 mesh 转换的同时开始读取 / 解码 / 转码纹理；path 和 format_hint 只在回调期间有效
+using TextureReadyHook =
+    std::function<void(uint32_t texture_idx, const TextureData& texture, std::string_view path, std::string_view format_hint)>;
+
+/// 场景加载选项
+///
+/// 默认值与 SceneImporter::load(path) 的行为一致
+struct SceneLoadOptions
+{
+    /// 使用线程池并行转换 mesh 和材质，输出与串行完全一致
+    bool parallel = false;
+
+    /// 执行的后处理步骤，PostProcessStep 位掩码
+    uint32_t post_process = PostProcessDefault;
+
+    /// 保留的顶点属性，VertexAttribute 位掩码
+    /// 未保留的属性在 Assimp 后处理之前就被移除，不会参与顶点去重和切线计算
+    uint32_t attributes = VertexAttributeAll;
+
+    /// 转换后立即对每个 mesh 做几何校验与修复 (移除越界 / 退化三角形、清理 NaN、法线归一化)，见 validate_mesh()
+    /// 在其余 mesh 处理步骤之前执行，结果见 MeshInfo::validation
+    bool validate_meshes = false;
+
+    /// 对每个 mesh 做顶点缓存 / overdraw / 顶点拉取重排，见 optimize_mesh()
+    bool optimize_meshes = false;
+
+    /// 将 mesh 划分为 meshlet 并计算包围球 / 法线锥，见 build_meshlets()
+    bool build_meshlets = false;
+
+    /// 额外生成的 LOD 层级 (LOD 1..N)，见 build_lods()；为空表示不生成
+    std::vector<LodLevelSettings> lod_levels;
+
+    /// 紧凑模式：顶点流拷贝到 SceneData::vertex_arena 的一块连续内存中，
+    /// 转换完成后立即释放 aiScene，峰值内存只包含实际导出的数据
+    bool release_source = false;
+
+    /// 顶点数不超过 65536 的 mesh 以 16 位索引存储，见 compact_indices()
+    bool compact_indices = false;
+
+    /// 只输出引用了 mesh 的实例，跳过纯变换 / 分组节点
+    /// 实例的 world_transform 本身已是展开后的世界变换，跳过中间节点不影响结果
+    bool skip_empty_nodes = false;
+
+    /// 只被引用一次的 mesh 变换到世界空间，并按 (材质, 顶点属性) 合并为一个 mesh，见 merge_meshes()
+    /// 被多次引用的 mesh 保持实例化；合并后的 mesh 排在其余 mesh 之后，由一个单位变换的实例引用
+    bool merge_static_meshes = false;
+
+    /// 导入蒙皮、变形目标和动画片段，见 SceneData::skeleton_nodes / animations
+    /// 每个顶点最多保留 4 个骨骼影响，mesh 按骨骼数拆分以保证关节下标不超过 255；
+    /// 蒙皮和带变形目标的 mesh 不参与静态 mesh 合并
+    bool import_animation = false;
+
+    /// 动画重采样的目标帧率 (帧 / 秒)，实际帧率会微调使最后一帧落在片段末尾
+    float animation_sample_rate = 30.f;
+
+    /// 动画关键帧量化存储 (平移 / 缩放为通道范围内的 unorm16，旋转为 snorm16)，每帧每通道 20 字节
+    bool quantize_animation = false;
+
+    /// 按 (mesh, 材质) 将实例分组为实例化批次，见 build_instance_batches()
+    /// 批次由实例数据推导，命中缓存时也会重新生成，因此不影响缓存键
+    bool build_instance_batches = false;
+
+    /// 在实例 world_bounds 上构建 BVH，用于拾取和剔除查询，见 build_instance_bvh()
+    /// 与实例化批次相同，命中缓存时重新构建，不影响缓存键
+    bool build_instance_bvh = false;
+
+    /// mesh 数组分配完成后调用，参数为 mesh 数量
+    /// 此后 SceneData::mesh_infos 不会再重新分配，已就绪的 mesh 可以被其他线程读取
+    std::function<void(uint32_t mesh_count)> on_meshes_allocated;
+
+    /// 单个 mesh 的所有导入阶段完成后调用
+    /// 并行模式下可能在多个线程中同时调用
+    std::function<void(uint32_t mesh_idx)> on_mesh_ready;
+
+    /// 纹理清单中的每一项就绪后调用，早于所有 mesh；命中缓存时同样调用
+    /// 并行模式下可能在多个线程中同时调用
+    TextureReadyHook on_texture_ready;
+
+    /// 每个导入阶段开始 / 结束时调用，用于转发给 Tracy 等性能分析工具
+    /// mesh 内部步骤在并行模式下从多个线程调用
+    ProfileZoneHook on_profile_zone;
+};
+
+} // namespace truvixx
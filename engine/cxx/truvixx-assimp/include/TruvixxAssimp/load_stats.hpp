@@ -0,0 +1,110 @@
+#pragma once
+
+#include "TruvixxAssimp/load_options.hpp"
+#include "TruvixxAssimp/scene_data.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace truvixx
+{
+
+/// 导入过程中计时的阶段
+///
+/// CacheRead ~ CacheWrite 是 SceneImporter::load 中依次执行的阶段 (墙钟时间)；
+/// MeshConvert ~ MeshPack 是 Meshes 内部每个 mesh 的处理步骤，
+/// 按所有 mesh 累加，并行模式下是多个线程的时间之和，可能超过 Meshes；
+/// 后加入的顶层阶段排在最后，保持已有阶段的编号不变
+enum class LoadPhase : uint32_t
+{
+    CacheRead = 0,   ///< 读取场景缓存，未启用缓存时为 0
+    Parse,           ///< Assimp 解析文件
+    PostProcess,     ///< Assimp 后处理 (全部步骤作为一个整体)
+    Materials,       ///< 材质转换和纹理清单
+    Textures,        ///< 纹理哈希、内嵌纹理拷贝和 on_texture_ready
+    Meshes,          ///< mesh 规划与转换 (包含下列各步骤)
+    Nodes,           ///< 节点树遍历，生成实例
+    InstanceBatches, ///< build_instance_batches()
+    InstanceBvh,     ///< build_instance_bvh()
+    CacheWrite,      ///< 写入场景缓存
+
+    MeshConvert,      ///< aiMesh -> MeshInfo (包括静态 mesh 合并)
+    MeshOptimize,     ///< optimize_mesh()
+    MeshMeshlets,     ///< build_meshlets()
+    MeshLods,         ///< build_lods()
+    MeshCompactIndex, ///< compact_indices()
+    MeshPack,         ///< pack_mesh_streams()
+
+    Animations, ///< 节点树和动画片段重采样 (SceneLoadOptions::import_animation)，在 Meshes 之前执行
+
+    MeshValidate, ///< validate_mesh()，Meshes 内部的步骤，在 MeshConvert 之后执行
+
+    Count,
+};
+
+inline constexpr size_t LOAD_PHASE_COUNT = static_cast<size_t>(LoadPhase::Count);
+
+[[nodiscard]] const char* load_phase_name(LoadPhase phase) noexcept;
+
+/// 一次加载的耗时和统计
+struct LoadStats
+{
+    std::array<uint64_t, LOAD_PHASE_COUNT> phase_ns{}; ///< 各阶段耗时 (纳秒)，下标为 LoadPhase
+    uint64_t total_ns = 0;                             ///< SceneImporter::load 总耗时
+
+    uint32_t mesh_count = 0;
+    uint32_t material_count = 0;
+    uint32_t instance_count = 0;
+    uint32_t meshlet_count = 0;
+    uint32_t texture_count = 0;
+    uint32_t embedded_texture_count = 0;
+    uint64_t vertex_count = 0;
+    uint64_t index_count = 0; ///< 包含所有 LOD
+
+    /// Assimp 三角化后仍不是三角形的面 (点、线)，转换时被丢弃；命中缓存时为 0
+    uint64_t dropped_face_count = 0;
+
+    /// 几何校验 (SceneLoadOptions::validate_meshes) 修改过的 mesh 数量和移除的三角形总数，逐 mesh 的结果见 MeshInfo::validation
+    uint32_t repaired_mesh_count = 0;
+    uint64_t removed_triangle_count = 0;
+
+    uint64_t scene_bytes = 0;  ///< SceneData 自身持有的堆内存 (容器容量 + vertex_arena + texture_arena)
+    uint64_t source_bytes = 0; ///< Assimp 报告的 aiScene 内存，命中缓存时为 0
+    uint64_t mapped_bytes = 0; ///< 场景缓存映射的文件大小，未命中时为 0
+
+    bool from_cache = false;
+
+    [[nodiscard]]
+    uint64_t phase(const LoadPhase p) const noexcept
+    {
+        return phase_ns[static_cast<size_t>(p)];
+    }
+};
+
+/// 根据场景数据填写 LoadStats 中的数量和 scene_bytes
+void collect_scene_counters(const SceneData& scene, LoadStats& stats);
+
+/// 计时区间，析构时将耗时累加到 stats 的对应阶段，同时转发给 ProfileZoneHook
+///
+/// 累加是原子的，多个线程可以同时为同一阶段计时
+struct LoadZone
+{
+public:
+    LoadZone(LoadStats& stats, LoadPhase phase, const ProfileZoneHook& hook);
+    ~LoadZone();
+
+    LoadZone(const LoadZone&) = delete;
+    LoadZone& operator=(const LoadZone&) = delete;
+    LoadZone(LoadZone&&) = delete;
+    LoadZone& operator=(LoadZone&&) = delete;
+
+private:
+    LoadStats& stats_;
+    const ProfileZoneHook& hook_;
+    LoadPhase phase_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+} // namespace truvixx
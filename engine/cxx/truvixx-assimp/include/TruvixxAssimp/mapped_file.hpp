@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+
+namespace truvixx
+{
+
+/// 只读内存映射文件
+///
+/// 映射期间 data() 返回的指针保持有效，close() 或析构后失效
+struct MappedFile
+{
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    // 禁止拷贝和移动 (持有系统句柄，且外部持有指向映射内存的指针)
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&&) = delete;
+    MappedFile& operator=(MappedFile&&) = delete;
+
+public:
+    /// 以只读方式映射文件
+    /// @return 成功返回 true; 空文件视为失败
+    [[nodiscard]] bool open(const std::filesystem::path& path);
+
+    /// 解除映射
+    void close() noexcept;
+
+    [[nodiscard]] bool is_open() const noexcept { return data_ != nullptr; }
+    [[nodiscard]] const std::byte* data() const noexcept { return data_; }
+    [[nodiscard]] size_t size() const noexcept { return size_; }
+
+private:
+    const std::byte* data_ = nullptr;
+    size_t size_ = 0;
+
+#ifdef _WIN32
+    void* file_handle_ = nullptr;
+    void* mapping_handle_ = nullptr;
+#endif
+};
+
+} // namespace truvixx
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "TruvixxAssimp/mapped_file.hpp"
+
+#include <cstddef>
+#include <filesystem>
+#include <utility>
+#include <vector>
+#include <assimp/DefaultIOSystem.h>
+#include <assimp/IOStream.hpp>
+#include <assimp/IOSystem.hpp>
+
+namespace truvixx
+{
+
+/// 以内存映射方式读取的 Assimp 文件流 (只读)
+///
+/// Read 直接从映射内存拷贝，不经过 stdio 的缓冲区和额外的系统调用
+struct MappedIOStream : Assimp::IOStream
+{
+public:
+    MappedIOStream() = default;
+    ~MappedIOStream() override = default;
+
+    // 禁止拷贝和移动 (持有 MappedFile)
+    MappedIOStream(const MappedIOStream&) = delete;
+    MappedIOStream& operator=(const MappedIOStream&) = delete;
+    MappedIOStream(MappedIOStream&&) = delete;
+    MappedIOStream& operator=(MappedIOStream&&) = delete;
+
+public:
+    /// 映射文件
+    /// @return 成功返回 true; 空文件视为失败 (由调用方回退到普通文件流)
+    [[nodiscard]] bool open(const std::filesystem::path& path) { return file_.open(path); }
+
+    /// @return 完整读取的元素个数，与 fread 的语义一致
+    size_t Read(void* buffer, size_t size, size_t count) override;
+
+    /// 只读，始终返回 0
+    size_t Write(const void* buffer, size_t size, size_t count) override;
+
+    aiReturn Seek(size_t offset, aiOrigin origin) override;
+    [[nodiscard]] size_t Tell() const override { return pos_; }
+    [[nodiscard]] size_t FileSize() const override { return file_.size(); }
+    void Flush() override {}
+
+private:
+    MappedFile file_;
+    size_t pos_ = 0;
+};
+
+/// 以内存映射方式打开文件的 Assimp IO 系统
+///
+/// - 只读打开的非空文件使用 MappedIOStream，其余情况 (写入、空文件) 交给 Assimp 默认的文件流
+/// - 设置 base_dir 后，相对路径相对 base_dir 解析。从内存加载场景时，
+///   文件内引用的外部资源 (.bin / .mtl 等) 通过它找到
+/// - 记录只读打开过的文件，场景缓存据此校验导入时读取的所有文件
+struct MappedIOSystem : Assimp::IOSystem
+{
+public:
+    MappedIOSystem() = default;
+    ~MappedIOSystem() override = default;
+
+    MappedIOSystem(const MappedIOSystem&) = delete;
+    MappedIOSystem& operator=(const MappedIOSystem&) = delete;
+    MappedIOSystem(MappedIOSystem&&) = delete;
+    MappedIOSystem& operator=(MappedIOSystem&&) = delete;
+
+public:
+    [[nodiscard]] bool Exists(const char* file) const override;
+    [[nodiscard]] char getOsSeparator() const override;
+    Assimp::IOStream* Open(const char* file, const char* mode = "rb") override;
+    void Close(Assimp::IOStream* file) override;
+
+    /// 相对路径的基准目录，空路径表示相对当前工作目录
+    void set_base_dir(std::filesystem::path base_dir) { base_dir_ = std::move(base_dir); }
+
+    /// 取出上次调用之后只读打开过的文件 (规范化的绝对路径，已去重)，并清空记录
+    [[nodiscard]] std::vector<std::filesystem::path> take_opened_files();
+
+private:
+    [[nodiscard]] std::filesystem::path resolve(const char* file) const;
+
+private:
+    Assimp::DefaultIOSystem fallback_; ///< 无法映射时使用的默认文件流
+    std::filesystem::path base_dir_;
+    std::vector<std::filesystem::path> opened_files_;
+};
+
+} // namespace truvixx
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "TruvixxAssimp/load_options.hpp"
+#include "TruvixxAssimp/scene_data.hpp"
+
+#include <span>
+
+namespace truvixx
+{
+
+/// 生成 LOD 链
+///
+/// 每个层级都从 LOD0 简化 (而不是从上一级)，误差直接相对 LOD0，并保证随层级单调不减
+/// 各层级共享顶点流，索引依次追加到 mesh.indices 之后，范围和误差写入 mesh.lods
+/// 简化无法继续减少三角形时提前停止，因此实际层级数可能少于 levels.size()
+///
+/// 需要 32 位索引；应在 optimize_mesh() / build_meshlets() 之后、compact_indices() 之前调用
+void build_lods(MeshInfo& mesh, std::span<const LodLevelSettings> levels);
+
+} // namespace truvixx
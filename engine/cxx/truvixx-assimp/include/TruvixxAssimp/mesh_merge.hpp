@@ -0,0 +1,24 @@
+#pragma once
+
+#include "TruvixxAssimp/scene_data.hpp"
+
+#include <span>
+
+namespace truvixx
+{
+
+/// 参与合并的 mesh 及其世界变换
+struct MeshMergeSource
+{
+    const MeshInfo* mesh = nullptr;
+    TruvixxFloat4x4 transform; ///< 列主序
+};
+
+/// 将多个 mesh 变换到世界空间后合并为一个 mesh (SceneLoadOptions::merge_static_meshes)
+///
+/// 所有源 mesh 的顶点属性 (normal / tangent / uv) 需要一致，需要 32 位索引 (在其他导入阶段之前调用)
+/// normal 使用逆转置矩阵变换，镜像变换 (行列式为负) 会同时翻转三角形环绕顺序
+/// 合并后的顶点流存放在 out.vertex_storage / uv_storage 中
+void merge_meshes(std::span<const MeshMergeSource> sources, MeshInfo& out);
+
+} // namespace truvixx
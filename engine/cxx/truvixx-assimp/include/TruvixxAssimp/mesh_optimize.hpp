@@ -0,0 +1,27 @@
+#pragma once
+
+#include "TruvixxAssimp/scene_data.hpp"
+
+namespace truvixx
+{
+
+/// 计算 ACMR (average cache miss ratio, 每个三角形的平均顶点变换次数)
+/// 使用 16 项 FIFO 缓存模型，越低越好，理论下限约 0.5
+[[nodiscard]] float compute_acmr(const MeshInfo& mesh);
+
+/// 顶点缓存 / overdraw / 顶点拉取优化
+///
+/// 1. 重排三角形以提升 post-transform cache 命中率
+/// 2. 在不明显损失缓存命中率的前提下重排三角形以减少 overdraw
+/// 3. 按首次引用顺序重排顶点以提升顶点拉取局部性，同时去掉未被引用的顶点
+///
+/// 所有顶点流 (position/normal/tangent/uv/skin)、变形偏移的顶点下标和索引会同步重映射，
+/// 重排后的顶点流存放在 mesh.vertex_storage / uv_storage 中，结果写入 mesh 的 acmr_before / acmr_after
+void optimize_mesh(MeshInfo& mesh);
+
+/// 顶点数不超过 65536 时将 indices 压缩为 indices16 并释放 32 位索引
+/// 必须在其他依赖 indices 的处理之后调用
+/// @return 是否转换为 16 位索引
+bool compact_indices(MeshInfo& mesh);
+
+} // namespace truvixx
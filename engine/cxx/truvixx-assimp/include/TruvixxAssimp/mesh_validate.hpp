@@ -0,0 +1,23 @@
+#pragma once
+
+#include "TruvixxAssimp/scene_data.hpp"
+
+namespace truvixx
+{
+
+/// 几何校验与修复，结果写入 mesh.validation (dropped_faces 由调用方填写)
+///
+/// 1. 移除索引越界、引用 NaN / Inf position、顶点重复或三点共线的三角形
+/// 2. position 中的非规格化分量置 0，NaN / Inf uv 置 0
+/// 3. 法线 / 切线重新归一化；NaN / 零长度的法线以相邻面法线替换，切线以垂直于法线的方向替换
+/// 4. 移除过三角形或存在 NaN / Inf position 时去掉不再被引用的顶点，顶点保持原有顺序
+///
+/// 先只读扫描一遍，没有问题的 mesh 不做任何分配和修改；
+/// 修改过的 mesh 的顶点流 (position/normal/tangent/uv/skin)、变形偏移的顶点下标和索引同步重映射，
+/// 新的顶点流存放在 mesh.vertex_storage / uv_storage 中；bounds 总是按校验后的 position 重新计算
+///
+/// 必须在 optimize_mesh()、build_meshlets()、build_lods() 和 compact_indices() 之前调用 (SceneImporter 转换后立即调用)，
+/// 已有 meshlet / LOD 或 16 位索引的 mesh 不做任何校验：直接返回，validation 全部为 0，bounds 保持不变
+void validate_mesh(MeshInfo& mesh);
+
+} // namespace truvixx
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "TruvixxAssimp/scene_data.hpp"
+
+#include <cstdint>
+
+namespace truvixx
+{
+
+/// meshlet 顶点数上限 (mesh shader 常用配置)
+inline constexpr uint32_t MESHLET_MAX_VERTICES = 64;
+
+/// meshlet 三角形数上限，取 124 使三角形表按 4 字节对齐时不浪费空间
+inline constexpr uint32_t MESHLET_MAX_TRIANGLES = 124;
+
+/// 划分 meshlet 时法线锥紧凑程度的权重，0 表示只考虑空间局部性
+inline constexpr float MESHLET_CONE_WEIGHT = 0.25f;
+
+/// 将 mesh 划分为 meshlet，并计算每个 meshlet 的包围球和法线锥
+///
+/// 结果写入 mesh.meshlets，需要 32 位索引 (在 compact_indices() 之前调用)
+/// 若同时开启 mesh 优化，应在 optimize_mesh() 之后调用，否则 meshlet 引用的顶点下标会失效
+void build_meshlets(MeshInfo& mesh);
+
+} // namespace truvixx
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "TruvixxAssimp/load_options.hpp"
+#include "TruvixxAssimp/mapped_file.hpp"
+#include "TruvixxAssimp/scene_data.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace truvixx
+{
+
+/// 缓存格式版本，修改二进制布局或转换逻辑时需要递增
+inline constexpr uint32_t SCENE_CACHE_VERSION = 12;
+
+/// 场景缓存的键：源文件路径 + 修改时间 + 后处理标志 + 影响输出的加载选项
+///
+/// 任何一项变化都会使缓存失效
+struct SceneCacheKey
+{
+    std::string source_path;         ///< 源文件绝对路径; 内存数据为 "memory-<内容哈希>-<base_dir 哈希>.<格式>"
+    int64_t source_mtime = 0;        ///< 源文件修改时间 (file_clock 计数); 内存数据为 0
+    uint64_t source_size = 0;        ///< 源文件大小 (额外校验)
+    uint32_t post_process_flags = 0; ///< Assimp 后处理标志 (由 SceneLoadOptions::post_process 决定)
+    uint32_t option_flags = 0;       ///< 影响输出的 SceneLoadOptions (parallel 等不影响输出的选项不计入)
+    uint64_t option_hash = 0;        ///< 无法用标志位表示的选项 (LOD 参数) 的哈希，没有时为 0
+
+    /// 根据源文件生成缓存键
+    /// @return 源文件不可访问时返回 std::nullopt
+    [[nodiscard]] static std::optional<SceneCacheKey> make(
+        const std::filesystem::path& path,
+        uint32_t post_process_flags,
+        const SceneLoadOptions& options
+    );
+
+    /// 根据内存中的场景文件生成缓存键，以内容哈希区分不同数据
+    /// @param format_hint 文件扩展名，同样的数据按不同格式解析时结果不同
+    /// @param base_dir 外部纹理路径和场景引用的其他文件都相对它解析，规范化为绝对路径后计入键
+    [[nodiscard]] static std::optional<SceneCacheKey> make(
+        std::span<const std::byte> data,
+        std::string_view format_hint,
+        const std::filesystem::path& base_dir,
+        uint32_t post_process_flags,
+        const SceneLoadOptions& options
+    );
+};
+
+/// 导入时 Assimp 额外读取的文件 (glTF .bin / OBJ .mtl 等)
+///
+/// 不属于 SceneCacheKey: 只有导入之后才知道，随缓存一起写入，读取时逐个校验
+struct SceneCacheDependency
+{
+    std::string path;  ///< 绝对路径
+    int64_t mtime = 0; ///< 修改时间 (file_clock 计数)
+    uint64_t size = 0; ///< 文件大小
+
+    /// @return 文件不可访问时返回 std::nullopt
+    [[nodiscard]] static std::optional<SceneCacheDependency> make(const std::filesystem::path& path);
+};
+
+/// 默认缓存目录
+///
+/// - 环境变量 TRUVIXX_SCENE_CACHE=0 时禁用缓存，返回空路径
+/// - 环境变量 TRUVIXX_SCENE_CACHE_DIR 指定缓存目录
+/// - 否则使用系统临时目录下的 truvixx-scene-cache
+[[nodiscard]] std::filesystem::path default_scene_cache_dir();
+
+/// 缓存文件路径: <cache_dir>/<stem>-<hash>.tvxscene
+[[nodiscard]] std::filesystem::path scene_cache_path(const std::filesystem::path& cache_dir, const SceneCacheKey& key);
+
+/// 将转换后的场景写入缓存文件
+///
+/// 先写入临时文件再重命名，避免读到写了一半的缓存
+/// @param dependencies 导入时读取的其他文件，其中任何一个变化都会使缓存失效
+/// @return 成功返回 true
+bool write_scene_cache(
+    const std::filesystem::path& cache_file,
+    const SceneCacheKey& key,
+    const SceneData& scene,
+    const std::vector<SceneCacheDependency>& dependencies
+);
+
+/// 从缓存文件读取场景
+///
+/// 顶点流 (positions/normals/tangents/uvs) 和内嵌纹理数据直接指向 out_file 的映射内存，
+/// 因此 out_file 的生命周期必须覆盖 out_scene 的使用期
+/// @return 缓存不存在、版本或键不匹配、依赖文件变化、文件损坏时返回 false
+[[nodiscard]] bool read_scene_cache(
+    const std::filesystem::path& cache_file,
+    const SceneCacheKey& key,
+    MappedFile& out_file,
+    SceneData& out_scene
+);
+
+} // namespace truvixx
@@ -1,9 +1,15 @@
 #pragma once
 
 #include "TruvixxAssimp/base_type.h"
+#include "TruvixxAssimp/bounds.hpp"
+#include "TruvixxAssimp/instance_bvh.hpp"
+#include "TruvixxAssimp/string_table.hpp"
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
-#include <string>
+#include <memory>
+#include <span>
 #include <vector>
 
 namespace truvixx
@@ -11,10 +17,59 @@ namespace truvixx
 
 inline constexpr size_t MAX_NAME_LENGTH = 256;
 
+/// 材质的纹理槽位
+enum class TextureSlot : uint32_t
+{
+    BaseColor = 0,     ///< aiTextureType_BASE_COLOR, 没有时使用 aiTextureType_DIFFUSE
+    Normal,            ///< aiTextureType_NORMALS
+    MetallicRoughness, ///< aiTextureType_METALNESS / DIFFUSE_ROUGHNESS / glTF 的 metallic-roughness 纹理
+    Emissive,          ///< aiTextureType_EMISSION_COLOR, 没有时使用 aiTextureType_EMISSIVE
+    Occlusion,         ///< aiTextureType_AMBIENT_OCCLUSION, 没有时使用 aiTextureType_LIGHTMAP
+
+    Count,
+};
+
+inline constexpr size_t TEXTURE_SLOT_COUNT = static_cast<size_t>(TextureSlot::Count);
+
+/// 材质槽位没有纹理
+inline constexpr uint32_t NO_TEXTURE = UINT32_MAX;
+
+/// 没有对应的节点 (根节点的父节点、找不到节点的骨骼、未导入动画时的实例)
+inline constexpr uint32_t NO_NODE = UINT32_MAX;
+
+/// 纹理清单中的一项 (外部文件或内嵌纹理)
+///
+/// 同一场景中相同的外部路径 / 同一个内嵌纹理只出现一次，被多个材质、多个槽位共享
+struct TextureData
+{
+    /// 外部纹理为绝对路径；内嵌纹理为材质中的原始引用 ("*0" 或内嵌文件名)
+    StringRef path;
+
+    /// 外部纹理为小写扩展名 ("png")；压缩的内嵌纹理为 aiTexture::achFormatHint ("jpg")，未压缩的为 "bgra8"
+    StringRef format_hint;
+
+    /// 内嵌纹理的数据，指向 aiScene、场景缓存的映射内存或 SceneData::texture_arena；外部纹理为 nullptr
+    const std::byte* data = nullptr;
+
+    /// 内嵌纹理为数据字节数；外部纹理为文件大小，文件不存在时为 0
+    uint64_t size = 0;
+
+    /// 仅未压缩的内嵌纹理有效 (BGRA8 texel)，其余为 0
+    uint32_t width = 0;
+    uint32_t height = 0;
+
+    /// 内容标识，可作为转码结果 (BC7 / ASTC 等) 的缓存键
+    /// 内嵌纹理为数据的哈希；外部纹理为 (路径, 文件大小, 修改时间) 的哈希，文件改变后随之变化
+    uint64_t hash = 0;
+
+    bool embedded = false;
+};
+
 /// PBR 材质数据
+/// 字符串存放在 SceneData::strings 中
 struct MaterialData
 {
-    std::string name;
+    StringRef name;
 
     // PBR 参数
     TruvixxFloat4 base_color = { 1.f, 1.f, 1.f, 1.f };
@@ -23,15 +78,25 @@ struct MaterialData
     TruvixxFloat4 emissive = { 0.0f, 0.0f, 0.0f, 1.0f };
     float opacity = 1.0f; ///< 1 = opaque, 0 = transparent
 
-    // 纹理路径 (绝对路径)
-    std::string diffuse_map;
-    std::string normal_map;
+    // 纹理路径 (绝对路径)，只记录外部纹理，内嵌纹理见 textures
+    StringRef diffuse_map;
+    StringRef normal_map;
+
+    /// 每个槽位 (TextureSlot) 在 SceneData::textures 中的下标，没有时为 NO_TEXTURE
+    std::array<uint32_t, TEXTURE_SLOT_COUNT> textures = { NO_TEXTURE, NO_TEXTURE, NO_TEXTURE, NO_TEXTURE, NO_TEXTURE };
+
+    [[nodiscard]]
+    uint32_t texture(const TextureSlot slot) const noexcept
+    {
+        return textures[static_cast<size_t>(slot)];
+    }
 };
 
 /// 场景实例 (节点)
+/// 名称存放在 SceneData::strings 中，mesh / 材质引用存放在 SceneData 的扁平数组中
 struct InstanceData
 {
-    std::string name;
+    StringRef name;
 
     /// 世界变换矩阵 (列主序, 4x4)
     /// 坐标系：右手系，X-Right，Y-Up
@@ -42,36 +107,289 @@ struct InstanceData
         0, 0, 0, 1
     };
 
-    /// 该实例引用的 mesh 索引列表
-    std::vector<uint32_t> mesh_indices;
+    /// 在 SceneData::instance_mesh_refs / instance_material_refs 中的起始下标
+    uint32_t ref_offset = 0;
+
+    /// 该实例引用的 mesh 数量
+    uint32_t ref_count = 0;
 
-    /// 该实例引用的材质索引列表 (与 mesh_indices 一一对应)
-    std::vector<uint32_t> material_indices;
+    /// 所有引用 mesh 变换到世界空间后的包围盒，没有引用 mesh 时为空
+    /// 蒙皮 mesh 按绑定姿态计算
+    TruvixxAabb world_bounds = empty_aabb();
+
+    /// 对应的节点 (SceneData::skeleton_nodes 下标)，未导入动画或合并实例为 NO_NODE
+    uint32_t node = NO_NODE;
 
     [[nodiscard]]
     uint32_t mesh_count() const noexcept
     {
-        return static_cast<uint32_t>(mesh_indices.size());
+        return ref_count;
+    }
+};
+
+/// meshlet 数据 (SceneLoadOptions::build_meshlets)
+///
+/// SoA 布局：meshlets / spheres / cones / cone_apexes 下标一一对应
+struct MeshletData
+{
+    std::vector<TruvixxMeshlet> meshlets;
+
+    /// meshlet 局部顶点 -> mesh 顶点索引
+    std::vector<uint32_t> vertices;
+
+    /// 每个三角形 3 个 meshlet 局部顶点索引，每个 meshlet 的起始按 4 字节对齐
+    std::vector<uint8_t> triangles;
+
+    std::vector<TruvixxFloat4> spheres;     ///< 包围球，xyz = 球心, w = 半径
+    std::vector<TruvixxFloat4> cones;       ///< 法线锥，xyz = 轴, w = cutoff (cos)
+    std::vector<TruvixxFloat3> cone_apexes; ///< 法线锥顶点
+
+    [[nodiscard]]
+    uint32_t count() const noexcept
+    {
+        return static_cast<uint32_t>(meshlets.size());
+    }
+};
+
+/// 单个 LOD 层级在 mesh 索引中的范围
+struct MeshLod
+{
+    uint32_t index_offset = 0; ///< 相对 mesh 索引起始的下标
+    uint32_t index_count = 0;
+    float error = 0.f; ///< 相对 LOD0 的几何误差 (mesh 局部空间距离)
+};
+
+/// 变形目标 (aiAnimMesh)，顶点偏移存放在 MeshInfo::morph_deltas 中
+struct MorphTarget
+{
+    uint32_t delta_offset = 0; ///< 在 MeshInfo::morph_deltas 中的起始下标
+    uint32_t delta_count = 0;
+    float default_weight = 0.f; ///< 没有动画时的权重
+};
+
+/// 几何校验与修复的结果 (SceneLoadOptions::validate_meshes)，见 validate_mesh()；未校验时全部为 0
+struct MeshValidation
+{
+    uint32_t dropped_faces = 0;          ///< 转换时丢弃的非三角形面 (点、线)
+    uint32_t out_of_range_triangles = 0; ///< 索引越界的三角形，已移除
+    uint32_t non_finite_triangles = 0;   ///< 引用了 NaN / Inf position 的三角形，已移除
+    uint32_t degenerate_triangles = 0;   ///< 顶点重复或三点共线的三角形，已移除
+    uint32_t removed_vertices = 0;       ///< 不再被引用、被压缩掉的顶点 (含 NaN / Inf position)
+    uint32_t denormal_positions = 0;     ///< 含非规格化分量的 position，这些分量已置 0
+    uint32_t repaired_normals = 0;       ///< 重新归一化或 (NaN / 零长度时) 以相邻面法线替换的法线
+    uint32_t repaired_tangents = 0;      ///< 重新归一化或 (NaN / 零长度时) 以垂直于法线的方向替换的切线
+    uint32_t non_finite_uvs = 0;         ///< NaN / Inf uv，已置 0
+
+    [[nodiscard]]
+    uint32_t removed_triangles() const noexcept
+    {
+        return out_of_range_triangles + non_finite_triangles + degenerate_triangles;
+    }
+
+    /// 校验是否修改了 mesh
+    [[nodiscard]]
+    bool modified() const noexcept
+    {
+        const uint32_t repaired = denormal_positions + repaired_normals + repaired_tangents + non_finite_uvs;
+        return removed_triangles() + removed_vertices + repaired > 0;
     }
 };
 
 struct MeshInfo
 {
-    uint32_t vertex_cnt;
+    uint32_t vertex_cnt = 0;
+
+    /// 顶点流，指向 aiScene、场景缓存的映射内存、SceneData::vertex_arena 或自身的 storage
+    const TruvixxFloat3* positions = nullptr;
+    const TruvixxFloat3* normals = nullptr;
+    const TruvixxFloat3* tangents = nullptr;
+    const TruvixxFloat2* uvs = nullptr;
 
-    std::vector<TruvixxFloat2> uvs;
+    /// 导入阶段生成或改写过的顶点流 (如 mesh 优化后重排的顶点)，为空表示顶点流不由自身持有
+    std::vector<TruvixxFloat3> vertex_storage;
+    std::vector<TruvixxFloat2> uv_storage;
+    /// 索引，生成 LOD 时 LOD 1..N 依次追加在 LOD0 之后
     std::vector<uint32_t> indices;
-    bool has_normal;
-    bool has_tangent;
+
+    /// 16 位索引 (SceneLoadOptions::compact_indices)，非空时 indices 为空
+    std::vector<uint16_t> indices16;
+
+    bool has_normal = false;
+    bool has_tangent = false;
+
+    /// 局部空间包围盒
+    TruvixxAabb bounds = empty_aabb();
+
+    MeshletData meshlets;
+
+    /// LOD 层级 (SceneLoadOptions::lod_levels)，lods[0] 为原始网格；为空表示只有 LOD0
+    std::vector<MeshLod> lods;
+
+    /// mesh 优化前后的 ACMR，未优化时为 0
+    float acmr_before = 0.f;
+    float acmr_after = 0.f;
+
+    /// 几何校验与修复的结果
+    MeshValidation validation;
+
+    /// 蒙皮数据 (SceneLoadOptions::import_animation)，与顶点一一对应；为空表示不是蒙皮 mesh
+    std::vector<TruvixxSkinVertex> skin;
+
+    /// 关节表：TruvixxSkinVertex::joints -> SceneData::skeleton_nodes 下标，找不到节点时为 NO_NODE
+    std::vector<uint32_t> joint_nodes;
+
+    /// 每个关节的逆绑定矩阵 (列主序)，与 joint_nodes 一一对应
+    std::vector<TruvixxFloat4x4> inverse_binds;
+
+    /// 变形目标，各目标的顶点偏移按目标顺序连续存放在 morph_deltas 中
+    std::vector<MorphTarget> morph_targets;
+    std::vector<TruvixxMorphDelta> morph_deltas;
+
+    [[nodiscard]]
+    bool has_uv() const noexcept
+    {
+        return uvs != nullptr;
+    }
+
+    [[nodiscard]]
+    bool is_skinned() const noexcept
+    {
+        return !skin.empty();
+    }
+
+    [[nodiscard]]
+    bool is_index16() const noexcept
+    {
+        return !indices16.empty();
+    }
+
+    /// LOD0 的索引数量
+    [[nodiscard]]
+    uint32_t index_count() const noexcept
+    {
+        return lods.empty() ? total_index_count() : lods[0].index_count;
+    }
+
+    /// 包含所有 LOD 的索引数量
+    [[nodiscard]]
+    uint32_t total_index_count() const noexcept
+    {
+        return static_cast<uint32_t>(is_index16() ? indices16.size() : indices.size());
+    }
+};
+
+/// 场景节点 (SceneLoadOptions::import_animation)
+struct SkeletonNode
+{
+    StringRef name;
+    uint32_t parent = NO_NODE; ///< 父节点总是排在子节点之前
+
+    /// 节点自身的局部变换 (aiNode::mTransformation 分解)，没有动画通道时使用
+    TruvixxNodeTransform rest = { { 0.f, 0.f, 0.f }, { 0.f, 0.f, 0.f, 1.f }, { 1.f, 1.f, 1.f } };
+};
+
+/// 变形权重的动画通道，对应一个 mesh 的所有变形目标
+struct MorphChannel
+{
+    uint32_t mesh = 0;
+    uint32_t weight_offset = 0; ///< 在每帧权重中的起始下标
+    uint32_t weight_count = 0;  ///< 即该 mesh 的变形目标数量
+};
+
+/// 重采样后的动画片段
+///
+/// 关键帧以固定帧率重采样，按 [帧][通道] 连续存放：
+/// 采样任意时刻只需读取相邻两帧的连续内存，不需要按通道查找关键帧
+struct AnimationClip
+{
+    StringRef name;
+    float duration = 0.f;    ///< 秒
+    float sample_rate = 0.f; ///< 实际帧率 (frame_count - 1) / duration，只有一帧时为 0
+    uint32_t frame_count = 0;
+
+    /// 节点通道在 SceneData::animation_channels 中的区间
+    uint32_t channel_offset = 0;
+    uint32_t channel_count = 0;
+
+    /// 第 0 帧第 0 个通道在 animation_keys (量化时为 animation_quantized_keys) 中的下标
+    /// 共 frame_count * channel_count 个
+    uint64_t key_offset = 0;
+
+    /// 变形通道在 SceneData::morph_channels 中的区间
+    uint32_t morph_channel_offset = 0;
+    uint32_t morph_channel_count = 0;
+
+    /// 每帧的变形权重数量，即所有变形通道 weight_count 之和
+    uint32_t morph_weights_per_frame = 0;
+
+    /// 在 SceneData::morph_weights 中的起始下标，共 frame_count * morph_weights_per_frame 个
+    uint64_t morph_weight_offset = 0;
+
+    /// 关键帧是否量化 (SceneLoadOptions::quantize_animation)
+    bool quantized = false;
 };
 
 /// 场景容器，持有所有 mesh、材质和实例数据
+///
+/// 实例和材质不单独持有堆内存：名称统一放在 strings 中，
+/// 实例的 mesh / 材质引用是两个扁平数组中的连续区间，整个场景只有少量大块分配
 struct SceneData
 {
     std::vector<MeshInfo> mesh_infos;
     std::vector<MaterialData> materials;
     std::vector<InstanceData> instances;
 
+    /// 所有材质引用的纹理，见 MaterialData::textures
+    std::vector<TextureData> textures;
+
+    /// 所有实例的 mesh 引用，按实例顺序连续存放
+    std::vector<uint32_t> instance_mesh_refs;
+
+    /// 所有实例的材质引用，与 instance_mesh_refs 一一对应
+    std::vector<uint32_t> instance_material_refs;
+
+    /// 实例名、材质名、纹理路径和格式
+    StringTable strings;
+
+    /// 所有实例 world_bounds 的并集
+    TruvixxAabb bounds = empty_aabb();
+
+    /// 实例包围盒上的 BVH，见 build_instance_bvh()
+    InstanceBvh instance_bvh;
+
+    /// 节点树 (SceneLoadOptions::import_animation)，按层序排列，与实例遍历的顺序一致
+    std::vector<SkeletonNode> skeleton_nodes;
+
+    std::vector<AnimationClip> animations;
+
+    /// 所有片段的节点通道 -> skeleton_nodes 下标
+    std::vector<uint32_t> animation_channels;
+
+    /// 未量化片段的关键帧
+    std::vector<TruvixxNodeTransform> animation_keys;
+
+    /// 量化片段的关键帧，及每个通道的取值范围 (与 animation_channels 一一对应，没有量化片段时为空)
+    std::vector<TruvixxQuantizedTransform> animation_quantized_keys;
+    std::vector<TruvixxTransformRange> animation_ranges;
+
+    /// 所有片段的变形通道和每帧权重
+    std::vector<MorphChannel> morph_channels;
+    std::vector<float> morph_weights;
+
+    /// 按 (mesh, 材质) 分组的实例化批次，见 build_instance_batches()
+    std::vector<TruvixxInstanceBatch> instance_batches;
+
+    /// 所有批次的世界变换，每个批次占一段连续区间
+    std::vector<TruvixxFloat4x4> batch_transforms;
+
+    /// 紧凑模式 (SceneLoadOptions::release_source) 下所有 mesh 顶点流共用的一块内存
+    std::unique_ptr<std::byte[]> vertex_arena;
+    size_t vertex_arena_size = 0;
+
+    /// 紧凑模式下内嵌纹理数据的拷贝 (aiScene 释放后仍然有效)
+    std::unique_ptr<std::byte[]> texture_arena;
+    size_t texture_arena_size = 0;
+
     [[nodiscard]]
     uint32_t mesh_count() const noexcept
     {
@@ -89,6 +407,38 @@ struct SceneData
     {
         return static_cast<uint32_t>(instances.size());
     }
+
+    [[nodiscard]]
+    uint32_t texture_count() const noexcept
+    {
+        return static_cast<uint32_t>(textures.size());
+    }
+
+    [[nodiscard]]
+    uint32_t node_count() const noexcept
+    {
+        return static_cast<uint32_t>(skeleton_nodes.size());
+    }
+
+    [[nodiscard]]
+    uint32_t animation_count() const noexcept
+    {
+        return static_cast<uint32_t>(animations.size());
+    }
+
+    /// 实例引用的 mesh 索引
+    [[nodiscard]]
+    std::span<const uint32_t> mesh_refs(const InstanceData& instance) const noexcept
+    {
+        return { instance_mesh_refs.data() + instance.ref_offset, instance.ref_count };
+    }
+
+    /// 实例引用的材质索引 (与 mesh_refs 一一对应)
+    [[nodiscard]]
+    std::span<const uint32_t> material_refs(const InstanceData& instance) const noexcept
+    {
+        return { instance_material_refs.data() + instance.ref_offset, instance.ref_count };
+    }
 };
 
 } // namespace truvixx
\ No newline at end of file
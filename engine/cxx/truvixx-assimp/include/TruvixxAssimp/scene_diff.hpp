@@ -0,0 +1,54 @@
+#pragma once
+
+#include "TruvixxAssimp/scene_data.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace truvixx
+{
+
+/// 场景内容的指纹：每个 mesh / 材质转换结果的哈希，用于重新导入时找出变化的部分
+struct SceneFingerprint
+{
+    /// 顶点流、索引、LOD 范围以及蒙皮 / 变形数据的哈希，与 SceneData::mesh_infos 一一对应
+    std::vector<uint64_t> meshes;
+
+    /// PBR 参数和各槽位纹理内容的哈希，与 SceneData::materials 一一对应
+    std::vector<uint64_t> materials;
+
+    /// 所有实例 (世界变换、mesh / 材质引用) 的整体哈希
+    uint64_t instances = 0;
+};
+
+/// 计算场景指纹，需要读取所有顶点数据
+[[nodiscard]] SceneFingerprint fingerprint_scene(const SceneData& scene);
+
+/// 两次加载之间的变化
+///
+/// 按下标比较：两次都存在且哈希不同的为 changed，只在新场景中存在的为 added，
+/// 只在旧场景中存在的为 removed。各列表按下标升序
+struct SceneDiff
+{
+    std::vector<uint32_t> added_meshes;
+    std::vector<uint32_t> removed_meshes;
+    std::vector<uint32_t> changed_meshes;
+
+    std::vector<uint32_t> added_materials;
+    std::vector<uint32_t> removed_materials;
+    std::vector<uint32_t> changed_materials;
+
+    /// 实例的变换或引用有变化，需要重建 TLAS
+    bool instances_changed = false;
+
+    [[nodiscard]]
+    bool empty() const noexcept
+    {
+        return added_meshes.empty() && removed_meshes.empty() && changed_meshes.empty() && added_materials.empty() &&
+               removed_materials.empty() && changed_materials.empty() && !instances_changed;
+    }
+};
+
+[[nodiscard]] SceneDiff diff_scenes(const SceneFingerprint& before, const SceneFingerprint& after);
+
+} // namespace truvixx
@@ -1,15 +1,32 @@
 #pragma once
 
+#include "TruvixxAssimp/load_options.hpp"
+#include "TruvixxAssimp/load_stats.hpp"
+#include "TruvixxAssimp/mapped_file.hpp"
+#include "TruvixxAssimp/mapped_io_system.hpp"
+#include "TruvixxAssimp/scene_cache.hpp"
 #include "TruvixxAssimp/scene_data.hpp"
+#include "TruvixxAssimp/scene_diff.hpp"
 
+#include <array>
+#include <chrono>
 #include <filesystem>
+#include <cstdint>
+#include <functional>
 #include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
 #include <assimp/Importer.hpp>
 #include <assimp/scene.h>
 
 namespace truvixx
 {
 
+struct NodeLookup;
+
 struct SceneImporter
 {
 public:
@@ -25,8 +42,32 @@ public:
 public:
     /// 加载场景文件
     /// @param path 场景文件路径
+    /// @param options 加载选项
+    /// @return 成功返回 true
+    [[nodiscard]] bool load(const std::filesystem::path& path, const SceneLoadOptions& options = {});
+
+    /// 从内存加载场景 (归档包、网络下载等)，不需要先写入临时文件
+    /// @param data 场景文件的完整内容，只在本次调用期间读取
+    /// @param format_hint 文件扩展名 ("glb"、"fbx" 等)，用于选择 Assimp 导入器
+    /// @param options 加载选项
+    /// @param base_dir 外部资源 (纹理、.bin、.mtl) 相对路径的基准目录，空路径表示当前工作目录
     /// @return 成功返回 true
-    [[nodiscard]] bool load(const std::filesystem::path& path);
+    [[nodiscard]] bool load_from_memory(
+        std::span<const std::byte> data,
+        std::string_view format_hint,
+        const SceneLoadOptions& options = {},
+        const std::filesystem::path& base_dir = {}
+    );
+
+    /// 重新加载场景文件 (热重载)，并与当前已加载的场景比较
+    ///
+    /// 成功后 get_diff() 给出变化的 mesh / 材质下标，调用方只需重新上传这些 mesh、重建其 BLAS。
+    /// 当前没有已加载的场景时，所有 mesh / 材质都视为 added
+    /// @return 成功返回 true; 失败时与 load() 一样，之前的场景已被清空
+    [[nodiscard]] bool reload(const std::filesystem::path& path, const SceneLoadOptions& options = {});
+
+    /// 最近一次 reload() 相对之前场景的变化，load() 之后为空
+    [[nodiscard]] const SceneDiff& get_diff() const noexcept;
 
     /// 获取加载后的场景数据 (只读引用)
     [[nodiscard]] const SceneData& get_scene() const noexcept;
@@ -34,33 +75,125 @@ public:
     /// 是否已成功加载场景
     [[nodiscard]] bool is_loaded() const noexcept;
 
-    TruvixxFloat3* get_position(uint32_t mesh_idx) const;
-    TruvixxFloat3* get_normal(uint32_t mesh_idx) const;
-    TruvixxFloat3* get_tangent(uint32_t mesh_idx) const;
+    /// 本次加载是否命中场景缓存 (未经过 Assimp)
+    [[nodiscard]] bool is_from_cache() const noexcept;
+
+    /// 最近一次成功加载的耗时和统计
+    [[nodiscard]] const LoadStats& get_stats() const noexcept;
+
+    /// 设置场景缓存目录，空路径表示禁用缓存
+    /// 默认值见 default_scene_cache_dir()
+    void set_cache_dir(std::filesystem::path cache_dir);
+
+    [[nodiscard]] const TruvixxFloat3* get_position(uint32_t mesh_idx) const;
+    [[nodiscard]] const TruvixxFloat3* get_normal(uint32_t mesh_idx) const;
+    [[nodiscard]] const TruvixxFloat3* get_tangent(uint32_t mesh_idx) const;
 
     /// 清空已加载的数据
     void clear();
 
 private:
+    /// 一个合并后的静态 mesh
+    struct MergeGroup
+    {
+        uint32_t material_index = 0;
+        std::vector<uint32_t> sources;           ///< 源 aiMesh 下标
+        std::vector<TruvixxFloat4x4> transforms; ///< 源 mesh 唯一引用处的世界变换
+    };
+
+    /// aiMesh 到输出 mesh 的映射
+    ///
+    /// 输出 mesh 依次为 kept_sources 对应的 aiMesh 和 merge_groups 对应的合并 mesh
+    struct MeshPlan
+    {
+        static constexpr uint32_t MERGED = UINT32_MAX;
+
+        std::vector<uint32_t> output_of_source; ///< aiMesh -> 输出 mesh，被合并的为 MERGED
+        std::vector<uint32_t> kept_sources;     ///< 不参与合并的 aiMesh
+        std::vector<MergeGroup> merge_groups;
+        bool skip_empty_nodes = false;
+
+        [[nodiscard]]
+        uint32_t output_count() const noexcept
+        {
+            return static_cast<uint32_t>(kept_sources.size() + merge_groups.size());
+        }
+
+        /// 输出 mesh 对应的源 aiMesh
+        [[nodiscard]]
+        std::span<const uint32_t> sources_of(const uint32_t output_idx) const noexcept
+        {
+            if (output_idx < kept_sources.size())
+                return { &kept_sources[output_idx], 1 };
+            return merge_groups[output_idx - kept_sources.size()].sources;
+        }
+    };
+
+    /// load / load_from_memory 的公共流程：查询缓存，未命中时解析并转换
+    /// @param read_source 不带后处理地解析源数据，失败返回 nullptr
+    [[nodiscard]] bool import_scene(
+        const SceneLoadOptions& options,
+        const std::optional<SceneCacheKey>& cache_key,
+        std::chrono::steady_clock::time_point load_start,
+        const std::function<const aiScene*()>& read_source
+    );
+
+    /// 根据加载选项确定输出 mesh (静态 mesh 合并)
+    void plan_meshes(const SceneLoadOptions& options, uint32_t attributes);
+
+    /// 生成第 output_idx 个输出 mesh 的原始数据 (合并 mesh 在此完成变换和拼接)
+    /// @param skin_lookup 导入动画时用于解析蒙皮关节，否则为 nullptr
+    void build_output_mesh(uint32_t output_idx, uint32_t attributes, const NodeLookup* skin_lookup, MeshInfo& out_mesh) const;
+
+    /// 由实例推导的数据 (实例化批次、BVH)，命中缓存时同样需要构建
+    void build_derived_data(const SceneLoadOptions& options);
+
+    /// 加载结束时填写统计中的数量和总耗时
+    void finish_stats(std::chrono::steady_clock::time_point load_start);
+
     /// 处理场景树中的所有节点
     void process_nodes(const aiNode* root_node);
 
     /// 处理单个节点
-    void process_node(const aiNode* node, const aiMatrix4x4& parent_transform);
+    /// @param node_idx 节点在 SceneData::skeleton_nodes 中的下标，未导入动画时为 NO_NODE
+    void process_node(const aiNode* node, const aiMatrix4x4& parent_transform, uint32_t node_idx);
 
     /// 处理 Mesh
-    static void process_mesh_info(const aiMesh* mesh, MeshInfo& out_mesh);
+    /// @param attributes 保留的顶点属性，VertexAttribute 位掩码
+    static void process_mesh_info(const aiMesh* mesh, uint32_t attributes, MeshInfo& out_mesh);
+
+    /// 材质中的字符串，并行转换时先暂存，之后统一写入字符串表
+    struct MaterialStrings
+    {
+        std::string name;
+        std::array<std::string, TEXTURE_SLOT_COUNT> textures; ///< 每个槽位的原始纹理引用 (相对路径或 "*0")
+    };
 
     /// 处理材质
-    void process_material(const aiMaterial* material, MaterialData& out_material) const;
+    static void process_material(const aiMaterial* material, MaterialData& out_material, MaterialStrings& out_strings);
+
+    /// 材质字符串写入字符串表，纹理引用去重后生成纹理清单 (SceneData::textures)
+    void build_texture_manifest(std::span<const MaterialStrings> material_strings);
+
+    /// 计算纹理哈希并调用 on_texture_ready
+    /// @param hash_embedded 内嵌纹理的哈希是否需要计算 (命中缓存时已从缓存读取)
+    void publish_textures(const SceneLoadOptions& options, bool hash_embedded);
 
 private:
     std::unique_ptr<Assimp::Importer> importer_; ///< Assimp 导入器，持有 ai_scene 生命周期
+    MappedIOSystem* io_system_ = nullptr;        ///< Assimp 读取文件使用的 IO 系统 (由 importer_ 管理)
     const aiScene* ai_scene_ = nullptr;          ///< Assimp 场景 (由 importer_ 管理)
-
-    SceneData scene_data_;      ///< 转换后的场景数据
-    std::filesystem::path dir_; ///< 场景文件所在目录
-    bool is_loaded_ = false;    ///< 加载状态
+    MappedFile cache_file_;                      ///< 命中缓存时的映射文件，持有顶点流生命周期
+
+    MeshPlan mesh_plan_;              ///< 本次加载的输出 mesh 映射
+    SceneData scene_data_;            ///< 转换后的场景数据
+    LoadStats stats_;                 ///< 本次加载的耗时和统计
+    SceneFingerprint fingerprint_;    ///< reload() 计算的当前场景指纹，下一次 reload() 时复用
+    bool has_fingerprint_ = false;    ///< fingerprint_ 是否对应当前场景
+    SceneDiff diff_;                  ///< 最近一次 reload() 的变化
+    std::filesystem::path dir_;       ///< 场景文件所在目录 (从内存加载时为 base_dir)
+    std::filesystem::path cache_dir_; ///< 场景缓存目录，空表示禁用
+    bool is_loaded_ = false;          ///< 加载状态
 };
 
 } // namespace truvixx
\ No newline at end of file
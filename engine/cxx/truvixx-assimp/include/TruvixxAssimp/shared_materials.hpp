@@ -0,0 +1,44 @@
+#pragma once
+
+#include "TruvixxAssimp/scene_data.hpp"
+#include "TruvixxAssimp/string_table.hpp"
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace truvixx
+{
+
+/// 多个场景之间去重后的材质和纹理 (批量导入)
+///
+/// 纹理按 (哈希, 大小) 去重：相同路径的外部纹理、内容相同的内嵌纹理只保留一份；
+/// PBR 参数和各槽位纹理都相同的材质视为同一个，名称取第一次出现的。
+/// 字符串 (材质名、纹理路径) 存放在 strings 中，materials 的纹理下标指向 textures
+struct SharedMaterials
+{
+    std::vector<MaterialData> materials;
+
+    /// 去重后的纹理清单，按第一次被引用的顺序；内嵌纹理的 data 指向各场景自身的数据
+    std::vector<TextureData> textures;
+
+    StringTable strings;
+
+    /// 场景材质 -> materials 下标，场景 i 的材质从 remap_offsets[i] 开始连续存放
+    std::vector<uint32_t> remap;
+    std::vector<uint32_t> remap_offsets;
+
+    /// 场景 scene_idx 的材质映射，长度为该场景的材质数量
+    [[nodiscard]]
+    std::span<const uint32_t> scene_remap(const uint32_t scene_idx) const noexcept
+    {
+        const uint32_t end = scene_idx + 1 < remap_offsets.size() ? remap_offsets[scene_idx + 1] : static_cast<uint32_t>(remap.size());
+        return { remap.data() + remap_offsets[scene_idx], end - remap_offsets[scene_idx] };
+    }
+};
+
+/// 按场景顺序合并材质并去重
+/// @param scenes 可以包含 nullptr (加载失败的场景)，视为没有材质
+[[nodiscard]] SharedMaterials build_shared_materials(std::span<const SceneData* const> scenes);
+
+} // namespace truvixx
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "TruvixxAssimp/base_type.h"
+
+#include <cstdint>
+
+namespace truvixx
+{
+
+/// 运行时检测到的指令集
+///
+/// x64 上 SSE2 总是可用，AVX2 按 CPUID 检测；ARM64 上 NEON 总是可用
+enum class SimdLevel : uint32_t
+{
+    Scalar = 0,
+    Sse2 = 1,
+    Avx2 = 2,
+    Neon = 3,
+};
+
+/// 当前 CPU 使用的指令集，首次调用时检测
+[[nodiscard]] SimdLevel simd_level() noexcept;
+
+[[nodiscard]] const char* simd_level_name(SimdLevel level) noexcept;
+
+/// 从 3 分量 uv (aiVector3D 布局) 中取出 xy
+/// @param flip_v 为 true 时输出 y = 1 - y，结果与 aiProcess_FlipUVs 逐位一致；
+///        导入时已经启用 FlipUVs (材质的 UV 变换需要一起翻转)，因此 SceneImporter 传入 false
+void copy_uvs(const TruvixxFloat3* src, uint32_t count, bool flip_v, TruvixxFloat2* dst) noexcept;
+
+/// 逐分量求 count 个顶点的最小 / 最大值，并与 in_out_min / in_out_max 原有的值合并
+void min_max_float3(const TruvixxFloat3* src, uint32_t count, TruvixxFloat3& in_out_min, TruvixxFloat3& in_out_max) noexcept;
+
+/// 4x4 矩阵转置 (行主序 <-> 列主序)，src 与 dst 不能重叠
+void transpose_4x4(const float* src, float* dst) noexcept;
+
+/// 行主序 4x4 矩阵乘法 dst = a * b，dst 不能与 a / b 重叠
+void multiply_4x4(const float* a, const float* b, float* dst) noexcept;
+
+} // namespace truvixx
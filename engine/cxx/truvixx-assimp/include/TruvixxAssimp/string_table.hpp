@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace truvixx
+{
+
+/// 字符串表中的引用
+struct StringRef
+{
+    uint32_t offset = 0; ///< 相对 StringTable::data() 的字节偏移
+    uint32_t length = 0; ///< 不含结尾的 '\0'
+};
+
+/// 只追加的字符串表
+///
+/// 所有字符串连续存放在一块内存中，每个字符串以 '\0' 结尾，可以直接作为 C 字符串使用
+/// 相同的字符串只存一份；偏移 0 处固定为空字符串，默认构造的 StringRef 即为空字符串
+struct StringTable
+{
+public:
+    StringTable();
+
+    /// 加入字符串，已存在时返回已有的引用
+    StringRef intern(std::string_view str);
+
+    [[nodiscard]] std::string_view view(StringRef ref) const noexcept;
+
+    [[nodiscard]] const char* c_str(StringRef ref) const noexcept;
+
+    /// 引用是否落在表内且以 '\0' 结尾
+    [[nodiscard]] bool is_valid(StringRef ref) const noexcept;
+
+    [[nodiscard]] const char* data() const noexcept;
+    [[nodiscard]] size_t size() const noexcept;
+
+    /// 用已有的字符串 blob (如场景缓存) 替换当前内容，并重建去重索引
+    /// @return blob 为空或不以 '\0' 结尾时返回 false，此时表被重置为空
+    bool assign(const char* blob, size_t size);
+
+    void clear();
+
+private:
+    void rehash(size_t slot_count);
+    void insert_slot(uint32_t entry_idx);
+
+private:
+    std::string blob_;
+
+    /// 开放寻址哈希表，存放 entries_ 下标 + 1，0 表示空槽
+    std::vector<uint32_t> slots_;
+    std::vector<StringRef> entries_;
+};
+
+} // namespace truvixx
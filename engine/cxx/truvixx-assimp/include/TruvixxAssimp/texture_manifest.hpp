@@ -0,0 +1,21 @@
+#pragma once
+
+#include "TruvixxAssimp/scene_data.hpp"
+
+#include <cstdint>
+#include <string_view>
+
+namespace truvixx
+{
+
+/// 计算 TextureData::hash
+///
+/// 内嵌纹理对数据做哈希；外部纹理只读取文件元信息 (大小、修改时间)，同时写入 TextureData::size
+/// @param path 纹理路径，即 texture.path 在字符串表中的内容
+void hash_texture(std::string_view path, TextureData& texture);
+
+/// 将所有内嵌纹理的数据拷贝到 SceneData::texture_arena，TextureData::data 改为指向 arena
+/// 用于在释放 aiScene 之前保留内嵌纹理
+void pack_embedded_textures(SceneData& scene);
+
+} // namespace truvixx
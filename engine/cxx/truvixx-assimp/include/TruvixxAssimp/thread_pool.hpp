@@ -0,0 +1,128 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace truvixx
+{
+
+/// 固定大小的线程池
+///
+/// 导入阶段的并行任务 (mesh 转换、材质转换等) 共用 ThreadPool::global()
+struct ThreadPool
+{
+public:
+    /// @param thread_count 工作线程数，0 表示 hardware_concurrency - 1 (调用线程也会参与 parallel_for)
+    explicit ThreadPool(uint32_t thread_count = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    ThreadPool(ThreadPool&&) = delete;
+    ThreadPool& operator=(ThreadPool&&) = delete;
+
+public:
+    /// 提交一个任务，由任意工作线程执行
+    void submit(std::function<void()> task);
+
+    [[nodiscard]] uint32_t thread_count() const noexcept { return static_cast<uint32_t>(workers_.size()); }
+
+    /// 进程级共享线程池，首次调用时创建
+    [[nodiscard]] static ThreadPool& global();
+
+private:
+    void worker_loop();
+
+private:
+    std::vector<std::thread> workers_;
+    std::deque<std::function<void()>> tasks_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool stopping_ = false;
+};
+
+/// 对 [0, count) 中的每个下标调用 fn(i)
+///
+/// - 调用线程也会参与执行，因此在工作线程中嵌套调用不会死锁
+/// - 每个下标只执行一次，fn 只应写入与下标对应的输出，以保证结果与串行执行一致
+/// - 返回时所有 fn 都已执行完成
+template <typename F>
+void parallel_for(const uint32_t count, F&& fn, const uint32_t grain = 1)
+{
+    if (count == 0)
+        return;
+
+    ThreadPool& pool = ThreadPool::global();
+    const uint32_t chunk = std::max(grain, 1u);
+    const uint32_t chunk_count = (count + chunk - 1) / chunk;
+    if (chunk_count == 1 || pool.thread_count() == 0)
+    {
+        for (uint32_t i = 0; i < count; ++i)
+            fn(i);
+        return;
+    }
+
+    // 晚到的工作线程可能在 parallel_for 返回后才执行，因此状态需要共享所有权
+    struct State
+    {
+        std::atomic<uint32_t> next_chunk{ 0 };
+        std::atomic<uint32_t> done_chunk{ 0 };
+        std::mutex mutex;
+        std::condition_variable cv;
+    };
+    auto state = std::make_shared<State>();
+
+    // fn 只在 done_chunk == chunk_count 之前被访问，此时调用线程仍在等待，引用有效
+    auto run_chunks = [state, count, chunk, chunk_count, &fn]() {
+        while (true)
+        {
+            const uint32_t chunk_idx = state->next_chunk.fetch_add(1, std::memory_order_relaxed);
+            if (chunk_idx >= chunk_count)
+                return;
+
+            const uint32_t begin = chunk_idx * chunk;
+            const uint32_t end = std::min(begin + chunk, count);
+            for (uint32_t i = begin; i < end; ++i)
+                fn(i);
+
+            if (state->done_chunk.fetch_add(1, std::memory_order_acq_rel) + 1 == chunk_count)
+            {
+                std::lock_guard lock(state->mutex);
+                state->cv.notify_all();
+            }
+        }
+    };
+
+    const uint32_t helper_count = std::min(pool.thread_count(), chunk_count - 1);
+    for (uint32_t i = 0; i < helper_count; ++i)
+        pool.submit(run_chunks);
+
+    run_chunks();
+
+    std::unique_lock lock(state->mutex);
+    state->cv.wait(lock, [&] { return state->done_chunk.load(std::memory_order_acquire) == chunk_count; });
+}
+
+/// 根据 parallel 选择并行或串行执行 fn(i)，两者结果一致
+template <typename F>
+void for_each_index(const bool parallel, const uint32_t count, F&& fn, const uint32_t grain = 1)
+{
+    if (parallel)
+    {
+        parallel_for(count, std::forward<F>(fn), grain);
+        return;
+    }
+
+    for (uint32_t i = 0; i < count; ++i)
+        fn(i);
+}
+
+} // namespace truvixx
@@ -0,0 +1,189 @@
+#pragma once
+
+#include "TruvixxAssimp/mapped_file.hpp"
+#include "TruvixxAssimp/scene_data.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <vector>
+
+namespace truvixx
+{
+
+/// 分块场景文件版本，修改二进制布局时需要递增
+inline constexpr uint32_t TILED_SCENE_VERSION = 1;
+
+/// 分块参数，tile 同时满足两个条件后不再切分
+struct TileBuildSettings
+{
+    uint32_t max_instances_per_tile = 256;          ///< tile 中的实例数上限
+    uint64_t max_tile_bytes = uint64_t{ 64 } << 20; ///< tile 引用的 mesh 数据上限 (只有一个实例时无法再切分)
+};
+
+/// 将场景按实例包围盒划分为 tile，写入分块场景文件 (.tvxtiled)
+///
+/// - 以实例 world_bounds 中心沿最长轴的中位数递归二分，没有 mesh 的实例不属于任何 tile
+/// - 每个 mesh 的顶点流、索引和 LOD 表作为一个 chunk 连续存放，只存一份，被多个 tile 引用时共享
+/// - 材质、纹理、实例和字符串作为元数据，打开文件时全部读入
+/// - meshlet、蒙皮、变形目标和动画不写入
+///
+/// 先写入临时文件再重命名
+/// @return 成功返回 true
+bool write_tiled_scene(
+    const std::filesystem::path& path,
+    const SceneData& scene,
+    const TileBuildSettings& settings = {}
+);
+
+/// 分块场景中的一个 tile
+struct TileInfo
+{
+    TruvixxAabb bounds = empty_aabb(); ///< 所有实例 world_bounds 的并集
+    uint32_t instance_offset = 0;      ///< TiledScene::tile_instances() 中的区间
+    uint32_t instance_count = 0;
+    uint32_t mesh_offset = 0; ///< TiledScene::tile_meshes() 中的区间，去重后升序
+    uint32_t mesh_count = 0;
+    uint64_t bytes = 0; ///< 全部 mesh 常驻所需的内存 (共享的 mesh 在每个 tile 中都计入)
+};
+
+/// 分块场景中 mesh 的元信息，不需要加载即可访问
+struct TiledMeshInfo
+{
+    uint32_t vertex_cnt = 0;
+    uint32_t index_cnt = 0;     ///< 包含所有 LOD
+    uint32_t lod_index_cnt = 0; ///< LOD0 的索引数量
+    uint32_t lod_count = 0;     ///< 0 表示只有 LOD0
+    bool has_normal = false;
+    bool has_tangent = false;
+    bool has_uv = false;
+    bool index16 = false;
+    TruvixxAabb bounds = empty_aabb();
+    uint64_t bytes = 0; ///< 常驻时占用的内存
+};
+
+/// 流式加载统计
+struct TileStreamStats
+{
+    uint64_t budget_bytes = 0;   ///< 0 表示不限
+    uint64_t resident_bytes = 0; ///< 常驻 mesh 占用的内存
+    uint32_t resident_mesh_count = 0;
+    uint32_t resident_tile_count = 0; ///< 全部 mesh 常驻的 tile
+
+    // 最近一次 update()
+    uint32_t loaded_mesh_count = 0;
+    uint32_t evicted_mesh_count = 0;
+    uint64_t loaded_bytes = 0;
+    uint32_t skipped_tile_count = 0; ///< 因预算不足被跳过的请求
+};
+
+/// 在固定内存预算下按 tile 换入换出 mesh 的分块场景
+///
+/// 元数据在 open() 时读入并一直常驻；mesh 只在所属 tile 被请求时从文件拷贝到自身的内存，
+/// 预算不足时按最久未使用的顺序淘汰本次没有被请求的 mesh
+///
+/// update() 需要独占访问，并使被淘汰 mesh 的指针失效；两次 update() 之间的只读访问可以在多个线程中同时进行
+struct TiledScene
+{
+public:
+    TiledScene() = default;
+
+    // 持有映射文件，且外部持有指向常驻 mesh 的指针
+    TiledScene(const TiledScene&) = delete;
+    TiledScene& operator=(const TiledScene&) = delete;
+    TiledScene(TiledScene&&) = delete;
+    TiledScene& operator=(TiledScene&&) = delete;
+
+public:
+    /// 打开分块场景文件，初始时没有常驻的 mesh
+    /// @param budget_bytes mesh 的内存预算，0 表示不限
+    /// @return 文件不存在、版本不匹配或损坏时返回 false
+    [[nodiscard]] bool open(const std::filesystem::path& path, uint64_t budget_bytes);
+
+    void close() noexcept;
+
+    /// 材质、纹理、实例、引用数组和字符串；mesh_infos 为空，mesh 通过 mesh_info() / resident_mesh() 访问
+    ///
+    /// 内嵌纹理数据指向映射内存
+    [[nodiscard]] const SceneData& metadata() const noexcept { return metadata_; }
+
+    [[nodiscard]] uint32_t mesh_count() const noexcept { return static_cast<uint32_t>(meshes_.size()); }
+    [[nodiscard]] const TiledMeshInfo& mesh_info(const uint32_t mesh) const noexcept { return meshes_[mesh]; }
+
+    [[nodiscard]] uint32_t tile_count() const noexcept { return static_cast<uint32_t>(tiles_.size()); }
+    [[nodiscard]] std::span<const TileInfo> tiles() const noexcept { return tiles_; }
+    [[nodiscard]] std::span<const uint32_t> tile_instances() const noexcept { return tile_instances_; }
+    [[nodiscard]] std::span<const uint32_t> tile_meshes() const noexcept { return tile_meshes_; }
+
+    /// @return mesh 未常驻时返回 nullptr
+    [[nodiscard]] const MeshInfo* resident_mesh(uint32_t mesh) const noexcept;
+
+    /// tile 的全部 mesh 是否都已常驻
+    [[nodiscard]] bool is_tile_resident(uint32_t tile) const noexcept;
+
+    /// 修改预算，下一次 update() 时生效
+    void set_budget(const uint64_t budget_bytes) noexcept { budget_ = budget_bytes; }
+
+    /// 请求一组 tile 常驻
+    ///
+    /// 按顺序为 tile 分配预算，装不下的 tile 被跳过 (后面较小的 tile 仍可能装下)；
+    /// 然后淘汰未被请求的 mesh 直到新 mesh 能放下，最后并行读入缺失的 mesh
+    /// @param tiles 按优先级排列的 tile 下标 (通常由近到远)，越界的下标被忽略
+    void update(std::span<const uint32_t> tiles);
+
+    /// 请求包围盒与 camera 距离不超过 radius 的 tile，由近到远分配预算
+    void update(const TruvixxFloat3& camera, float radius);
+
+    /// 最近一次 update() 读入的 mesh，按请求顺序
+    [[nodiscard]] std::span<const uint32_t> loaded_meshes() const noexcept { return loaded_; }
+
+    /// 最近一次 update() 淘汰的 mesh
+    [[nodiscard]] std::span<const uint32_t> evicted_meshes() const noexcept { return evicted_; }
+
+    [[nodiscard]] TileStreamStats stats() const noexcept;
+
+private:
+    /// mesh chunk 中各段数据在文件中的偏移，0 表示不存在
+    struct ChunkOffsets
+    {
+        uint64_t positions = 0;
+        uint64_t normals = 0;
+        uint64_t tangents = 0;
+        uint64_t uvs = 0;
+        uint64_t indices = 0;
+        uint64_t lods = 0;
+    };
+
+    struct MeshSlot
+    {
+        MeshInfo mesh;
+        bool resident = false;
+        uint64_t last_used = 0; ///< 最近一次被请求的 update 序号
+        uint64_t wanted = 0;    ///< 等于当前 update 序号时表示本次被请求
+    };
+
+    /// 从映射内存拷贝 mesh chunk，open() 已校验过范围，不会失败
+    void load_mesh(uint32_t mesh, MeshInfo& out) const;
+
+    MappedFile file_;
+    SceneData metadata_;
+
+    std::vector<TiledMeshInfo> meshes_;
+    std::vector<ChunkOffsets> chunks_;
+    std::vector<TileInfo> tiles_;
+    std::vector<uint32_t> tile_instances_;
+    std::vector<uint32_t> tile_meshes_;
+
+    std::vector<MeshSlot> slots_;
+    uint64_t budget_ = 0;
+    uint64_t resident_bytes_ = 0;
+    uint32_t resident_count_ = 0;
+    uint64_t frame_ = 0;
+
+    std::vector<uint32_t> loaded_;
+    std::vector<uint32_t> evicted_;
+    uint64_t loaded_bytes_ = 0;
+    uint32_t skipped_tiles_ = 0;
+};
+
+} // namespace truvixx
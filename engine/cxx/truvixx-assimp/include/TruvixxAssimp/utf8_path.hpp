@@ -0,0 +1,25 @@
+#pragma once
+
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+namespace truvixx
+{
+
+// C API、Assimp (aiString / IOSystem) 和场景数据中的路径都是 UTF-8；
+// Windows 上 std::filesystem::path(const char*) 与 path::string() 使用 ANSI 代码页，
+// 非 ASCII 路径会被错误解码，因此在两者之间转换时统一经由 char8_t
+
+[[nodiscard]] inline std::filesystem::path utf8_to_path(const std::string_view utf8)
+{
+    return std::filesystem::path(std::u8string_view(reinterpret_cast<const char8_t*>(utf8.data()), utf8.size()));
+}
+
+[[nodiscard]] inline std::string path_to_utf8(const std::filesystem::path& path)
+{
+    const std::u8string utf8 = path.u8string();
+    return std::string(reinterpret_cast<const char*>(utf8.data()), utf8.size());
+}
+
+} // namespace truvixx
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "TruvixxAssimp/scene_data.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace truvixx
+{
+
+/// 单个 mesh 的顶点流在 arena 中占用的字节数
+///
+/// 按 position | normal | tangent | uv 紧密排列 (SoA)，缺失的流不占空间
+[[nodiscard]] size_t packed_stream_size(uint32_t vertex_cnt, bool has_normal, bool has_tangent, bool has_uv) noexcept;
+
+/// 将 mesh 的顶点流拷贝到 dst 并改为引用 dst，同时释放 mesh 自身持有的 storage
+///
+/// dst 大小需要 >= packed_stream_size(mesh 当前的顶点数和属性)
+void pack_mesh_streams(MeshInfo& mesh, std::byte* dst);
+
+} // namespace truvixx
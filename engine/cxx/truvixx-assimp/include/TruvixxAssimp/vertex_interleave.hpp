@@ -0,0 +1,65 @@
+#pragma once
+
+#include "TruvixxAssimp/scene_data.hpp"
+#include "TruvixxAssimp/vertex_quantize.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace truvixx
+{
+
+/// 交错顶点中单个属性的存储格式
+///
+/// 每种属性只支持其中一部分：
+/// - position: Float32x3 / Float16x4 (w = 1) / Unorm16x4 (相对 mesh AABB, w = 0)
+/// - normal / tangent: Float32x3 / Snorm8x4 (w = 0) / Snorm16x2Octahedral (八面体编码)
+/// - uv: Float32x2 / Float16x2 / Unorm16x2 (相对 uv 包围盒)
+enum class VertexFormat : uint32_t
+{
+    None = 0, ///< 不输出该属性
+    Float32x2,
+    Float32x3,
+    Float16x2,
+    Float16x4,
+    Unorm16x2,
+    Unorm16x4,
+    Snorm8x4,
+    Snorm16x2Octahedral,
+};
+
+/// 交错顶点中的一个属性
+struct InterleavedAttribute
+{
+    VertexFormat format = VertexFormat::None;
+    uint32_t offset = 0; ///< 相对顶点起始的字节偏移
+};
+
+/// 调用方描述的交错顶点格式
+struct InterleavedLayout
+{
+    InterleavedAttribute position;
+    InterleavedAttribute normal;
+    InterleavedAttribute tangent;
+    InterleavedAttribute uv;
+    uint32_t stride = 0; ///< 相邻顶点之间的字节数
+};
+
+/// 格式的字节数，None 为 0
+[[nodiscard]] uint32_t vertex_format_size(VertexFormat format) noexcept;
+
+/// 检查布局：每个属性的格式对该属性可用、不越过 stride、属性之间互不重叠
+[[nodiscard]] bool is_valid_layout(const InterleavedLayout& layout) noexcept;
+
+/// 布局中是否有需要反量化参数的属性 (Unorm16 的 position / uv)
+[[nodiscard]] bool needs_quantization_params(const InterleavedLayout& layout) noexcept;
+
+/// 按交错格式写出 mesh 的所有顶点，dst 至少 vertex_cnt * stride 字节
+///
+/// 每种格式组合对应一个编译期特化的写入函数，逐顶点一次写完所有属性。
+/// mesh 缺少的属性 (没有 normal / tangent / uv) 以 0 填充
+/// @param layout 必须通过 is_valid_layout()
+/// @param params needs_quantization_params() 为 true 时使用，见 compute_quantization_params()
+void write_interleaved(const MeshInfo& mesh, const InterleavedLayout& layout, const QuantizationParams& params, std::byte* dst);
+
+} // namespace truvixx
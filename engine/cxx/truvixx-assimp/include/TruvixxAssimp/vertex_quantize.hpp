@@ -0,0 +1,94 @@
+#pragma once
+
+#include "TruvixxAssimp/scene_data.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace truvixx
+{
+
+/// 量化后每个分量的位宽对应的最大值
+inline constexpr float UNORM16_MAX = 65535.f;
+inline constexpr float SNORM16_MAX = 32767.f;
+inline constexpr float SNORM8_MAX = 127.f;
+
+/// 将 [0, 1] 的值量化为 unorm16
+[[nodiscard]] inline uint16_t to_unorm16(const float v)
+{
+    return static_cast<uint16_t>(std::lround(std::clamp(v, 0.f, 1.f) * UNORM16_MAX));
+}
+
+/// 将 [-1, 1] 的值量化为 snorm16
+[[nodiscard]] inline int16_t to_snorm16(const float v)
+{
+    return static_cast<int16_t>(std::lround(std::clamp(v, -1.f, 1.f) * SNORM16_MAX));
+}
+
+/// 将 [-1, 1] 的值量化为 snorm8
+[[nodiscard]] inline int8_t to_snorm8(const float v)
+{
+    return static_cast<int8_t>(std::lround(std::clamp(v, -1.f, 1.f) * SNORM8_MAX));
+}
+
+/// 值在 [offset, offset + scale] 中的归一化位置，scale 为 0 时返回 0
+[[nodiscard]] inline float normalize_in_range(const float v, const float offset, const float scale)
+{
+    return scale > 0.f ? (v - offset) / scale : 0.f;
+}
+
+/// 单个单位向量的八面体编码，out 为 2 个 snorm16
+inline void encode_octahedral_snorm16(const TruvixxFloat3& v, int16_t* out)
+{
+    float x = v.x;
+    float y = v.y;
+    const float z = v.z;
+
+    // 投影到八面体 |x| + |y| + |z| = 1，下半球折叠到外侧三角形
+    const float l1 = std::abs(x) + std::abs(y) + std::abs(z);
+    if (l1 > 0.f)
+    {
+        x /= l1;
+        y /= l1;
+    }
+    if (z < 0.f)
+    {
+        const float fx = (1.f - std::abs(y)) * (x >= 0.f ? 1.f : -1.f);
+        const float fy = (1.f - std::abs(x)) * (y >= 0.f ? 1.f : -1.f);
+        x = fx;
+        y = fy;
+    }
+
+    out[0] = to_snorm16(x);
+    out[1] = to_snorm16(y);
+}
+
+/// 反量化参数
+///
+/// position = position_offset + q / 65535 * position_scale (q 为 unorm16)
+/// uv       = uv_offset + q / 65535 * uv_scale             (仅 unorm16 uv)
+struct QuantizationParams
+{
+    TruvixxFloat3 position_offset = { 0.f, 0.f, 0.f }; ///< mesh AABB 最小值
+    TruvixxFloat3 position_scale = { 0.f, 0.f, 0.f };  ///< mesh AABB 尺寸
+    TruvixxFloat2 uv_offset = { 0.f, 0.f };            ///< uv 包围盒最小值
+    TruvixxFloat2 uv_scale = { 0.f, 0.f };             ///< uv 包围盒尺寸
+};
+
+/// 根据 mesh 的 position / uv 范围计算量化参数
+[[nodiscard]] QuantizationParams compute_quantization_params(const MeshInfo& mesh);
+
+/// position 量化为相对 AABB 的 unorm16，每个顶点输出 4 个分量 (w = 0)，对应 R16G16B16A16_UNORM
+void quantize_positions(const MeshInfo& mesh, const QuantizationParams& params, uint16_t* out);
+
+/// 单位向量八面体编码为 snorm16x2，对应 R16G16_SNORM
+void encode_octahedral_snorm16(const TruvixxFloat3* src, uint32_t count, int16_t* out);
+
+/// uv 转为 half2，对应 R16G16_SFLOAT
+void quantize_uvs_half(const MeshInfo& mesh, uint16_t* out);
+
+/// uv 量化为相对 uv 包围盒的 unorm16x2，对应 R16G16_UNORM
+void quantize_uvs_unorm16(const MeshInfo& mesh, const QuantizationParams& params, uint16_t* out);
+
+} // namespace truvixx
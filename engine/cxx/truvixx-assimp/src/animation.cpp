@@ -0,0 +1,333 @@
+#include "TruvixxAssimp/animation.hpp"
+#include "TruvixxAssimp/simd_kernels.hpp"
+#include "TruvixxAssimp/vertex_quantize.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace truvixx
+{
+
+namespace
+{
+
+/// 采样时刻所在的相邻两帧
+struct FrameSample
+{
+    uint32_t frame0 = 0;
+    uint32_t frame1 = 0;
+    float alpha = 0.f; ///< frame1 的权重
+};
+
+FrameSample locate_frame(const AnimationClip& clip, float time, const bool loop)
+{
+    if (clip.frame_count < 2 || !(clip.duration > 0.f))
+        return {};
+
+    if (loop)
+    {
+        time = std::fmod(time, clip.duration);
+        if (time < 0.f)
+            time += clip.duration;
+    }
+    // NaN 视为 0
+    time = time >= 0.f ? std::min(time, clip.duration) : 0.f;
+
+    const float frame = time * clip.sample_rate;
+    const uint32_t frame0 = std::min(static_cast<uint32_t>(frame), clip.frame_count - 2);
+    return { .frame0 = frame0, .frame1 = frame0 + 1, .alpha = std::clamp(frame - static_cast<float>(frame0), 0.f, 1.f) };
+}
+
+float lerp(const float a, const float b, const float t)
+{
+    return a + (b - a) * t;
+}
+
+TruvixxFloat3 lerp(const TruvixxFloat3& a, const TruvixxFloat3& b, const float t)
+{
+    return { .x = lerp(a.x, b.x, t), .y = lerp(a.y, b.y, t), .z = lerp(a.z, b.z, t) };
+}
+
+TruvixxFloat4 normalize_quat(const TruvixxFloat4& q)
+{
+    const float len_sq = q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w;
+    if (!(len_sq > 0.f))
+        return { .x = 0.f, .y = 0.f, .z = 0.f, .w = 1.f };
+    const float inv = 1.f / std::sqrt(len_sq);
+    return { .x = q.x * inv, .y = q.y * inv, .z = q.z * inv, .w = q.w * inv };
+}
+
+/// 相邻帧已在同一半球，直接线性插值后归一化
+TruvixxFloat4 nlerp(const TruvixxFloat4& a, const TruvixxFloat4& b, const float t)
+{
+    return normalize_quat({ .x = lerp(a.x, b.x, t), .y = lerp(a.y, b.y, t), .z = lerp(a.z, b.z, t), .w = lerp(a.w, b.w, t) });
+}
+
+TruvixxNodeTransform interpolate(const TruvixxNodeTransform& a, const TruvixxNodeTransform& b, const float t)
+{
+    return {
+        .translation = lerp(a.translation, b.translation, t),
+        .rotation = nlerp(a.rotation, b.rotation, t),
+        .scale = lerp(a.scale, b.scale, t),
+    };
+}
+
+float dequantize_unorm16(const uint16_t q, const float min, const float extent)
+{
+    return min + static_cast<float>(q) / UNORM16_MAX * extent;
+}
+
+TruvixxFloat4x4 identity_matrix()
+{
+    TruvixxFloat4x4 m{};
+    m.m00 = m.m11 = m.m22 = m.m33 = 1.f;
+    return m;
+}
+
+} // namespace
+
+void SkinAccumulator::add(const uint32_t joint, const float weight) noexcept
+{
+    if (!(weight > weights_.back()))
+        return;
+
+    // 插入排序，挤掉最小的一个
+    size_t slot = weights_.size() - 1;
+    while (slot > 0 && weights_[slot - 1] < weight)
+    {
+        weights_[slot] = weights_[slot - 1];
+        joints_[slot] = joints_[slot - 1];
+        --slot;
+    }
+    weights_[slot] = weight;
+    joints_[slot] = joint;
+}
+
+TruvixxSkinVertex SkinAccumulator::pack() const noexcept
+{
+    TruvixxSkinVertex result{};
+
+    float sum = 0.f;
+    for (const float w : weights_)
+        sum += w;
+    if (!(sum > 0.f))
+        return result;
+
+    int total = 0;
+    for (size_t i = 0; i < weights_.size(); ++i)
+    {
+        const long q = std::lround(weights_[i] / sum * 255.f);
+        result.joints[i] = weights_[i] > 0.f ? static_cast<unsigned char>(joints_[i]) : 0;
+        result.weights[i] = static_cast<unsigned char>(q);
+        total += static_cast<int>(q);
+    }
+
+    // 最大的权重至少为 255 / 4，吸收舍入误差后不会越界
+    result.weights[0] = static_cast<unsigned char>(result.weights[0] + (255 - total));
+    return result;
+}
+
+TruvixxTransformRange compute_transform_range(const std::span<const TruvixxNodeTransform> keys) noexcept
+{
+    TruvixxTransformRange range{};
+    if (keys.empty())
+        return range;
+
+    TruvixxFloat3 t_min = keys[0].translation;
+    TruvixxFloat3 t_max = t_min;
+    TruvixxFloat3 s_min = keys[0].scale;
+    TruvixxFloat3 s_max = s_min;
+    for (const auto& key : keys)
+    {
+        for (int c = 0; c < 3; ++c)
+        {
+            t_min.v[c] = std::min(t_min.v[c], key.translation.v[c]);
+            t_max.v[c] = std::max(t_max.v[c], key.translation.v[c]);
+            s_min.v[c] = std::min(s_min.v[c], key.scale.v[c]);
+            s_max.v[c] = std::max(s_max.v[c], key.scale.v[c]);
+        }
+    }
+
+    for (int c = 0; c < 3; ++c)
+    {
+        range.translation_min.v[c] = t_min.v[c];
+        range.translation_extent.v[c] = t_max.v[c] - t_min.v[c];
+        range.scale_min.v[c] = s_min.v[c];
+        range.scale_extent.v[c] = s_max.v[c] - s_min.v[c];
+    }
+    return range;
+}
+
+TruvixxQuantizedTransform quantize_transform(const TruvixxNodeTransform& transform, const TruvixxTransformRange& range) noexcept
+{
+    TruvixxQuantizedTransform q{};
+    for (int c = 0; c < 3; ++c)
+    {
+        q.translation[c] = to_unorm16(
+            normalize_in_range(transform.translation.v[c], range.translation_min.v[c], range.translation_extent.v[c])
+        );
+        q.scale[c] = to_unorm16(normalize_in_range(transform.scale.v[c], range.scale_min.v[c], range.scale_extent.v[c]));
+    }
+    for (int c = 0; c < 4; ++c)
+        q.rotation[c] = to_snorm16(transform.rotation.v[c]);
+    return q;
+}
+
+TruvixxNodeTransform dequantize_transform(const TruvixxQuantizedTransform& q, const TruvixxTransformRange& range) noexcept
+{
+    TruvixxNodeTransform transform{};
+    for (int c = 0; c < 3; ++c)
+    {
+        transform.translation.v[c] =
+            dequantize_unorm16(q.translation[c], range.translation_min.v[c], range.translation_extent.v[c]);
+        transform.scale.v[c] = dequantize_unorm16(q.scale[c], range.scale_min.v[c], range.scale_extent.v[c]);
+    }
+    TruvixxFloat4 rotation;
+    for (int c = 0; c < 4; ++c)
+        rotation.v[c] = static_cast<float>(q.rotation[c]) / SNORM16_MAX;
+    transform.rotation = normalize_quat(rotation);
+    return transform;
+}
+
+TruvixxFloat4x4 compose_transform(const TruvixxNodeTransform& transform) noexcept
+{
+    const float x = transform.rotation.x;
+    const float y = transform.rotation.y;
+    const float z = transform.rotation.z;
+    const float w = transform.rotation.w;
+    const TruvixxFloat3& s = transform.scale;
+    const TruvixxFloat3& t = transform.translation;
+
+    TruvixxFloat4x4 m;
+    m.m00 = (1.f - 2.f * (y * y + z * z)) * s.x;
+    m.m10 = 2.f * (x * y + z * w) * s.x;
+    m.m20 = 2.f * (x * z - y * w) * s.x;
+    m.m30 = 0.f;
+
+    m.m01 = 2.f * (x * y - z * w) * s.y;
+    m.m11 = (1.f - 2.f * (x * x + z * z)) * s.y;
+    m.m21 = 2.f * (y * z + x * w) * s.y;
+    m.m31 = 0.f;
+
+    m.m02 = 2.f * (x * z + y * w) * s.z;
+    m.m12 = 2.f * (y * z - x * w) * s.z;
+    m.m22 = (1.f - 2.f * (x * x + y * y)) * s.z;
+    m.m32 = 0.f;
+
+    m.m03 = t.x;
+    m.m13 = t.y;
+    m.m23 = t.z;
+    m.m33 = 1.f;
+    return m;
+}
+
+void sample_animation(
+    const SceneData& scene,
+    const AnimationClip& clip,
+    const float time,
+    const bool loop,
+    const std::span<TruvixxNodeTransform> out_pose
+) noexcept
+{
+    for (uint32_t i = 0; i < scene.node_count(); ++i)
+        out_pose[i] = scene.skeleton_nodes[i].rest;
+
+    if (clip.frame_count == 0)
+        return;
+
+    const FrameSample sample = locate_frame(clip, time, loop);
+    const uint64_t row0 = clip.key_offset + uint64_t{ sample.frame0 } * clip.channel_count;
+    const uint64_t row1 = clip.key_offset + uint64_t{ sample.frame1 } * clip.channel_count;
+    const uint32_t* channels = scene.animation_channels.data() + clip.channel_offset;
+
+    if (clip.quantized)
+    {
+        const TruvixxQuantizedTransform* keys = scene.animation_quantized_keys.data();
+        const TruvixxTransformRange* ranges = scene.animation_ranges.data() + clip.channel_offset;
+        for (uint32_t c = 0; c < clip.channel_count; ++c)
+        {
+            out_pose[channels[c]] = interpolate(
+                dequantize_transform(keys[row0 + c], ranges[c]), dequantize_transform(keys[row1 + c], ranges[c]), sample.alpha
+            );
+        }
+    }
+    else
+    {
+        const TruvixxNodeTransform* keys = scene.animation_keys.data();
+        for (uint32_t c = 0; c < clip.channel_count; ++c)
+            out_pose[channels[c]] = interpolate(keys[row0 + c], keys[row1 + c], sample.alpha);
+    }
+}
+
+void compute_node_matrices(
+    const SceneData& scene,
+    const std::span<const TruvixxNodeTransform> pose,
+    const std::span<TruvixxFloat4x4> out_matrices
+) noexcept
+{
+    for (uint32_t i = 0; i < scene.node_count(); ++i)
+    {
+        const uint32_t parent = scene.skeleton_nodes[i].parent;
+        const TruvixxFloat4x4 local = compose_transform(pose[i]);
+        if (parent == NO_NODE)
+        {
+            out_matrices[i] = local;
+            continue;
+        }
+
+        // 列主序 parent * local 即行主序下的 local * parent
+        multiply_4x4(local.m, out_matrices[parent].m, out_matrices[i].m);
+    }
+}
+
+void compute_skin_matrices(
+    const MeshInfo& mesh,
+    const std::span<const TruvixxFloat4x4> node_matrices,
+    const std::span<TruvixxFloat4x4> out_matrices
+) noexcept
+{
+    for (size_t j = 0; j < mesh.joint_nodes.size(); ++j)
+    {
+        const uint32_t node = mesh.joint_nodes[j];
+        if (node == NO_NODE || node >= node_matrices.size())
+        {
+            out_matrices[j] = identity_matrix();
+            continue;
+        }
+        multiply_4x4(mesh.inverse_binds[j].m, node_matrices[node].m, out_matrices[j].m);
+    }
+}
+
+void sample_morph_weights(
+    const SceneData& scene,
+    const AnimationClip& clip,
+    const float time,
+    const bool loop,
+    const uint32_t mesh_idx,
+    const std::span<float> out_weights
+) noexcept
+{
+    const MeshInfo& mesh = scene.mesh_infos[mesh_idx];
+    for (size_t i = 0; i < mesh.morph_targets.size(); ++i)
+        out_weights[i] = mesh.morph_targets[i].default_weight;
+
+    if (clip.frame_count == 0)
+        return;
+
+    for (uint32_t c = 0; c < clip.morph_channel_count; ++c)
+    {
+        const MorphChannel& channel = scene.morph_channels[clip.morph_channel_offset + c];
+        if (channel.mesh != mesh_idx)
+            continue;
+
+        const FrameSample sample = locate_frame(clip, time, loop);
+        const float* weights = scene.morph_weights.data() + clip.morph_weight_offset + channel.weight_offset;
+        const float* w0 = weights + uint64_t{ sample.frame0 } * clip.morph_weights_per_frame;
+        const float* w1 = weights + uint64_t{ sample.frame1 } * clip.morph_weights_per_frame;
+        for (uint32_t i = 0; i < channel.weight_count; ++i)
+            out_weights[i] = lerp(w0[i], w1[i], sample.alpha);
+        return;
+    }
+}
+
+} // namespace truvixx
@@ -0,0 +1,424 @@
+#include "TruvixxAssimp/animation_import.hpp"
+#include "TruvixxAssimp/animation.hpp"
+#include "TruvixxAssimp/simd_kernels.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <format>
+#include <iostream>
+
+namespace truvixx
+{
+
+namespace
+{
+
+/// 没有设置 mTicksPerSecond 时 Assimp 约定的默认值
+constexpr double DEFAULT_TICKS_PER_SECOND = 25.0;
+
+/// 单个片段的最大帧数，防止异常的 mDuration 导致巨大的分配
+constexpr uint32_t MAX_CLIP_FRAMES = 1u << 16;
+
+/// 变形偏移小于该长度时视为没有偏移
+constexpr float MORPH_DELTA_EPSILON = 1e-5f;
+
+TruvixxFloat3 to_float3(const aiVector3D& v)
+{
+    return { .x = v.x, .y = v.y, .z = v.z };
+}
+
+TruvixxFloat4 to_float4(const aiQuaternion& q)
+{
+    return { .x = q.x, .y = q.y, .z = q.z, .w = q.w };
+}
+
+TruvixxFloat3 sub(const aiVector3D& a, const aiVector3D& b)
+{
+    return { .x = a.x - b.x, .y = a.y - b.y, .z = a.z - b.z };
+}
+
+float length_sq(const TruvixxFloat3& v)
+{
+    return v.x * v.x + v.y * v.y + v.z * v.z;
+}
+
+float dot(const TruvixxFloat4& a, const TruvixxFloat4& b)
+{
+    return a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w;
+}
+
+TruvixxFloat4 negate(const TruvixxFloat4& q)
+{
+    return { .x = -q.x, .y = -q.y, .z = -q.z, .w = -q.w };
+}
+
+TruvixxFloat3 lerp(const TruvixxFloat3& a, const TruvixxFloat3& b, const float t)
+{
+    return { .x = a.x + (b.x - a.x) * t, .y = a.y + (b.y - a.y) * t, .z = a.z + (b.z - a.z) * t };
+}
+
+TruvixxFloat4 slerp(const TruvixxFloat4& a, TruvixxFloat4 b, const float t)
+{
+    float cos_theta = dot(a, b);
+    if (cos_theta < 0.f)
+    {
+        b = negate(b);
+        cos_theta = -cos_theta;
+    }
+
+    // 夹角很小时退化为线性插值
+    float wa = 1.f - t;
+    float wb = t;
+    if (cos_theta < 0.9995f)
+    {
+        const float theta = std::acos(cos_theta);
+        const float inv_sin = 1.f / std::sin(theta);
+        wa = std::sin((1.f - t) * theta) * inv_sin;
+        wb = std::sin(t * theta) * inv_sin;
+    }
+
+    TruvixxFloat4 r = { .x = a.x * wa + b.x * wb, .y = a.y * wa + b.y * wb, .z = a.z * wa + b.z * wb, .w = a.w * wa + b.w * wb };
+    const float len = std::sqrt(dot(r, r));
+    if (len > 0.f)
+    {
+        for (float& c : r.v)
+            c /= len;
+    }
+    return r;
+}
+
+/// 按时间递增访问一组关键帧，cursor 只前进不后退
+/// @return 插值区间的两个关键帧下标和 t；时间在范围之外时两个下标相同
+template <typename Key>
+std::pair<uint32_t, uint32_t> locate_key(const Key* keys, const uint32_t count, const double time, uint32_t& cursor, float& t)
+{
+    while (cursor + 1 < count && keys[cursor + 1].mTime <= time)
+        ++cursor;
+
+    t = 0.f;
+    if (cursor + 1 >= count || time <= keys[cursor].mTime)
+        return { cursor, cursor };
+
+    const double span = keys[cursor + 1].mTime - keys[cursor].mTime;
+    t = span > 0.0 ? static_cast<float>((time - keys[cursor].mTime) / span) : 0.f;
+    return { cursor, cursor + 1 };
+}
+
+/// 一个节点通道重采样为 frame_count 帧，缺少的分量使用 rest
+void resample_channel(
+    const aiNodeAnim* channel,
+    const TruvixxNodeTransform& rest,
+    const double ticks_per_frame,
+    std::span<TruvixxNodeTransform> out_frames
+)
+{
+    uint32_t position_cursor = 0;
+    uint32_t rotation_cursor = 0;
+    uint32_t scale_cursor = 0;
+    for (size_t f = 0; f < out_frames.size(); ++f)
+    {
+        const double time = static_cast<double>(f) * ticks_per_frame;
+        TruvixxNodeTransform& out = out_frames[f];
+        out = rest;
+        float t = 0.f;
+
+        if (channel->mNumPositionKeys > 0)
+        {
+            const auto [k0, k1] = locate_key(channel->mPositionKeys, channel->mNumPositionKeys, time, position_cursor, t);
+            out.translation = lerp(to_float3(channel->mPositionKeys[k0].mValue), to_float3(channel->mPositionKeys[k1].mValue), t);
+        }
+        if (channel->mNumRotationKeys > 0)
+        {
+            const auto [k0, k1] = locate_key(channel->mRotationKeys, channel->mNumRotationKeys, time, rotation_cursor, t);
+            out.rotation = slerp(to_float4(channel->mRotationKeys[k0].mValue), to_float4(channel->mRotationKeys[k1].mValue), t);
+        }
+        if (channel->mNumScalingKeys > 0)
+        {
+            const auto [k0, k1] = locate_key(channel->mScalingKeys, channel->mNumScalingKeys, time, scale_cursor, t);
+            out.scale = lerp(to_float3(channel->mScalingKeys[k0].mValue), to_float3(channel->mScalingKeys[k1].mValue), t);
+        }
+
+        // 与前一帧保持在同一半球，运行时相邻帧之间的 nlerp 总是走短路径
+        if (f > 0 && dot(out.rotation, out_frames[f - 1].rotation) < 0.f)
+            out.rotation = negate(out.rotation);
+    }
+}
+
+/// 变形关键帧展开为稠密权重，未出现的目标为 0
+void expand_morph_key(const aiMeshMorphKey& key, const std::span<float> out_weights)
+{
+    std::ranges::fill(out_weights, 0.f);
+    for (unsigned int i = 0; i < key.mNumValuesAndWeights; ++i)
+    {
+        if (key.mValues[i] < out_weights.size())
+            out_weights[key.mValues[i]] = static_cast<float>(key.mWeights[i]);
+    }
+}
+
+/// 一个变形通道重采样，写入每帧权重的 [weight_offset, weight_offset + weight_count)
+void resample_morph_channel(
+    const aiMeshMorphAnim* channel,
+    const MorphChannel& target,
+    const double ticks_per_frame,
+    const uint32_t frame_count,
+    const uint32_t weights_per_frame,
+    float* out_weights
+)
+{
+    if (channel->mNumKeys == 0)
+        return;
+
+    std::vector<float> w0(target.weight_count);
+    std::vector<float> w1(target.weight_count);
+    uint32_t cursor = 0;
+    for (uint32_t f = 0; f < frame_count; ++f)
+    {
+        float t = 0.f;
+        const auto [k0, k1] = locate_key(channel->mKeys, channel->mNumKeys, static_cast<double>(f) * ticks_per_frame, cursor, t);
+        expand_morph_key(channel->mKeys[k0], w0);
+        expand_morph_key(channel->mKeys[k1], w1);
+
+        float* dst = out_weights + static_cast<size_t>(f) * weights_per_frame + target.weight_offset;
+        for (uint32_t i = 0; i < target.weight_count; ++i)
+            dst[i] = w0[i] + (w1[i] - w0[i]) * t;
+    }
+}
+
+} // namespace
+
+uint32_t NodeLookup::find(const std::string_view name) const noexcept
+{
+    const auto it = index_of_name.find(name);
+    return it == index_of_name.end() ? NO_NODE : it->second;
+}
+
+NodeLookup import_skeleton(const aiNode* root, SceneData& scene)
+{
+    NodeLookup lookup;
+    if (!root)
+        return lookup;
+
+    // 层序遍历，与 SceneImporter::process_nodes() 一致
+    std::deque<std::pair<const aiNode*, uint32_t>> queue;
+    queue.emplace_back(root, NO_NODE);
+    while (!queue.empty())
+    {
+        const auto [node, parent] = queue.front();
+        queue.pop_front();
+
+        const auto index = static_cast<uint32_t>(scene.skeleton_nodes.size());
+        const std::string_view name(node->mName.C_Str(), node->mName.length);
+        lookup.nodes.push_back(node);
+        lookup.index_of_name.try_emplace(name, index);
+
+        aiVector3D scale;
+        aiQuaternion rotation;
+        aiVector3D translation;
+        node->mTransformation.Decompose(scale, rotation, translation);
+
+        SkeletonNode& out = scene.skeleton_nodes.emplace_back();
+        out.name = scene.strings.intern(name);
+        out.parent = parent;
+        out.rest = { .translation = to_float3(translation), .rotation = to_float4(rotation), .scale = to_float3(scale) };
+
+        for (unsigned int i = 0; i < node->mNumChildren; ++i)
+            queue.emplace_back(node->mChildren[i], index);
+    }
+    return lookup;
+}
+
+void import_skin(const aiMesh* mesh, const NodeLookup& lookup, MeshInfo& out_mesh)
+{
+    if (!mesh->HasBones())
+        return;
+
+    const uint32_t joint_count = std::min(mesh->mNumBones, MAX_SKIN_JOINTS);
+    if (mesh->mNumBones > MAX_SKIN_JOINTS)
+    {
+        std::cerr << std::format(
+            "Mesh {} has {} bones, bones beyond {} are dropped", mesh->mName.C_Str(), mesh->mNumBones, MAX_SKIN_JOINTS
+        ) << "\n";
+    }
+
+    out_mesh.joint_nodes.resize(joint_count);
+    out_mesh.inverse_binds.resize(joint_count);
+    std::vector<SkinAccumulator> influences(mesh->mNumVertices);
+    for (uint32_t j = 0; j < joint_count; ++j)
+    {
+        const aiBone* bone = mesh->mBones[j];
+        out_mesh.joint_nodes[j] = lookup.find({ bone->mName.C_Str(), bone->mName.length });
+
+        // Assimp 行主序 -> 列主序
+        transpose_4x4(&bone->mOffsetMatrix.a1, out_mesh.inverse_binds[j].m);
+
+        for (unsigned int w = 0; w < bone->mNumWeights; ++w)
+        {
+            const aiVertexWeight& weight = bone->mWeights[w];
+            if (weight.mVertexId < mesh->mNumVertices)
+                influences[weight.mVertexId].add(j, weight.mWeight);
+        }
+    }
+
+    out_mesh.skin.resize(mesh->mNumVertices);
+    for (unsigned int v = 0; v < mesh->mNumVertices; ++v)
+        out_mesh.skin[v] = influences[v].pack();
+}
+
+void import_morph_targets(const aiMesh* mesh, MeshInfo& out_mesh)
+{
+    if (mesh->mNumAnimMeshes == 0)
+        return;
+
+    const bool has_normal = out_mesh.normals && mesh->HasNormals();
+    constexpr float epsilon_sq = MORPH_DELTA_EPSILON * MORPH_DELTA_EPSILON;
+
+    // 目标下标与 aiAnimMesh 下标保持一致 (变形动画按下标引用)，无效的目标保留为空
+    out_mesh.morph_targets.resize(mesh->mNumAnimMeshes);
+    for (unsigned int i = 0; i < mesh->mNumAnimMeshes; ++i)
+    {
+        const aiAnimMesh* anim = mesh->mAnimMeshes[i];
+        MorphTarget& target = out_mesh.morph_targets[i];
+        target.delta_offset = static_cast<uint32_t>(out_mesh.morph_deltas.size());
+        target.default_weight = anim->mWeight;
+        if (!anim->HasPositions() || anim->mNumVertices != mesh->mNumVertices)
+            continue;
+
+        const bool anim_normal = has_normal && anim->HasNormals();
+        for (unsigned int v = 0; v < mesh->mNumVertices; ++v)
+        {
+            TruvixxMorphDelta delta{ .vertex = v, .position = sub(anim->mVertices[v], mesh->mVertices[v]), .normal = {} };
+            if (anim_normal)
+                delta.normal = sub(anim->mNormals[v], mesh->mNormals[v]);
+            if (length_sq(delta.position) > epsilon_sq || length_sq(delta.normal) > epsilon_sq)
+                out_mesh.morph_deltas.push_back(delta);
+        }
+        target.delta_count = static_cast<uint32_t>(out_mesh.morph_deltas.size()) - target.delta_offset;
+    }
+}
+
+void import_animations(
+    const aiScene* ai_scene,
+    const NodeLookup& lookup,
+    const std::span<const uint32_t> output_of_source,
+    const AnimationImportSettings& settings,
+    SceneData& scene
+)
+{
+    const float sample_rate = settings.sample_rate > 0.f ? settings.sample_rate : 30.f;
+
+    std::vector<TruvixxNodeTransform> track;
+    std::vector<uint8_t> node_used(scene.node_count());
+    for (unsigned int a = 0; a < ai_scene->mNumAnimations; ++a)
+    {
+        const aiAnimation* anim = ai_scene->mAnimations[a];
+        const double ticks_per_second = anim->mTicksPerSecond > 0.0 ? anim->mTicksPerSecond : DEFAULT_TICKS_PER_SECOND;
+        const double duration = std::max(anim->mDuration, 0.0) / ticks_per_second;
+
+        AnimationClip clip;
+        clip.name = scene.strings.intern({ anim->mName.C_Str(), anim->mName.length });
+        clip.duration = static_cast<float>(duration);
+        clip.quantized = settings.quantize;
+
+        // 帧数向上取整，实际帧率略高于目标帧率，保证最后一帧正好落在片段末尾
+        const double frames = std::ceil(duration * sample_rate);
+        clip.frame_count = duration > 0.0 ? static_cast<uint32_t>(std::min<double>(frames, MAX_CLIP_FRAMES - 1)) + 1 : 1;
+        clip.sample_rate = clip.frame_count > 1 ? static_cast<float>((clip.frame_count - 1) / duration) : 0.f;
+        const double ticks_per_frame = clip.frame_count > 1 ? anim->mDuration / (clip.frame_count - 1) : 0.0;
+
+        // 节点通道：找不到节点或重复的通道跳过
+        std::ranges::fill(node_used, 0);
+        std::vector<const aiNodeAnim*> channels;
+        clip.channel_offset = static_cast<uint32_t>(scene.animation_channels.size());
+        for (unsigned int c = 0; c < anim->mNumChannels; ++c)
+        {
+            const aiNodeAnim* channel = anim->mChannels[c];
+            const uint32_t node = lookup.find({ channel->mNodeName.C_Str(), channel->mNodeName.length });
+            if (node == NO_NODE || node_used[node])
+                continue;
+            node_used[node] = 1;
+            channels.push_back(channel);
+            scene.animation_channels.push_back(node);
+        }
+        clip.channel_count = static_cast<uint32_t>(channels.size());
+
+        // 逐通道重采样后按 [帧][通道] 交织
+        const size_t key_count = static_cast<size_t>(clip.frame_count) * clip.channel_count;
+        clip.key_offset = settings.quantize ? scene.animation_quantized_keys.size() : scene.animation_keys.size();
+        if (settings.quantize)
+            scene.animation_quantized_keys.resize(clip.key_offset + key_count);
+        else
+            scene.animation_keys.resize(clip.key_offset + key_count);
+
+        track.resize(clip.frame_count);
+        for (uint32_t c = 0; c < clip.channel_count; ++c)
+        {
+            const uint32_t node = scene.animation_channels[clip.channel_offset + c];
+            resample_channel(channels[c], scene.skeleton_nodes[node].rest, ticks_per_frame, track);
+
+            if (settings.quantize)
+            {
+                const TruvixxTransformRange range = compute_transform_range(track);
+                scene.animation_ranges.push_back(range);
+                for (uint32_t f = 0; f < clip.frame_count; ++f)
+                {
+                    scene.animation_quantized_keys[clip.key_offset + static_cast<size_t>(f) * clip.channel_count + c] =
+                        quantize_transform(track[f], range);
+                }
+            }
+            else
+            {
+                for (uint32_t f = 0; f < clip.frame_count; ++f)
+                    scene.animation_keys[clip.key_offset + static_cast<size_t>(f) * clip.channel_count + c] = track[f];
+            }
+        }
+
+        // 变形通道：节点引用的每个带变形目标的 mesh 各对应一个
+        std::vector<std::pair<const aiMeshMorphAnim*, MorphChannel>> morph_channels;
+        for (unsigned int c = 0; c < anim->mNumMorphMeshChannels; ++c)
+        {
+            const aiMeshMorphAnim* channel = anim->mMorphMeshChannels[c];
+            const uint32_t node = lookup.find({ channel->mName.C_Str(), channel->mName.length });
+            if (node == NO_NODE)
+                continue;
+
+            const aiNode* ai_node = lookup.nodes[node];
+            for (unsigned int m = 0; m < ai_node->mNumMeshes; ++m)
+            {
+                const uint32_t mesh_idx = output_of_source[ai_node->mMeshes[m]];
+                if (mesh_idx == UINT32_MAX)
+                    continue;
+                const auto target_count = static_cast<uint32_t>(scene.mesh_infos[mesh_idx].morph_targets.size());
+                if (target_count == 0)
+                    continue;
+
+                morph_channels.emplace_back(
+                    channel,
+                    MorphChannel{ .mesh = mesh_idx, .weight_offset = clip.morph_weights_per_frame, .weight_count = target_count }
+                );
+                clip.morph_weights_per_frame += target_count;
+            }
+        }
+
+        clip.morph_channel_offset = static_cast<uint32_t>(scene.morph_channels.size());
+        clip.morph_channel_count = static_cast<uint32_t>(morph_channels.size());
+        clip.morph_weight_offset = scene.morph_weights.size();
+        scene.morph_weights.resize(clip.morph_weight_offset + static_cast<size_t>(clip.frame_count) * clip.morph_weights_per_frame);
+        for (const auto& [channel, target] : morph_channels)
+        {
+            scene.morph_channels.push_back(target);
+            resample_morph_channel(
+                channel,
+                target,
+                ticks_per_frame,
+                clip.frame_count,
+                clip.morph_weights_per_frame,
+                scene.morph_weights.data() + clip.morph_weight_offset
+            );
+        }
+
+        scene.animations.push_back(clip);
+    }
+}
+
+} // namespace truvixx
@@ -24,3 +24,43 @@ static_assert(
     sizeof(TruvixxFloat2) == sizeof(float) * 2 && alignof(TruvixxFloat2) == sizeof(float),
     "TruvixxFloat2 size mismatch"
 );
+
+static_assert(
+    sizeof(TruvixxMeshlet) == sizeof(unsigned int) * 4 && alignof(TruvixxMeshlet) == sizeof(unsigned int),
+    "TruvixxMeshlet size mismatch"
+);
+
+static_assert(
+    sizeof(TruvixxAabb) == sizeof(float) * 6 && alignof(TruvixxAabb) == sizeof(float),
+    "TruvixxAabb size mismatch"
+);
+
+static_assert(
+    sizeof(TruvixxInstanceBatch) == sizeof(unsigned int) * 4 && alignof(TruvixxInstanceBatch) == sizeof(unsigned int),
+    "TruvixxInstanceBatch size mismatch"
+);
+
+static_assert(
+    sizeof(TruvixxSkinVertex) == 8 && alignof(TruvixxSkinVertex) == 1,
+    "TruvixxSkinVertex size mismatch"
+);
+
+static_assert(
+    sizeof(TruvixxMorphDelta) == sizeof(float) * 7 && alignof(TruvixxMorphDelta) == sizeof(float),
+    "TruvixxMorphDelta size mismatch"
+);
+
+static_assert(
+    sizeof(TruvixxNodeTransform) == sizeof(float) * 10 && alignof(TruvixxNodeTransform) == sizeof(float),
+    "TruvixxNodeTransform size mismatch"
+);
+
+static_assert(
+    sizeof(TruvixxQuantizedTransform) == sizeof(unsigned short) * 10 && alignof(TruvixxQuantizedTransform) == sizeof(unsigned short),
+    "TruvixxQuantizedTransform size mismatch"
+);
+
+static_assert(
+    sizeof(TruvixxTransformRange) == sizeof(float) * 12 && alignof(TruvixxTransformRange) == sizeof(float),
+    "TruvixxTransformRange size mismatch"
+);
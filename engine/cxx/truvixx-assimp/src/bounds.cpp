@@ -0,0 +1,66 @@
+#include "TruvixxAssimp/bounds.hpp"
+#include "TruvixxAssimp/simd_kernels.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace truvixx
+{
+
+TruvixxAabb empty_aabb() noexcept
+{
+    constexpr float inf = std::numeric_limits<float>::infinity();
+    return { .min = { inf, inf, inf }, .max = { -inf, -inf, -inf } };
+}
+
+bool is_empty(const TruvixxAabb& aabb) noexcept
+{
+    return aabb.min.x > aabb.max.x || aabb.min.y > aabb.max.y || aabb.min.z > aabb.max.z;
+}
+
+TruvixxAabb compute_aabb(const TruvixxFloat3* positions, const uint32_t count) noexcept
+{
+    TruvixxAabb result = empty_aabb();
+    if (!positions || count == 0)
+        return result;
+
+    min_max_float3(positions, count, result.min, result.max);
+    return result;
+}
+
+TruvixxAabb transform_aabb(const TruvixxAabb& aabb, const TruvixxFloat4x4& transform) noexcept
+{
+    if (is_empty(aabb))
+        return aabb;
+
+    // Arvo: 每个输出分量 = 平移 + sum(矩阵元素 * 对应输入分量的 min 或 max)
+    TruvixxAabb result;
+    for (int r = 0; r < 3; ++r)
+    {
+        float lo = transform.m[12 + r];
+        float hi = lo;
+        for (int c = 0; c < 3; ++c)
+        {
+            const float a = transform.m[c * 4 + r] * aabb.min.v[c];
+            const float b = transform.m[c * 4 + r] * aabb.max.v[c];
+            lo += std::min(a, b);
+            hi += std::max(a, b);
+        }
+        result.min.v[r] = lo;
+        result.max.v[r] = hi;
+    }
+    return result;
+}
+
+TruvixxAabb merge_aabb(const TruvixxAabb& a, const TruvixxAabb& b) noexcept
+{
+    TruvixxAabb result;
+    for (int c = 0; c < 3; ++c)
+    {
+        result.min.v[c] = std::min(a.min.v[c], b.min.v[c]);
+        result.max.v[c] = std::max(a.max.v[c], b.max.v[c]);
+    }
+    return result;
+}
+
+} // namespace truvixx
@@ -0,0 +1,130 @@
+#include "TruvixxAssimp/cache_io.hpp"
+
+#include <algorithm>
+
+namespace truvixx
+{
+
+CachedString to_cached(const StringRef ref)
+{
+    return CachedString{ .offset = ref.offset, .length = ref.length };
+}
+
+bool from_cached(const StringTable& strings, const CachedString& str, StringRef& out)
+{
+    if (str.offset > UINT32_MAX || str.length > UINT32_MAX)
+        return false;
+    out = StringRef{ .offset = static_cast<uint32_t>(str.offset), .length = static_cast<uint32_t>(str.length) };
+    return strings.is_valid(out);
+}
+
+CachedMaterial to_cached(const MaterialData& mat)
+{
+    CachedMaterial cached{
+        .base_color = mat.base_color,
+        .emissive = mat.emissive,
+        .roughness = mat.roughness,
+        .metallic = mat.metallic,
+        .opacity = mat.opacity,
+        ._pad0 = 0.f,
+        .name = to_cached(mat.name),
+        .diffuse_map = to_cached(mat.diffuse_map),
+        .normal_map = to_cached(mat.normal_map),
+        .textures = {},
+        ._pad1 = {},
+    };
+    std::ranges::copy(mat.textures, cached.textures);
+    return cached;
+}
+
+bool from_cached(const StringTable& strings, const CachedMaterial& cached, const uint32_t texture_count, MaterialData& out)
+{
+    out.base_color = cached.base_color;
+    out.emissive = cached.emissive;
+    out.roughness = cached.roughness;
+    out.metallic = cached.metallic;
+    out.opacity = cached.opacity;
+
+    if (!from_cached(strings, cached.name, out.name) || !from_cached(strings, cached.diffuse_map, out.diffuse_map) ||
+        !from_cached(strings, cached.normal_map, out.normal_map))
+        return false;
+
+    for (size_t slot = 0; slot < TEXTURE_SLOT_COUNT; ++slot)
+    {
+        if (cached.textures[slot] != NO_TEXTURE && cached.textures[slot] >= texture_count)
+            return false;
+        out.textures[slot] = cached.textures[slot];
+    }
+    return true;
+}
+
+CachedTexture to_cached(const TextureData& texture, const uint64_t data_offset)
+{
+    return CachedTexture{
+        .path = to_cached(texture.path),
+        .format_hint = to_cached(texture.format_hint),
+        .data_offset = data_offset,
+        .size = texture.size,
+        .hash = texture.hash,
+        .width = texture.width,
+        .height = texture.height,
+        .embedded = texture.embedded,
+        ._pad0 = 0,
+    };
+}
+
+bool from_cached(const CacheView& view, const StringTable& strings, const CachedTexture& cached, TextureData& out)
+{
+    out.size = cached.size;
+    out.hash = cached.hash;
+    out.width = cached.width;
+    out.height = cached.height;
+    out.embedded = cached.embedded != 0;
+    if (!from_cached(strings, cached.path, out.path) || !from_cached(strings, cached.format_hint, out.format_hint))
+        return false;
+
+    if (out.embedded)
+    {
+        out.data = view.get<std::byte>(cached.data_offset, cached.size);
+        if (!out.data)
+            return false;
+    }
+    return true;
+}
+
+CachedInstance to_cached(const InstanceData& inst)
+{
+    return CachedInstance{
+        .world_transform = inst.world_transform,
+        .name = to_cached(inst.name),
+        .refs_index = inst.ref_offset,
+        .mesh_count = inst.mesh_count(),
+        .node = inst.node,
+        .world_bounds = inst.world_bounds,
+    };
+}
+
+bool from_cached(
+    const StringTable& strings,
+    const CachedInstance& cached,
+    const uint64_t refs_size,
+    const uint32_t node_count,
+    InstanceData& out
+)
+{
+    out.world_transform = cached.world_transform;
+    if (!from_cached(strings, cached.name, out.name))
+        return false;
+
+    if (cached.refs_index > refs_size || cached.mesh_count > refs_size - cached.refs_index)
+        return false;
+    out.ref_offset = static_cast<uint32_t>(cached.refs_index);
+    out.ref_count = cached.mesh_count;
+    out.world_bounds = cached.world_bounds;
+    if (cached.node != NO_NODE && cached.node >= node_count)
+        return false;
+    out.node = cached.node;
+    return true;
+}
+
+} // namespace truvixx
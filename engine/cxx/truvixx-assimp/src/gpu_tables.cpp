@@ -0,0 +1,169 @@
+#include "TruvixxAssimp/gpu_tables.hpp"
+
+#include "TruvixxAssimp/thread_pool.hpp"
+
+#include <cmath>
+
+namespace truvixx
+{
+
+namespace
+{
+
+/// 实例数量达到该值时并行写入
+constexpr uint32_t PARALLEL_INSTANCE_THRESHOLD = 4096;
+constexpr uint32_t INSTANCE_GRAIN = 1024;
+
+uint64_t align_table(const uint64_t offset)
+{
+    return (offset + GPU_TABLE_ALIGNMENT - 1) & ~(GPU_TABLE_ALIGNMENT - 1);
+}
+
+int32_t srv_handle(const GpuTableParams& params, const uint32_t texture)
+{
+    return texture < params.texture_handles.size() ? params.texture_handles[texture] : INVALID_SRV_HANDLE;
+}
+
+TruvixxFloat3 truncate(const TruvixxFloat4& v)
+{
+    return { .x = v.x, .y = v.y, .z = v.z };
+}
+
+} // namespace
+
+GpuTableLayout compute_gpu_table_layout(const SceneData& scene) noexcept
+{
+    GpuTableLayout layout{
+        .instance_count = scene.instance_count(),
+        .material_count = scene.material_count(),
+        .geometry_count = scene.mesh_count(),
+        .ref_count = static_cast<uint32_t>(scene.instance_mesh_refs.size()),
+    };
+
+    uint64_t offset = 0;
+    const auto section = [&](const uint64_t bytes) {
+        const uint64_t section_offset = align_table(offset);
+        offset = section_offset + bytes;
+        return section_offset;
+    };
+    layout.instance_offset = section(uint64_t{ layout.instance_count } * sizeof(TruvixxGpuInstance));
+    layout.material_offset = section(uint64_t{ layout.material_count } * sizeof(TruvixxGpuMaterial));
+    layout.geometry_offset = section(uint64_t{ layout.geometry_count } * sizeof(TruvixxGpuGeometry));
+    layout.geometry_map_offset = section(uint64_t{ layout.ref_count } * sizeof(uint32_t));
+    layout.material_map_offset = section(uint64_t{ layout.ref_count } * sizeof(uint32_t));
+    layout.total_size = align_table(offset);
+    return layout;
+}
+
+TruvixxFloat4x4 inverse_matrix(const TruvixxFloat4x4& m) noexcept
+{
+    // 按 m[16] 展开，转置的逆等于逆的转置，因此与存储顺序无关
+    const float* a = m.m;
+    TruvixxFloat4x4 inv{};
+    float* r = inv.m;
+
+    r[0] = a[5] * a[10] * a[15] - a[5] * a[11] * a[14] - a[9] * a[6] * a[15] + a[9] * a[7] * a[14] +
+           a[13] * a[6] * a[11] - a[13] * a[7] * a[10];
+    r[4] = -a[4] * a[10] * a[15] + a[4] * a[11] * a[14] + a[8] * a[6] * a[15] - a[8] * a[7] * a[14] -
+           a[12] * a[6] * a[11] + a[12] * a[7] * a[10];
+    r[8] = a[4] * a[9] * a[15] - a[4] * a[11] * a[13] - a[8] * a[5] * a[15] + a[8] * a[7] * a[13] +
+           a[12] * a[5] * a[11] - a[12] * a[7] * a[9];
+    r[12] = -a[4] * a[9] * a[14] + a[4] * a[10] * a[13] + a[8] * a[5] * a[14] - a[8] * a[6] * a[13] -
+            a[12] * a[5] * a[10] + a[12] * a[6] * a[9];
+    r[1] = -a[1] * a[10] * a[15] + a[1] * a[11] * a[14] + a[9] * a[2] * a[15] - a[9] * a[3] * a[14] -
+           a[13] * a[2] * a[11] + a[13] * a[3] * a[10];
+    r[5] = a[0] * a[10] * a[15] - a[0] * a[11] * a[14] - a[8] * a[2] * a[15] + a[8] * a[3] * a[14] +
+           a[12] * a[2] * a[11] - a[12] * a[3] * a[10];
+    r[9] = -a[0] * a[9] * a[15] + a[0] * a[11] * a[13] + a[8] * a[1] * a[15] - a[8] * a[3] * a[13] -
+           a[12] * a[1] * a[11] + a[12] * a[3] * a[9];
+    r[13] = a[0] * a[9] * a[14] - a[0] * a[10] * a[13] - a[8] * a[1] * a[14] + a[8] * a[2] * a[13] +
+            a[12] * a[1] * a[10] - a[12] * a[2] * a[9];
+    r[2] = a[1] * a[6] * a[15] - a[1] * a[7] * a[14] - a[5] * a[2] * a[15] + a[5] * a[3] * a[14] +
+           a[13] * a[2] * a[7] - a[13] * a[3] * a[6];
+    r[6] = -a[0] * a[6] * a[15] + a[0] * a[7] * a[14] + a[4] * a[2] * a[15] - a[4] * a[3] * a[14] -
+           a[12] * a[2] * a[7] + a[12] * a[3] * a[6];
+    r[10] = a[0] * a[5] * a[15] - a[0] * a[7] * a[13] - a[4] * a[1] * a[15] + a[4] * a[3] * a[13] +
+            a[12] * a[1] * a[7] - a[12] * a[3] * a[5];
+    r[14] = -a[0] * a[5] * a[14] + a[0] * a[6] * a[13] + a[4] * a[1] * a[14] - a[4] * a[2] * a[13] -
+            a[12] * a[1] * a[6] + a[12] * a[2] * a[5];
+    r[3] = -a[1] * a[6] * a[11] + a[1] * a[7] * a[10] + a[5] * a[2] * a[11] - a[5] * a[3] * a[10] -
+           a[9] * a[2] * a[7] + a[9] * a[3] * a[6];
+    r[7] = a[0] * a[6] * a[11] - a[0] * a[7] * a[10] - a[4] * a[2] * a[11] + a[4] * a[3] * a[10] +
+           a[8] * a[2] * a[7] - a[8] * a[3] * a[6];
+    r[11] = -a[0] * a[5] * a[11] + a[0] * a[7] * a[9] + a[4] * a[1] * a[11] - a[4] * a[3] * a[9] -
+            a[8] * a[1] * a[7] + a[8] * a[3] * a[5];
+    r[15] = a[0] * a[5] * a[10] - a[0] * a[6] * a[9] - a[4] * a[1] * a[10] + a[4] * a[2] * a[9] +
+            a[8] * a[1] * a[6] - a[8] * a[2] * a[5];
+
+    const float det = a[0] * r[0] + a[1] * r[4] + a[2] * r[8] + a[3] * r[12];
+    if (!std::isfinite(det) || det == 0.f)
+    {
+        TruvixxFloat4x4 identity{};
+        identity.m00 = identity.m11 = identity.m22 = identity.m33 = 1.f;
+        return identity;
+    }
+
+    const float inv_det = 1.f / det;
+    for (float& v : inv.m)
+        v *= inv_det;
+    return inv;
+}
+
+void write_gpu_instances(const SceneData& scene, const GpuTableParams& params, TruvixxGpuInstance* out)
+{
+    const uint32_t count = scene.instance_count();
+    for_each_index(
+        count >= PARALLEL_INSTANCE_THRESHOLD,
+        count,
+        [&](const uint32_t inst_idx) {
+            const auto& inst = scene.instances[inst_idx];
+            out[inst_idx] = TruvixxGpuInstance{
+                .geometry_indirect_idx = params.indirect_base + inst.ref_offset,
+                .geometry_count = inst.mesh_count(),
+                .material_indirect_idx = params.indirect_base + inst.ref_offset,
+                .material_count = inst.mesh_count(),
+                .model = inst.world_transform,
+                .inv_model = inverse_matrix(inst.world_transform),
+            };
+        },
+        INSTANCE_GRAIN
+    );
+}
+
+void write_gpu_materials(const SceneData& scene, const GpuTableParams& params, TruvixxGpuMaterial* out)
+{
+    for (uint32_t mat_idx = 0; mat_idx < scene.material_count(); ++mat_idx)
+    {
+        const auto& mat = scene.materials[mat_idx];
+        out[mat_idx] = TruvixxGpuMaterial{
+            .base_color = truncate(mat.base_color),
+            .metallic = mat.metallic,
+            .emissive = truncate(mat.emissive),
+            .roughness = mat.roughness,
+            .diffuse_map = srv_handle(params, mat.texture(TextureSlot::BaseColor)),
+            .diffuse_map_sampler_type = params.sampler_type,
+            .normal_map = srv_handle(params, mat.texture(TextureSlot::Normal)),
+            .normal_map_sampler_type = params.sampler_type,
+            .opaque = mat.opacity,
+            ._padding_1 = 0.f,
+            ._padding_2 = 0.f,
+            ._padding_3 = 0.f,
+        };
+    }
+}
+
+void write_gpu_indirect_maps(
+    const SceneData& scene,
+    const GpuTableParams& params,
+    uint32_t* geometry_map,
+    uint32_t* material_map
+) noexcept
+{
+    for (size_t ref = 0; ref < scene.instance_mesh_refs.size(); ++ref)
+    {
+        geometry_map[ref] = params.geometry_base + scene.instance_mesh_refs[ref];
+        material_map[ref] = params.material_base + scene.instance_material_refs[ref];
+    }
+}
+
+} // namespace truvixx
@@ -0,0 +1,69 @@
+#include "TruvixxAssimp/instance_batch.hpp"
+
+#include <unordered_map>
+
+namespace truvixx
+{
+
+namespace
+{
+
+uint64_t batch_key(const uint32_t mesh_index, const uint32_t material_index)
+{
+    return (uint64_t{ mesh_index } << 32) | material_index;
+}
+
+} // namespace
+
+void build_instance_batches(SceneData& scene)
+{
+    scene.instance_batches.clear();
+    scene.batch_transforms.clear();
+
+    // 第一遍：确定批次并统计每个批次的实例数
+    std::unordered_map<uint64_t, uint32_t> batch_of_key;
+    std::vector<uint32_t> ref_batch(scene.instance_mesh_refs.size());
+    for (size_t r = 0; r < scene.instance_mesh_refs.size(); ++r)
+    {
+        const uint32_t mesh_index = scene.instance_mesh_refs[r];
+        const uint32_t material_index = scene.instance_material_refs[r];
+        const auto [it, inserted] = batch_of_key.try_emplace(
+            batch_key(mesh_index, material_index),
+            static_cast<uint32_t>(scene.instance_batches.size())
+        );
+        if (inserted)
+        {
+            scene.instance_batches.push_back(TruvixxInstanceBatch{
+                .mesh_index = mesh_index,
+                .material_index = material_index,
+                .transform_offset = 0,
+                .instance_count = 0,
+            });
+        }
+        ref_batch[r] = it->second;
+        ++scene.instance_batches[it->second].instance_count;
+    }
+
+    uint32_t transform_offset = 0;
+    for (auto& batch : scene.instance_batches)
+    {
+        batch.transform_offset = transform_offset;
+        transform_offset += batch.instance_count;
+    }
+
+    // 第二遍：按实例顺序填充变换，instance_count 作为游标重新累加
+    scene.batch_transforms.resize(transform_offset);
+    for (auto& batch : scene.instance_batches)
+        batch.instance_count = 0;
+
+    for (const auto& inst : scene.instances)
+    {
+        for (uint32_t r = inst.ref_offset; r < inst.ref_offset + inst.ref_count; ++r)
+        {
+            auto& batch = scene.instance_batches[ref_batch[r]];
+            scene.batch_transforms[batch.transform_offset + batch.instance_count++] = inst.world_transform;
+        }
+    }
+}
+
+} // namespace truvixx
@@ -0,0 +1,367 @@
+#include "TruvixxAssimp/instance_bvh.hpp"
+#include "TruvixxAssimp/bounds.hpp"
+#include "TruvixxAssimp/scene_data.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+namespace truvixx
+{
+
+namespace
+{
+
+/// 遍历栈的初始容量，SAH 划分不保证平衡，超过时栈自动增长
+constexpr size_t BVH_STACK_RESERVE = 64;
+
+/// 超过该深度后只做中位数划分，保证构建递归深度不超过 BVH_MAX_SAH_DEPTH + log2(N)
+constexpr uint32_t BVH_MAX_SAH_DEPTH = 32;
+
+struct BuildPrimitive
+{
+    TruvixxAabb bounds;
+    TruvixxFloat3 centroid;
+    uint32_t instance_index;
+};
+
+float surface_area(const TruvixxAabb& aabb)
+{
+    if (is_empty(aabb))
+        return 0.f;
+    const float dx = aabb.max.x - aabb.min.x;
+    const float dy = aabb.max.y - aabb.min.y;
+    const float dz = aabb.max.z - aabb.min.z;
+    return 2.f * (dx * dy + dy * dz + dz * dx);
+}
+
+bool overlaps(const TruvixxAabb& a, const TruvixxAabb& b)
+{
+    return a.min.x <= b.max.x && a.max.x >= b.min.x && a.min.y <= b.max.y && a.max.y >= b.min.y &&
+        a.min.z <= b.max.z && a.max.z >= b.min.z;
+}
+
+/// 包围盒在所有平面的内侧 (保守测试，可能把视锥外角落处的包围盒判为相交)
+bool intersects_frustum(const TruvixxAabb& aabb, const TruvixxFloat4 planes[6])
+{
+    for (int i = 0; i < 6; ++i)
+    {
+        const TruvixxFloat4& p = planes[i];
+        // 沿法线方向最远的顶点
+        const float x = p.x >= 0.f ? aabb.max.x : aabb.min.x;
+        const float y = p.y >= 0.f ? aabb.max.y : aabb.min.y;
+        const float z = p.z >= 0.f ? aabb.max.z : aabb.min.z;
+        if (p.x * x + p.y * y + p.z * z + p.w < 0.f)
+            return false;
+    }
+    return true;
+}
+
+/// slab 测试，命中时返回进入参数
+bool intersects_ray(
+    const TruvixxAabb& aabb,
+    const TruvixxFloat3& origin,
+    const TruvixxFloat3& inv_dir,
+    const float t_min,
+    const float t_max,
+    float& out_t
+)
+{
+    float t0 = t_min;
+    float t1 = t_max;
+    for (int c = 0; c < 3; ++c)
+    {
+        float near_t = (aabb.min.v[c] - origin.v[c]) * inv_dir.v[c];
+        float far_t = (aabb.max.v[c] - origin.v[c]) * inv_dir.v[c];
+        if (near_t > far_t)
+            std::swap(near_t, far_t);
+        // 射线平行于 slab 且原点在 slab 上时会出现 0 * inf = NaN，此时不收紧该分量
+        if (!std::isnan(near_t))
+            t0 = std::max(t0, near_t);
+        if (!std::isnan(far_t))
+            t1 = std::min(t1, far_t);
+        if (t0 > t1)
+            return false;
+    }
+    out_t = t0;
+    return true;
+}
+
+struct BvhBuilder
+{
+    std::vector<BuildPrimitive>& prims;
+    InstanceBvh& bvh;
+
+    void build(const uint32_t node_idx, const uint32_t begin, const uint32_t end, const uint32_t depth)
+    {
+        TruvixxAabb bounds = empty_aabb();
+        TruvixxAabb centroid_bounds = empty_aabb();
+        for (uint32_t i = begin; i < end; ++i)
+        {
+            bounds = merge_aabb(bounds, prims[i].bounds);
+            centroid_bounds = merge_aabb(centroid_bounds, { prims[i].centroid, prims[i].centroid });
+        }
+        bvh.nodes[node_idx].bounds = bounds;
+
+        const uint32_t count = end - begin;
+        int axis = 0;
+        for (int c = 1; c < 3; ++c)
+        {
+            if (centroid_bounds.max.v[c] - centroid_bounds.min.v[c] >
+                centroid_bounds.max.v[axis] - centroid_bounds.min.v[axis])
+                axis = c;
+        }
+        const float axis_min = centroid_bounds.min.v[axis];
+        const float extent = centroid_bounds.max.v[axis] - axis_min;
+
+        if (count <= BVH_MAX_LEAF_SIZE)
+        {
+            make_leaf(node_idx, begin, end);
+            return;
+        }
+
+        // 所有实例中心重合，无法按空间划分；按下标对半切分，保证叶节点大小和树深度仍然受限
+        if (extent <= 0.f)
+        {
+            emit_children(node_idx, begin, begin + count / 2, end, depth);
+            return;
+        }
+
+        if (depth >= BVH_MAX_SAH_DEPTH)
+        {
+            split(node_idx, begin, end, begin + count / 2, axis, depth);
+            return;
+        }
+
+        // 分桶统计
+        struct Bin
+        {
+            TruvixxAabb bounds = empty_aabb();
+            uint32_t count = 0;
+        };
+        std::array<Bin, BVH_BIN_COUNT> bins{};
+        auto bin_of = [&](const BuildPrimitive& prim) {
+            const auto b = static_cast<uint32_t>((prim.centroid.v[axis] - axis_min) / extent * BVH_BIN_COUNT);
+            return std::min(b, BVH_BIN_COUNT - 1);
+        };
+        for (uint32_t i = begin; i < end; ++i)
+        {
+            Bin& bin = bins[bin_of(prims[i])];
+            bin.bounds = merge_aabb(bin.bounds, prims[i].bounds);
+            ++bin.count;
+        }
+
+        // 从右向左累积，再从左向右扫描求最小 SAH 代价
+        std::array<float, BVH_BIN_COUNT> right_cost{};
+        TruvixxAabb acc = empty_aabb();
+        uint32_t acc_count = 0;
+        for (uint32_t b = BVH_BIN_COUNT - 1; b > 0; --b)
+        {
+            acc = merge_aabb(acc, bins[b].bounds);
+            acc_count += bins[b].count;
+            right_cost[b] = surface_area(acc) * static_cast<float>(acc_count);
+        }
+
+        float best_cost = std::numeric_limits<float>::infinity();
+        uint32_t best_split = 0;
+        acc = empty_aabb();
+        acc_count = 0;
+        for (uint32_t b = 0; b + 1 < BVH_BIN_COUNT; ++b)
+        {
+            acc = merge_aabb(acc, bins[b].bounds);
+            acc_count += bins[b].count;
+            if (acc_count == 0 || acc_count == count)
+                continue;
+            const float cost = surface_area(acc) * static_cast<float>(acc_count) + right_cost[b + 1];
+            if (cost < best_cost)
+            {
+                best_cost = cost;
+                best_split = b + 1;
+            }
+        }
+
+        // 代价以父节点表面积归一化：遍历代价 1 + 相交代价 1 / 实例
+        // 实例数超过 BVH_MAX_LEAF_SIZE 时不能成为叶节点，SAH 划分不比叶节点更好时退化为中位数划分
+        const float parent_area = surface_area(bounds);
+        const float leaf_cost = static_cast<float>(count);
+        const bool split_found =
+            best_split > 0 && !(parent_area > 0.f && 1.f + best_cost / parent_area >= leaf_cost);
+
+        uint32_t mid = begin;
+        if (split_found)
+        {
+            mid = static_cast<uint32_t>(
+                std::partition(
+                    prims.begin() + begin,
+                    prims.begin() + end,
+                    [&](const BuildPrimitive& prim) { return bin_of(prim) < best_split; }
+                ) -
+                prims.begin()
+            );
+        }
+        // 分桶失败时退化为中位数划分
+        if (mid == begin || mid == end)
+        {
+            split(node_idx, begin, end, begin + count / 2, axis, depth);
+            return;
+        }
+        emit_children(node_idx, begin, mid, end, depth);
+    }
+
+    /// 按 axis 上的中心做中位数划分
+    void split(
+        const uint32_t node_idx,
+        const uint32_t begin,
+        const uint32_t end,
+        const uint32_t mid,
+        const int axis,
+        const uint32_t depth
+    )
+    {
+        std::nth_element(
+            prims.begin() + begin,
+            prims.begin() + mid,
+            prims.begin() + end,
+            [&](const BuildPrimitive& a, const BuildPrimitive& b) { return a.centroid.v[axis] < b.centroid.v[axis]; }
+        );
+        emit_children(node_idx, begin, mid, end, depth);
+    }
+
+    void emit_children(
+        const uint32_t node_idx,
+        const uint32_t begin,
+        const uint32_t mid,
+        const uint32_t end,
+        const uint32_t depth
+    )
+    {
+        const auto left = static_cast<uint32_t>(bvh.nodes.size());
+        bvh.nodes.emplace_back();
+        build(left, begin, mid, depth + 1);
+
+        const auto right = static_cast<uint32_t>(bvh.nodes.size());
+        bvh.nodes.emplace_back();
+        bvh.nodes[node_idx].first = right;
+        build(right, mid, end, depth + 1);
+    }
+
+    void make_leaf(const uint32_t node_idx, const uint32_t begin, const uint32_t end)
+    {
+        BvhNode& node = bvh.nodes[node_idx];
+        node.first = static_cast<uint32_t>(bvh.instance_indices.size());
+        node.count = end - begin;
+        for (uint32_t i = begin; i < end; ++i)
+        {
+            bvh.instance_indices.push_back(prims[i].instance_index);
+            bvh.leaf_bounds.push_back(prims[i].bounds);
+        }
+    }
+};
+
+/// 深度优先遍历，test 同时用于节点和叶节点中的每个实例，visit 处理通过测试的实例
+template <typename Test, typename Visit>
+void traverse(const InstanceBvh& bvh, Test&& test, Visit&& visit)
+{
+    if (bvh.empty())
+        return;
+
+    std::vector<uint32_t> stack;
+    stack.reserve(BVH_STACK_RESERVE);
+    stack.push_back(0);
+
+    while (!stack.empty())
+    {
+        const BvhNode& node = bvh.nodes[stack.back()];
+        stack.pop_back();
+        if (!test(node.bounds))
+            continue;
+
+        if (node.is_leaf())
+        {
+            for (uint32_t i = node.first; i < node.first + node.count; ++i)
+            {
+                if (test(bvh.leaf_bounds[i]))
+                    visit(bvh.instance_indices[i]);
+            }
+            continue;
+        }
+
+        const auto node_idx = static_cast<uint32_t>(&node - bvh.nodes.data());
+        stack.push_back(node.first);
+        stack.push_back(node_idx + 1);
+    }
+}
+
+} // namespace
+
+void build_instance_bvh(SceneData& scene)
+{
+    scene.instance_bvh = {};
+
+    std::vector<BuildPrimitive> prims;
+    prims.reserve(scene.instances.size());
+    for (uint32_t i = 0; i < scene.instance_count(); ++i)
+    {
+        const TruvixxAabb& bounds = scene.instances[i].world_bounds;
+        if (is_empty(bounds))
+            continue;
+
+        TruvixxFloat3 centroid;
+        for (int c = 0; c < 3; ++c)
+            centroid.v[c] = 0.5f * (bounds.min.v[c] + bounds.max.v[c]);
+        prims.push_back({ .bounds = bounds, .centroid = centroid, .instance_index = i });
+    }
+    if (prims.empty())
+        return;
+
+    auto& bvh = scene.instance_bvh;
+    bvh.nodes.reserve(prims.size() * 2 - 1);
+    bvh.instance_indices.reserve(prims.size());
+    bvh.leaf_bounds.reserve(prims.size());
+    bvh.nodes.emplace_back();
+
+    BvhBuilder builder{ .prims = prims, .bvh = bvh };
+    builder.build(0, 0, static_cast<uint32_t>(prims.size()), 0);
+}
+
+void query_aabb(const InstanceBvh& bvh, const TruvixxAabb& box, std::vector<uint32_t>& out)
+{
+    traverse(
+        bvh,
+        [&](const TruvixxAabb& bounds) { return overlaps(bounds, box); },
+        [&](const uint32_t instance_index) { out.push_back(instance_index); }
+    );
+}
+
+void query_frustum(const InstanceBvh& bvh, const TruvixxFloat4 planes[6], std::vector<uint32_t>& out)
+{
+    traverse(
+        bvh,
+        [&](const TruvixxAabb& bounds) { return intersects_frustum(bounds, planes); },
+        [&](const uint32_t instance_index) { out.push_back(instance_index); }
+    );
+}
+
+void query_ray(const InstanceBvh& bvh, const BvhRay& ray, std::vector<BvhRayHit>& out)
+{
+    TruvixxFloat3 inv_dir;
+    for (int c = 0; c < 3; ++c)
+        inv_dir.v[c] = 1.f / ray.direction.v[c];
+
+    // 最后一次测试的进入参数，visit 紧跟在实例自身的测试之后调用
+    float t = 0.f;
+    const size_t first_hit = out.size();
+    traverse(
+        bvh,
+        [&](const TruvixxAabb& bounds) { return intersects_ray(bounds, ray.origin, inv_dir, ray.t_min, ray.t_max, t); },
+        [&](const uint32_t instance_index) { out.push_back({ .instance_index = instance_index, .t = t }); }
+    );
+
+    std::sort(out.begin() + static_cast<std::ptrdiff_t>(first_hit), out.end(), [](const BvhRayHit& a, const BvhRayHit& b) {
+        return a.t < b.t;
+    });
+}
+
+} // namespace truvixx
@@ -0,0 +1,135 @@
+#include "TruvixxAssimp/load_stats.hpp"
+
+#include <atomic>
+
+namespace truvixx
+{
+
+namespace
+{
+
+template <typename T>
+uint64_t capacity_bytes(const std::vector<T>& v)
+{
+    return static_cast<uint64_t>(v.capacity()) * sizeof(T);
+}
+
+uint64_t mesh_bytes(const MeshInfo& mesh)
+{
+    const MeshletData& m = mesh.meshlets;
+    return capacity_bytes(mesh.vertex_storage) + capacity_bytes(mesh.uv_storage) + capacity_bytes(mesh.indices) +
+        capacity_bytes(mesh.indices16) + capacity_bytes(mesh.lods) + capacity_bytes(m.meshlets) +
+        capacity_bytes(m.vertices) + capacity_bytes(m.triangles) + capacity_bytes(m.spheres) +
+        capacity_bytes(m.cones) + capacity_bytes(m.cone_apexes) + capacity_bytes(mesh.skin) +
+        capacity_bytes(mesh.joint_nodes) + capacity_bytes(mesh.inverse_binds) + capacity_bytes(mesh.morph_targets) +
+        capacity_bytes(mesh.morph_deltas);
+}
+
+} // namespace
+
+const char* load_phase_name(const LoadPhase phase) noexcept
+{
+    switch (phase)
+    {
+    case LoadPhase::CacheRead:
+        return "truvixx::cache_read";
+    case LoadPhase::Parse:
+        return "truvixx::parse";
+    case LoadPhase::PostProcess:
+        return "truvixx::post_process";
+    case LoadPhase::Materials:
+        return "truvixx::materials";
+    case LoadPhase::Textures:
+        return "truvixx::textures";
+    case LoadPhase::Meshes:
+        return "truvixx::meshes";
+    case LoadPhase::Nodes:
+        return "truvixx::nodes";
+    case LoadPhase::InstanceBatches:
+        return "truvixx::instance_batches";
+    case LoadPhase::InstanceBvh:
+        return "truvixx::instance_bvh";
+    case LoadPhase::CacheWrite:
+        return "truvixx::cache_write";
+    case LoadPhase::MeshConvert:
+        return "truvixx::mesh_convert";
+    case LoadPhase::MeshOptimize:
+        return "truvixx::mesh_optimize";
+    case LoadPhase::MeshMeshlets:
+        return "truvixx::mesh_meshlets";
+    case LoadPhase::MeshLods:
+        return "truvixx::mesh_lods";
+    case LoadPhase::MeshCompactIndex:
+        return "truvixx::mesh_compact_index";
+    case LoadPhase::MeshPack:
+        return "truvixx::mesh_pack";
+    case LoadPhase::Animations:
+        return "truvixx::animations";
+    case LoadPhase::MeshValidate:
+        return "truvixx::mesh_validate";
+    case LoadPhase::Count:
+        break;
+    }
+    return "truvixx::unknown";
+}
+
+void collect_scene_counters(const SceneData& scene, LoadStats& stats)
+{
+    stats.mesh_count = scene.mesh_count();
+    stats.material_count = scene.material_count();
+    stats.instance_count = scene.instance_count();
+    stats.texture_count = scene.texture_count();
+    stats.embedded_texture_count = 0;
+    for (const auto& texture : scene.textures)
+        stats.embedded_texture_count += texture.embedded;
+
+    stats.meshlet_count = 0;
+    stats.vertex_count = 0;
+    stats.index_count = 0;
+    stats.repaired_mesh_count = 0;
+    stats.removed_triangle_count = 0;
+    uint64_t bytes = scene.vertex_arena_size + scene.texture_arena_size;
+    for (const auto& mesh : scene.mesh_infos)
+    {
+        stats.meshlet_count += mesh.meshlets.count();
+        stats.vertex_count += mesh.vertex_cnt;
+        stats.index_count += mesh.total_index_count();
+        stats.repaired_mesh_count += mesh.validation.modified();
+        stats.removed_triangle_count += mesh.validation.removed_triangles();
+        bytes += mesh_bytes(mesh);
+    }
+
+    bytes += capacity_bytes(scene.mesh_infos) + capacity_bytes(scene.materials) + capacity_bytes(scene.instances) +
+        capacity_bytes(scene.textures) +
+        capacity_bytes(scene.instance_mesh_refs) + capacity_bytes(scene.instance_material_refs) +
+        scene.strings.size() + capacity_bytes(scene.instance_bvh.nodes) +
+        capacity_bytes(scene.instance_bvh.instance_indices) + capacity_bytes(scene.instance_bvh.leaf_bounds) +
+        capacity_bytes(scene.instance_batches) + capacity_bytes(scene.batch_transforms) +
+        capacity_bytes(scene.skeleton_nodes) + capacity_bytes(scene.animations) +
+        capacity_bytes(scene.animation_channels) + capacity_bytes(scene.animation_keys) +
+        capacity_bytes(scene.animation_quantized_keys) + capacity_bytes(scene.animation_ranges) +
+        capacity_bytes(scene.morph_channels) + capacity_bytes(scene.morph_weights);
+    stats.scene_bytes = bytes;
+}
+
+LoadZone::LoadZone(LoadStats& stats, const LoadPhase phase, const ProfileZoneHook& hook)
+    : stats_(stats)
+    , hook_(hook)
+    , phase_(phase)
+    , start_(std::chrono::steady_clock::now())
+{
+    if (hook_)
+        hook_(load_phase_name(phase_), true);
+}
+
+LoadZone::~LoadZone()
+{
+    const auto elapsed = std::chrono::steady_clock::now() - start_;
+    const auto ns = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    std::atomic_ref(stats_.phase_ns[static_cast<size_t>(phase_)]).fetch_add(ns, std::memory_order_relaxed);
+
+    if (hook_)
+        hook_(load_phase_name(phase_), false);
+}
+
+} // namespace truvixx
@@ -0,0 +1,115 @@
+#include "TruvixxAssimp/mapped_io_system.hpp"
+#include "TruvixxAssimp/utf8_path.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string_view>
+#include <system_error>
+#include <utility>
+
+namespace truvixx
+{
+
+size_t MappedIOStream::Read(void* buffer, const size_t size, const size_t count)
+{
+    if (size == 0 || count == 0)
+        return 0;
+
+    const size_t readable = std::min(count, (file_.size() - pos_) / size);
+    std::memcpy(buffer, file_.data() + pos_, readable * size);
+    pos_ += readable * size;
+    return readable;
+}
+
+size_t MappedIOStream::Write(const void* /*buffer*/, const size_t /*size*/, const size_t /*count*/)
+{
+    return 0;
+}
+
+aiReturn MappedIOStream::Seek(const size_t offset, const aiOrigin origin)
+{
+    size_t target;
+    switch (origin)
+    {
+    case aiOrigin_SET:
+        target = offset;
+        break;
+    case aiOrigin_CUR:
+        // 向前 seek 时 offset 是负数转换来的，无符号回绕后结果正确，越界由下面统一检查
+        target = pos_ + offset;
+        break;
+    case aiOrigin_END:
+        // 与 DefaultIOStream (fseek SEEK_END) 一致: offset 加到文件末尾上，向前 seek 时同样依赖无符号回绕
+        target = file_.size() + offset;
+        break;
+    default:
+        return aiReturn_FAILURE;
+    }
+
+    if (target > file_.size())
+        return aiReturn_FAILURE;
+    pos_ = target;
+    return aiReturn_SUCCESS;
+}
+
+bool MappedIOSystem::Exists(const char* file) const
+{
+    std::error_code ec;
+    return std::filesystem::exists(resolve(file), ec);
+}
+
+char MappedIOSystem::getOsSeparator() const
+{
+    return fallback_.getOsSeparator();
+}
+
+Assimp::IOStream* MappedIOSystem::Open(const char* file, const char* mode)
+{
+    const auto path = resolve(file);
+
+    // 只映射只读打开的文件
+    const std::string_view mode_view(mode);
+    const bool read_only = mode_view.find_first_of("wa+") == std::string_view::npos;
+    Assimp::IOStream* stream = nullptr;
+    if (read_only)
+    {
+        auto mapped = std::make_unique<MappedIOStream>();
+        if (mapped->open(path))
+            stream = mapped.release();
+    }
+    if (!stream)
+        stream = fallback_.Open(path_to_utf8(path).c_str(), mode);
+
+    if (stream && read_only)
+    {
+        std::error_code ec;
+        const auto abs_path = std::filesystem::absolute(path, ec);
+        opened_files_.push_back((ec ? path : abs_path).lexically_normal());
+    }
+    return stream;
+}
+
+void MappedIOSystem::Close(Assimp::IOStream* file)
+{
+    delete file;
+}
+
+std::vector<std::filesystem::path> MappedIOSystem::take_opened_files()
+{
+    // 同一文件可能被打开多次 (例如先探测格式再解析)
+    std::ranges::sort(opened_files_);
+    const auto duplicates = std::ranges::unique(opened_files_);
+    opened_files_.erase(duplicates.begin(), duplicates.end());
+    return std::exchange(opened_files_, {});
+}
+
+std::filesystem::path MappedIOSystem::resolve(const char* file) const
+{
+    std::filesystem::path path = utf8_to_path(file);
+    if (path.is_relative() && !base_dir_.empty())
+        return base_dir_ / path;
+    return path;
+}
+
+} // namespace truvixx
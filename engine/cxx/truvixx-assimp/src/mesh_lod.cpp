@@ -0,0 +1,61 @@
+#include "TruvixxAssimp/mesh_lod.hpp"
+
+#include <algorithm>
+#include <meshoptimizer.h>
+
+namespace truvixx
+{
+
+void build_lods(MeshInfo& mesh, const std::span<const LodLevelSettings> levels)
+{
+    mesh.lods.clear();
+    if (levels.empty() || mesh.indices.empty() || mesh.vertex_cnt == 0 || !mesh.positions)
+        return;
+
+    const size_t base_count = mesh.indices.size();
+    const float* positions = &mesh.positions[0].x;
+
+    // 相对误差 -> mesh 局部空间的绝对误差
+    const float error_scale = meshopt_simplifyScale(positions, mesh.vertex_cnt, sizeof(TruvixxFloat3));
+
+    mesh.lods.push_back(MeshLod{ .index_offset = 0, .index_count = static_cast<uint32_t>(base_count), .error = 0.f });
+
+    std::vector<uint32_t> lod_indices(base_count);
+    for (const auto& level : levels)
+    {
+        const float ratio = std::clamp(level.target_ratio, 0.f, 1.f);
+        const size_t target_count = static_cast<size_t>(static_cast<double>(base_count) * ratio) / 3 * 3;
+
+        float result_error = 0.f;
+        const size_t lod_count = meshopt_simplify(
+            lod_indices.data(),
+            mesh.indices.data(),
+            base_count,
+            positions,
+            mesh.vertex_cnt,
+            sizeof(TruvixxFloat3),
+            target_count,
+            level.target_error,
+            0,
+            &result_error
+        );
+
+        // 没有比上一级更简单时停止
+        const MeshLod& prev = mesh.lods.back();
+        if (lod_count == 0 || lod_count >= prev.index_count)
+            break;
+
+        mesh.lods.push_back(MeshLod{
+            .index_offset = static_cast<uint32_t>(mesh.indices.size()),
+            .index_count = static_cast<uint32_t>(lod_count),
+            .error = std::max(prev.error, result_error * error_scale),
+        });
+        mesh.indices.insert(mesh.indices.end(), lod_indices.begin(), lod_indices.begin() + static_cast<ptrdiff_t>(lod_count));
+    }
+
+    // 没有生成任何额外层级
+    if (mesh.lods.size() == 1)
+        mesh.lods.clear();
+}
+
+} // namespace truvixx
@@ -0,0 +1,132 @@
+#include "TruvixxAssimp/mesh_merge.hpp"
+
+#include <cmath>
+
+namespace truvixx
+{
+
+namespace
+{
+
+/// 列主序矩阵的元素 (row, col)
+float at(const TruvixxFloat4x4& m, const int row, const int col)
+{
+    return m.m[col * 4 + row];
+}
+
+TruvixxFloat3 transform_point(const TruvixxFloat4x4& m, const TruvixxFloat3& p)
+{
+    TruvixxFloat3 result;
+    for (int r = 0; r < 3; ++r)
+        result.v[r] = at(m, r, 0) * p.x + at(m, r, 1) * p.y + at(m, r, 2) * p.z + at(m, r, 3);
+    return result;
+}
+
+/// 3x3 矩阵 (行主序 a[row][col]) 乘以向量并归一化
+TruvixxFloat3 transform_direction(const float (&a)[3][3], const TruvixxFloat3& v)
+{
+    TruvixxFloat3 result;
+    for (int r = 0; r < 3; ++r)
+        result.v[r] = a[r][0] * v.x + a[r][1] * v.y + a[r][2] * v.z;
+
+    const float len = std::sqrt(result.x * result.x + result.y * result.y + result.z * result.z);
+    if (len > 0.f)
+    {
+        for (float& c : result.v)
+            c /= len;
+    }
+    return result;
+}
+
+} // namespace
+
+void merge_meshes(const std::span<const MeshMergeSource> sources, MeshInfo& out)
+{
+    out = {};
+    if (sources.empty())
+        return;
+
+    const MeshInfo& first = *sources.front().mesh;
+    out.has_normal = first.has_normal;
+    out.has_tangent = first.has_tangent;
+
+    size_t vertex_count = 0;
+    size_t index_count = 0;
+    for (const auto& source : sources)
+    {
+        vertex_count += source.mesh->vertex_cnt;
+        index_count += source.mesh->indices.size();
+    }
+
+    // 顶点流：[positions | normals | tangents]，与 optimize_mesh() 的布局一致
+    const size_t stream_count = 1 + (out.has_normal ? 1 : 0) + (out.has_tangent ? 1 : 0);
+    out.vertex_storage.resize(vertex_count * stream_count);
+    TruvixxFloat3* positions = out.vertex_storage.data();
+    TruvixxFloat3* normals = out.has_normal ? positions + vertex_count : nullptr;
+    TruvixxFloat3* tangents = out.has_tangent ? positions + vertex_count * (out.has_normal ? 2 : 1) : nullptr;
+    if (first.has_uv())
+        out.uv_storage.resize(vertex_count);
+    out.indices.reserve(index_count);
+
+    uint32_t base_vertex = 0;
+    for (const auto& source : sources)
+    {
+        const MeshInfo& mesh = *source.mesh;
+        const TruvixxFloat4x4& m = source.transform;
+
+        // 线性部分及其伴随矩阵 (cofactor)，cofactor = det * inverse^T，用于变换 normal
+        float linear[3][3];
+        for (int r = 0; r < 3; ++r)
+            for (int c = 0; c < 3; ++c)
+                linear[r][c] = at(m, r, c);
+
+        float cofactor[3][3];
+        for (int r = 0; r < 3; ++r)
+        {
+            for (int c = 0; c < 3; ++c)
+            {
+                const int r1 = (r + 1) % 3, r2 = (r + 2) % 3;
+                const int c1 = (c + 1) % 3, c2 = (c + 2) % 3;
+                cofactor[r][c] = linear[r1][c1] * linear[r2][c2] - linear[r1][c2] * linear[r2][c1];
+            }
+        }
+        const float det = linear[0][0] * cofactor[0][0] + linear[0][1] * cofactor[0][1] + linear[0][2] * cofactor[0][2];
+        const bool mirrored = det < 0.f;
+        if (mirrored)
+        {
+            for (auto& row : cofactor)
+                for (float& c : row)
+                    c = -c;
+        }
+
+        for (uint32_t i = 0; i < mesh.vertex_cnt; ++i)
+        {
+            const uint32_t dst = base_vertex + i;
+            positions[dst] = transform_point(m, mesh.positions[i]);
+            if (normals)
+                normals[dst] = transform_direction(cofactor, mesh.normals[i]);
+            if (tangents)
+                tangents[dst] = transform_direction(linear, mesh.tangents[i]);
+            if (!out.uv_storage.empty())
+                out.uv_storage[dst] = mesh.uvs[i];
+        }
+
+        for (size_t i = 0; i + 2 < mesh.indices.size(); i += 3)
+        {
+            out.indices.push_back(base_vertex + mesh.indices[i]);
+            out.indices.push_back(base_vertex + mesh.indices[mirrored ? i + 2 : i + 1]);
+            out.indices.push_back(base_vertex + mesh.indices[mirrored ? i + 1 : i + 2]);
+        }
+
+        base_vertex += mesh.vertex_cnt;
+    }
+
+    out.vertex_cnt = static_cast<uint32_t>(vertex_count);
+    out.positions = positions;
+    out.normals = normals;
+    out.tangents = tangents;
+    out.uvs = out.uv_storage.empty() ? nullptr : out.uv_storage.data();
+    out.bounds = compute_aabb(out.positions, out.vertex_cnt);
+}
+
+} // namespace truvixx
@@ -0,0 +1,143 @@
+#include "TruvixxAssimp/mesh_optimize.hpp"
+
+#include <algorithm>
+#include <meshoptimizer.h>
+
+namespace truvixx
+{
+
+namespace
+{
+
+/// 与 meshopt 默认一致的 FIFO 缓存大小
+constexpr unsigned int ACMR_CACHE_SIZE = 16;
+
+/// overdraw 优化允许的 ACMR 劣化比例
+constexpr float OVERDRAW_THRESHOLD = 1.05f;
+
+} // namespace
+
+float compute_acmr(const MeshInfo& mesh)
+{
+    if (mesh.is_index16())
+    {
+        const auto stats = meshopt_analyzeVertexCache(
+            mesh.indices16.data(), mesh.index_count(), mesh.vertex_cnt, ACMR_CACHE_SIZE, 0, 0
+        );
+        return stats.acmr;
+    }
+
+    if (mesh.indices.empty())
+        return 0.f;
+
+    const auto stats = meshopt_analyzeVertexCache(
+        mesh.indices.data(), mesh.index_count(), mesh.vertex_cnt, ACMR_CACHE_SIZE, 0, 0
+    );
+    return stats.acmr;
+}
+
+bool compact_indices(MeshInfo& mesh)
+{
+    constexpr uint32_t MAX_INDEX16_VERTICES = 65536;
+    if (mesh.indices.empty() || mesh.vertex_cnt > MAX_INDEX16_VERTICES)
+        return false;
+
+    mesh.indices16.assign(mesh.indices.begin(), mesh.indices.end());
+    std::vector<uint32_t>().swap(mesh.indices);
+    return true;
+}
+
+void optimize_mesh(MeshInfo& mesh)
+{
+    if (mesh.indices.empty() || mesh.vertex_cnt == 0 || !mesh.positions)
+        return;
+
+    const size_t index_count = mesh.indices.size();
+    const size_t vertex_count = mesh.vertex_cnt;
+
+    mesh.acmr_before = compute_acmr(mesh);
+
+    // 1. 顶点缓存
+    meshopt_optimizeVertexCache(mesh.indices.data(), mesh.indices.data(), index_count, vertex_count);
+
+    // 2. overdraw
+    meshopt_optimizeOverdraw(
+        mesh.indices.data(),
+        mesh.indices.data(),
+        index_count,
+        &mesh.positions[0].x,
+        vertex_count,
+        sizeof(TruvixxFloat3),
+        OVERDRAW_THRESHOLD
+    );
+
+    // 3. 顶点拉取：remap[old] = new，未被引用的顶点为 ~0u
+    std::vector<unsigned int> remap(vertex_count);
+    const size_t unique_count =
+        meshopt_optimizeVertexFetchRemap(remap.data(), mesh.indices.data(), index_count, vertex_count);
+
+    meshopt_remapIndexBuffer(mesh.indices.data(), mesh.indices.data(), index_count, remap.data());
+
+    // 重映射后的顶点流：[positions | normals | tangents]
+    const size_t stream_count = 1 + (mesh.normals ? 1 : 0) + (mesh.tangents ? 1 : 0);
+    std::vector<TruvixxFloat3> storage(unique_count * stream_count);
+
+    TruvixxFloat3* dst = storage.data();
+    auto remap_stream = [&](const TruvixxFloat3*& stream) {
+        if (!stream)
+            return;
+        meshopt_remapVertexBuffer(dst, stream, vertex_count, sizeof(TruvixxFloat3), remap.data());
+        stream = dst;
+        dst += unique_count;
+    };
+    remap_stream(mesh.positions);
+    remap_stream(mesh.normals);
+    remap_stream(mesh.tangents);
+
+    if (mesh.uvs)
+    {
+        std::vector<TruvixxFloat2> uvs(unique_count);
+        meshopt_remapVertexBuffer(uvs.data(), mesh.uvs, vertex_count, sizeof(TruvixxFloat2), remap.data());
+        mesh.uv_storage = std::move(uvs);
+        mesh.uvs = mesh.uv_storage.data();
+    }
+
+    if (mesh.is_skinned())
+    {
+        std::vector<TruvixxSkinVertex> skin(unique_count);
+        meshopt_remapVertexBuffer(skin.data(), mesh.skin.data(), vertex_count, sizeof(TruvixxSkinVertex), remap.data());
+        mesh.skin = std::move(skin);
+    }
+
+    // 变形偏移改用新的顶点下标，丢弃未被引用的顶点，每个目标内按顶点顺序排列
+    if (!mesh.morph_deltas.empty())
+    {
+        std::vector<TruvixxMorphDelta> deltas;
+        deltas.reserve(mesh.morph_deltas.size());
+        for (MorphTarget& target : mesh.morph_targets)
+        {
+            const auto begin = static_cast<uint32_t>(deltas.size());
+            for (uint32_t i = 0; i < target.delta_count; ++i)
+            {
+                TruvixxMorphDelta delta = mesh.morph_deltas[target.delta_offset + i];
+                if (remap[delta.vertex] == ~0u)
+                    continue;
+                delta.vertex = remap[delta.vertex];
+                deltas.push_back(delta);
+            }
+            std::sort(deltas.begin() + begin, deltas.end(), [](const TruvixxMorphDelta& a, const TruvixxMorphDelta& b) {
+                return a.vertex < b.vertex;
+            });
+            target.delta_offset = begin;
+            target.delta_count = static_cast<uint32_t>(deltas.size()) - begin;
+        }
+        mesh.morph_deltas = std::move(deltas);
+    }
+
+    mesh.vertex_storage = std::move(storage);
+    mesh.vertex_cnt = static_cast<uint32_t>(unique_count);
+
+    mesh.acmr_after = compute_acmr(mesh);
+}
+
+} // namespace truvixx
@@ -0,0 +1,365 @@
+#include "TruvixxAssimp/mesh_validate.hpp"
+
+#include "TruvixxAssimp/bounds.hpp"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace truvixx
+{
+
+namespace
+{
+
+/// 三角形两条边夹角的 sin^2 不超过该值时视为三点共线
+constexpr double DEGENERATE_SIN2 = 1e-12;
+
+/// 法线 / 切线长度平方偏离 1 超过该值时重新归一化
+constexpr float UNIT_LENGTH2_TOLERANCE = 1e-3f;
+
+/// 长度平方不超过该值的法线 / 切线无法归一化，需要替换
+constexpr float MIN_LENGTH2 = 1e-20f;
+
+constexpr uint32_t NO_VERTEX = UINT32_MAX;
+
+enum class TriangleStatus
+{
+    Valid,
+    OutOfRange,
+    NonFinite,
+    Degenerate,
+};
+
+/// 法线 / 切线的状态
+enum class DirectionStatus
+{
+    Unit,
+    Denormalized, ///< 可以直接归一化
+    Broken,       ///< NaN / Inf 或零长度，需要替换
+};
+
+bool is_finite(const TruvixxFloat3& v)
+{
+    return std::isfinite(v.x) && std::isfinite(v.y) && std::isfinite(v.z);
+}
+
+bool is_denormal(const float v)
+{
+    return std::fpclassify(v) == FP_SUBNORMAL;
+}
+
+bool has_denormal(const TruvixxFloat3& v)
+{
+    return is_denormal(v.x) || is_denormal(v.y) || is_denormal(v.z);
+}
+
+float length2(const TruvixxFloat3& v)
+{
+    return v.x * v.x + v.y * v.y + v.z * v.z;
+}
+
+DirectionStatus classify_direction(const TruvixxFloat3& v)
+{
+    const float len2 = length2(v);
+    if (!std::isfinite(len2) || len2 <= MIN_LENGTH2)
+        return DirectionStatus::Broken;
+    return std::fabs(len2 - 1.f) > UNIT_LENGTH2_TOLERANCE ? DirectionStatus::Denormalized : DirectionStatus::Unit;
+}
+
+TruvixxFloat3 normalize(const TruvixxFloat3& v)
+{
+    const float inv_len = 1.f / std::sqrt(length2(v));
+    return { .x = v.x * inv_len, .y = v.y * inv_len, .z = v.z * inv_len };
+}
+
+TruvixxFloat3 cross(const TruvixxFloat3& a, const TruvixxFloat3& b)
+{
+    return { .x = a.y * b.z - a.z * b.y, .y = a.z * b.x - a.x * b.z, .z = a.x * b.y - a.y * b.x };
+}
+
+TruvixxFloat3 flush_denormals(const TruvixxFloat3& v)
+{
+    return { .x = is_denormal(v.x) ? 0.f : v.x, .y = is_denormal(v.y) ? 0.f : v.y, .z = is_denormal(v.z) ? 0.f : v.z };
+}
+
+TriangleStatus classify_triangle(const MeshInfo& mesh, const uint32_t* tri)
+{
+    if (tri[0] >= mesh.vertex_cnt || tri[1] >= mesh.vertex_cnt || tri[2] >= mesh.vertex_cnt)
+        return TriangleStatus::OutOfRange;
+
+    const TruvixxFloat3& p0 = mesh.positions[tri[0]];
+    const TruvixxFloat3& p1 = mesh.positions[tri[1]];
+    const TruvixxFloat3& p2 = mesh.positions[tri[2]];
+    if (!is_finite(p0) || !is_finite(p1) || !is_finite(p2))
+        return TriangleStatus::NonFinite;
+
+    if (tri[0] == tri[1] || tri[1] == tri[2] || tri[0] == tri[2])
+        return TriangleStatus::Degenerate;
+
+    // |e1 x e2|^2 = |e1|^2 |e2|^2 sin^2，与尺度无关；double 避免大坐标溢出
+    const double e1[3] = { double{ p1.x } - p0.x, double{ p1.y } - p0.y, double{ p1.z } - p0.z };
+    const double e2[3] = { double{ p2.x } - p0.x, double{ p2.y } - p0.y, double{ p2.z } - p0.z };
+    const double c[3] = { e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2], e1[0] * e2[1] - e1[1] * e2[0] };
+    const double cross2 = c[0] * c[0] + c[1] * c[1] + c[2] * c[2];
+    const double len2_1 = e1[0] * e1[0] + e1[1] * e1[1] + e1[2] * e1[2];
+    const double len2_2 = e2[0] * e2[0] + e2[1] * e2[1] + e2[2] * e2[2];
+    return cross2 <= DEGENERATE_SIN2 * len2_1 * len2_2 ? TriangleStatus::Degenerate : TriangleStatus::Valid;
+}
+
+/// 垂直于 n 的任意单位向量，取与 n 夹角最大的坐标轴做叉乘
+TruvixxFloat3 any_perpendicular(const TruvixxFloat3& n)
+{
+    const float ax = std::fabs(n.x), ay = std::fabs(n.y), az = std::fabs(n.z);
+    const TruvixxFloat3 axis = ax <= ay && ax <= az ? TruvixxFloat3{ .x = 1.f, .y = 0.f, .z = 0.f }
+                             : ay <= az             ? TruvixxFloat3{ .x = 0.f, .y = 1.f, .z = 0.f }
+                                                    : TruvixxFloat3{ .x = 0.f, .y = 0.f, .z = 1.f };
+    return normalize(cross(n, axis));
+}
+
+} // namespace
+
+void validate_mesh(MeshInfo& mesh)
+{
+    MeshValidation report;
+    if (!mesh.positions || mesh.vertex_cnt == 0 || mesh.is_index16() || !mesh.lods.empty() || mesh.meshlets.count() > 0)
+    {
+        mesh.validation = report;
+        return;
+    }
+
+    const uint32_t vertex_count = mesh.vertex_cnt;
+    const size_t triangle_count = mesh.indices.size() / 3;
+
+    // 1. 只读扫描
+    for (size_t t = 0; t < triangle_count; ++t)
+    {
+        switch (classify_triangle(mesh, &mesh.indices[t * 3]))
+        {
+        case TriangleStatus::Valid:
+            break;
+        case TriangleStatus::OutOfRange:
+            ++report.out_of_range_triangles;
+            break;
+        case TriangleStatus::NonFinite:
+            ++report.non_finite_triangles;
+            break;
+        case TriangleStatus::Degenerate:
+            ++report.degenerate_triangles;
+            break;
+        }
+    }
+    uint32_t broken_normals = 0;
+    uint32_t non_finite_positions = 0;
+    for (uint32_t v = 0; v < vertex_count; ++v)
+    {
+        report.denormal_positions += has_denormal(mesh.positions[v]);
+        non_finite_positions += !is_finite(mesh.positions[v]);
+        if (mesh.normals)
+        {
+            const DirectionStatus status = classify_direction(mesh.normals[v]);
+            report.repaired_normals += status != DirectionStatus::Unit;
+            broken_normals += status == DirectionStatus::Broken;
+        }
+        if (mesh.tangents)
+            report.repaired_tangents += classify_direction(mesh.tangents[v]) != DirectionStatus::Unit;
+        if (mesh.uvs)
+            report.non_finite_uvs += !std::isfinite(mesh.uvs[v].x) || !std::isfinite(mesh.uvs[v].y);
+    }
+    // 索引数不是 3 的倍数时多出的索引无法组成三角形，一并丢弃
+    const bool trailing_indices = mesh.indices.size() % 3 != 0;
+
+    // NaN / Inf position 不会被保留的三角形引用 (引用它的三角形都已移除)，
+    // 与其余不再被引用的顶点一起压缩掉，否则会污染 bounds
+    const bool compact_vertices = report.removed_triangles() > 0 || non_finite_positions > 0;
+
+    if (!report.modified() && !trailing_indices && !compact_vertices)
+    {
+        mesh.bounds = compute_aabb(mesh.positions, mesh.vertex_cnt);
+        mesh.validation = report;
+        return;
+    }
+
+    // 2. 移除无效三角形，原地压缩索引
+    size_t kept = 0;
+    if (report.removed_triangles() > 0)
+    {
+        for (size_t t = 0; t < triangle_count; ++t)
+        {
+            const uint32_t* tri = &mesh.indices[t * 3];
+            if (classify_triangle(mesh, tri) != TriangleStatus::Valid)
+                continue;
+            mesh.indices[kept * 3 + 0] = tri[0];
+            mesh.indices[kept * 3 + 1] = tri[1];
+            mesh.indices[kept * 3 + 2] = tri[2];
+            ++kept;
+        }
+    }
+    else
+    {
+        kept = triangle_count;
+    }
+    mesh.indices.resize(kept * 3);
+
+    // 3. remap[old] = new，只在移除过三角形或存在 NaN / Inf position 时去掉未被引用的顶点，保持原有顺序
+    std::vector<uint32_t> remap;
+    uint32_t unique_count = vertex_count;
+    if (compact_vertices)
+    {
+        remap.assign(vertex_count, NO_VERTEX);
+        for (const uint32_t index : mesh.indices)
+            remap[index] = 0;
+        unique_count = 0;
+        for (uint32_t& slot : remap)
+        {
+            if (slot != NO_VERTEX)
+                slot = unique_count++;
+        }
+        for (uint32_t& index : mesh.indices)
+            index = remap[index];
+        report.removed_vertices = vertex_count - unique_count;
+    }
+    const auto new_index = [&](const uint32_t old) { return remap.empty() ? old : remap[old]; };
+
+    // 新的顶点流：[positions | normals | tangents]
+    const size_t stream_count = 1 + (mesh.normals ? 1 : 0) + (mesh.tangents ? 1 : 0);
+    std::vector<TruvixxFloat3> storage(static_cast<size_t>(unique_count) * stream_count);
+    TruvixxFloat3* positions = storage.data();
+    TruvixxFloat3* normals = mesh.normals ? positions + unique_count : nullptr;
+    TruvixxFloat3* tangents =
+        mesh.tangents ? positions + static_cast<size_t>(unique_count) * (normals ? 2 : 1) : nullptr;
+
+    for (uint32_t v = 0; v < vertex_count; ++v)
+    {
+        const uint32_t dst = new_index(v);
+        if (dst == NO_VERTEX)
+            continue;
+        positions[dst] = flush_denormals(mesh.positions[v]);
+        if (normals)
+            normals[dst] = mesh.normals[v];
+        if (tangents)
+            tangents[dst] = mesh.tangents[v];
+    }
+
+    // 4. 法线：无法归一化的以相邻面法线 (按面积加权) 替换
+    if (normals)
+    {
+        std::vector<TruvixxFloat3> face_normals;
+        if (broken_normals > 0)
+        {
+            face_normals.assign(unique_count, TruvixxFloat3{ .x = 0.f, .y = 0.f, .z = 0.f });
+            for (size_t t = 0; t < kept; ++t)
+            {
+                const uint32_t* tri = &mesh.indices[t * 3];
+                const TruvixxFloat3& p0 = positions[tri[0]];
+                const TruvixxFloat3& p1 = positions[tri[1]];
+                const TruvixxFloat3& p2 = positions[tri[2]];
+                const TruvixxFloat3 n = cross(
+                    { .x = p1.x - p0.x, .y = p1.y - p0.y, .z = p1.z - p0.z },
+                    { .x = p2.x - p0.x, .y = p2.y - p0.y, .z = p2.z - p0.z }
+                );
+                for (int c = 0; c < 3; ++c)
+                {
+                    TruvixxFloat3& acc = face_normals[tri[c]];
+                    acc = { .x = acc.x + n.x, .y = acc.y + n.y, .z = acc.z + n.z };
+                }
+            }
+        }
+
+        for (uint32_t v = 0; v < unique_count; ++v)
+        {
+            switch (classify_direction(normals[v]))
+            {
+            case DirectionStatus::Unit:
+                break;
+            case DirectionStatus::Denormalized:
+                normals[v] = normalize(normals[v]);
+                break;
+            case DirectionStatus::Broken:
+                // 没有相邻面 (或相邻面都退化为极小面积) 时使用 +Z
+                normals[v] = classify_direction(face_normals[v]) == DirectionStatus::Broken
+                                 ? TruvixxFloat3{ .x = 0.f, .y = 0.f, .z = 1.f }
+                                 : normalize(face_normals[v]);
+                break;
+            }
+        }
+    }
+
+    // 5. 切线：无法归一化的以垂直于法线的方向替换
+    if (tangents)
+    {
+        for (uint32_t v = 0; v < unique_count; ++v)
+        {
+            switch (classify_direction(tangents[v]))
+            {
+            case DirectionStatus::Unit:
+                break;
+            case DirectionStatus::Denormalized:
+                tangents[v] = normalize(tangents[v]);
+                break;
+            case DirectionStatus::Broken:
+                tangents[v] = any_perpendicular(normals ? normals[v] : TruvixxFloat3{ .x = 0.f, .y = 0.f, .z = 1.f });
+                break;
+            }
+        }
+    }
+
+    if (mesh.uvs)
+    {
+        std::vector<TruvixxFloat2> uvs(unique_count);
+        for (uint32_t v = 0; v < vertex_count; ++v)
+        {
+            const uint32_t dst = new_index(v);
+            if (dst == NO_VERTEX)
+                continue;
+            const TruvixxFloat2& uv = mesh.uvs[v];
+            const bool finite = std::isfinite(uv.x) && std::isfinite(uv.y);
+            uvs[dst] = finite ? uv : TruvixxFloat2{ .x = 0.f, .y = 0.f };
+        }
+        mesh.uv_storage = std::move(uvs);
+        mesh.uvs = mesh.uv_storage.data();
+    }
+
+    if (!remap.empty() && mesh.is_skinned())
+    {
+        std::vector<TruvixxSkinVertex> skin(unique_count);
+        for (uint32_t v = 0; v < vertex_count; ++v)
+        {
+            if (remap[v] != NO_VERTEX)
+                skin[remap[v]] = mesh.skin[v];
+        }
+        mesh.skin = std::move(skin);
+    }
+
+    // 变形偏移改用新的顶点下标，丢弃被移除的顶点；remap 保持顺序，目标内的顶点顺序不变
+    if (!remap.empty() && !mesh.morph_deltas.empty())
+    {
+        std::vector<TruvixxMorphDelta> deltas;
+        deltas.reserve(mesh.morph_deltas.size());
+        for (MorphTarget& target : mesh.morph_targets)
+        {
+            const auto begin = static_cast<uint32_t>(deltas.size());
+            for (uint32_t i = 0; i < target.delta_count; ++i)
+            {
+                TruvixxMorphDelta delta = mesh.morph_deltas[target.delta_offset + i];
+                if (remap[delta.vertex] == NO_VERTEX)
+                    continue;
+                delta.vertex = remap[delta.vertex];
+                deltas.push_back(delta);
+            }
+            target.delta_offset = begin;
+            target.delta_count = static_cast<uint32_t>(deltas.size()) - begin;
+        }
+        mesh.morph_deltas = std::move(deltas);
+    }
+
+    mesh.positions = positions;
+    mesh.normals = normals;
+    mesh.tangents = tangents;
+    mesh.vertex_storage = std::move(storage);
+    mesh.vertex_cnt = unique_count;
+    mesh.bounds = compute_aabb(mesh.positions, mesh.vertex_cnt);
+    mesh.validation = report;
+}
+
+} // namespace truvixx
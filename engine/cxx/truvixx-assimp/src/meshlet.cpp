@@ -0,0 +1,86 @@
+#include "TruvixxAssimp/meshlet.hpp"
+
+#include <meshoptimizer.h>
+
+namespace truvixx
+{
+
+void build_meshlets(MeshInfo& mesh)
+{
+    mesh.meshlets = {};
+    if (mesh.indices.empty() || mesh.vertex_cnt == 0 || !mesh.positions)
+        return;
+
+    const size_t index_count = mesh.indices.size();
+    const size_t vertex_count = mesh.vertex_cnt;
+    const float* positions = &mesh.positions[0].x;
+
+    auto& data = mesh.meshlets;
+
+    const size_t max_meshlets = meshopt_buildMeshletsBound(index_count, MESHLET_MAX_VERTICES, MESHLET_MAX_TRIANGLES);
+    std::vector<meshopt_Meshlet> meshlets(max_meshlets);
+    data.vertices.resize(max_meshlets * MESHLET_MAX_VERTICES);
+    data.triangles.resize(max_meshlets * MESHLET_MAX_TRIANGLES * 3);
+
+    const size_t meshlet_count = meshopt_buildMeshlets(
+        meshlets.data(),
+        data.vertices.data(),
+        data.triangles.data(),
+        mesh.indices.data(),
+        index_count,
+        positions,
+        vertex_count,
+        sizeof(TruvixxFloat3),
+        MESHLET_MAX_VERTICES,
+        MESHLET_MAX_TRIANGLES,
+        MESHLET_CONE_WEIGHT
+    );
+    if (meshlet_count == 0)
+    {
+        data = {};
+        return;
+    }
+
+    // 按最后一个 meshlet 截断，三角形表每个 meshlet 按 4 字节对齐
+    const meshopt_Meshlet& last = meshlets[meshlet_count - 1];
+    data.vertices.resize(last.vertex_offset + last.vertex_count);
+    data.triangles.resize(last.triangle_offset + ((last.triangle_count * 3 + 3) & ~3u));
+    data.vertices.shrink_to_fit();
+    data.triangles.shrink_to_fit();
+
+    data.meshlets.resize(meshlet_count);
+    data.spheres.resize(meshlet_count);
+    data.cones.resize(meshlet_count);
+    data.cone_apexes.resize(meshlet_count);
+
+    for (size_t i = 0; i < meshlet_count; ++i)
+    {
+        const meshopt_Meshlet& m = meshlets[i];
+
+        // meshlet 内部的顶点 / 三角形重排，提升局部性
+        meshopt_optimizeMeshlet(
+            &data.vertices[m.vertex_offset], &data.triangles[m.triangle_offset], m.triangle_count, m.vertex_count
+        );
+
+        const meshopt_Bounds bounds = meshopt_computeMeshletBounds(
+            &data.vertices[m.vertex_offset],
+            &data.triangles[m.triangle_offset],
+            m.triangle_count,
+            positions,
+            vertex_count,
+            sizeof(TruvixxFloat3)
+        );
+
+        data.meshlets[i] = TruvixxMeshlet{
+            .vertex_offset = m.vertex_offset,
+            .triangle_offset = m.triangle_offset,
+            .vertex_count = m.vertex_count,
+            .triangle_count = m.triangle_count,
+        };
+        data.spheres[i] = { { bounds.center[0], bounds.center[1], bounds.center[2], bounds.radius } };
+        data.cones[i] = { { bounds.cone_axis[0], bounds.cone_axis[1], bounds.cone_axis[2], bounds.cone_cutoff } };
+        data.cone_apexes[i] = { { bounds.cone_apex[0], bounds.cone_apex[1], bounds.cone_apex[2] } };
+    }
+}
+
+} // namespace truvixx
@@ -0,0 +1,906 @@
+#include "TruvixxAssimp/scene_cache.hpp"
+#include "TruvixxAssimp/cache_io.hpp"
+#include "TruvixxAssimp/hash.hpp"
+#include "TruvixxAssimp/utf8_path.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+namespace truvixx
+{
+
+namespace
+{
+
+// 缓存文件布局 (所有 offset 都是相对文件起始的字节偏移，16 字节对齐，见 cache_io.hpp)
+//
+// | CacheHeader | 顶点流 / 索引 / 蒙皮 / 变形 ... | 内嵌纹理数据 ... | 动画数组 ... | refs (uint32) | 字符串 blob |
+// | CachedMesh[] | CachedMaterial[] | CachedInstance[] | CachedTexture[] | CachedNode[] | CachedAnimation[] |
+// | CachedDependency[] |
+//
+// 字符串 blob 即 SceneData::strings 的内容，末尾依次追加 source_path 和依赖文件路径；
+// refs 为 mesh 引用数组后接等长的材质引用数组
+//
+// 顶点流放在前面，这样写入时只需顺序写一遍，最后回写 header
+
+constexpr char CACHE_MAGIC[8] = { 'T', 'V', 'X', 'S', 'C', 'E', 'N', 'E' };
+
+struct CacheHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t post_process_flags;
+    int64_t source_mtime;
+    uint64_t source_size;
+    uint64_t file_size;
+
+    uint32_t mesh_count;
+    uint32_t material_count;
+    uint32_t instance_count;
+    uint32_t option_flags;
+    uint64_t option_hash;
+    uint32_t texture_count;
+    uint32_t _pad0;
+
+    CachedString source_path;
+
+    uint64_t meshes_offset;
+    uint64_t materials_offset;
+    uint64_t instances_offset;
+    uint64_t textures_offset;
+    uint64_t refs_offset;
+    uint64_t refs_count; ///< mesh 引用数量，材质引用数量与之相同
+    uint64_t strings_offset;
+    uint64_t strings_size;
+
+    // 节点树和动画 (SceneLoadOptions::import_animation)
+    uint32_t node_count;
+    uint32_t animation_count;
+    uint64_t nodes_offset;
+    uint64_t animations_offset;
+    uint64_t animation_channel_count;
+    uint64_t animation_channels_offset;
+    uint64_t animation_key_count;
+    uint64_t animation_keys_offset;
+    uint64_t animation_quantized_key_count;
+    uint64_t animation_quantized_keys_offset;
+    uint64_t animation_range_count; ///< 0 或 animation_channel_count
+    uint64_t animation_ranges_offset;
+    uint64_t morph_channel_count;
+    uint64_t morph_channels_offset;
+    uint64_t morph_weight_count;
+    uint64_t morph_weights_offset;
+
+    // 导入时读取的其他文件
+    uint64_t dependency_count;
+    uint64_t dependencies_offset;
+};
+
+struct CachedDependency
+{
+    CachedString path; ///< 位于字符串 blob 的场景字符串之后
+    int64_t mtime;
+    uint64_t size;
+};
+
+struct CachedMesh
+{
+    uint32_t vertex_cnt;
+    uint32_t index_cnt;
+    uint32_t has_normal;
+    uint32_t has_tangent;
+
+    uint64_t positions_offset; ///< 0 表示不存在
+    uint64_t normals_offset;
+    uint64_t tangents_offset;
+    uint64_t uvs_offset;
+    uint64_t indices_offset;
+
+    float acmr_before;
+    float acmr_after;
+    uint32_t index16; ///< 非 0 时 indices_offset 指向 uint16 索引
+    uint32_t _pad0;
+
+    uint32_t meshlet_count;
+    uint32_t meshlet_vertex_count;
+    uint64_t meshlet_triangle_size; ///< 三角形表字节数
+    uint64_t meshlets_offset;
+    uint64_t meshlet_vertices_offset;
+    uint64_t meshlet_triangles_offset;
+    uint64_t meshlet_spheres_offset;
+    uint64_t meshlet_cones_offset;
+    uint64_t meshlet_cone_apexes_offset;
+
+    uint32_t lod_count;   ///< 0 表示只有 LOD0
+    uint32_t joint_count; ///< 0 表示不是蒙皮 mesh，否则 skin_offset 处有 vertex_cnt 个蒙皮顶点
+    uint64_t lods_offset;
+
+    uint64_t skin_offset;
+    uint64_t joint_nodes_offset;
+    uint64_t inverse_binds_offset;
+    uint32_t morph_target_count;
+    uint32_t morph_delta_count;
+    uint64_t morph_targets_offset;
+    uint64_t morph_deltas_offset;
+
+    TruvixxAabb bounds;
+
+    MeshValidation validation; ///< 即 MeshInfo::validation
+    uint32_t _pad1;
+};
+
+struct CachedNode
+{
+    CachedString name;
+    uint32_t parent;
+    uint32_t _pad0;
+    TruvixxNodeTransform rest;
+};
+
+struct CachedAnimation
+{
+    CachedString name;
+    float duration;
+    float sample_rate;
+    uint32_t frame_count;
+    uint32_t channel_offset;
+    uint32_t channel_count;
+    uint32_t morph_channel_offset;
+    uint64_t key_offset;
+    uint32_t morph_channel_count;
+    uint32_t morph_weights_per_frame;
+    uint64_t morph_weight_offset;
+    uint32_t quantized;
+    uint32_t _pad0;
+};
+
+/// 影响导入结果的选项位
+enum OptionBits : uint32_t
+{
+    OptionBitOptimizeMeshes = 1u << 0,
+    OptionBitCompactIndices = 1u << 1,
+    OptionBitBuildMeshlets = 1u << 2,
+    OptionBitSkipEmptyNodes = 1u << 3,
+    OptionBitMergeStaticMeshes = 1u << 4,
+    OptionBitImportAnimation = 1u << 5,
+    OptionBitQuantizeAnimation = 1u << 6,
+    OptionBitValidateMeshes = 1u << 7,
+
+    /// 被移除的顶点属性 (VertexAttribute) 左移该位数存放，默认全部保留时为 0
+    OptionShiftStrippedAttributes = 8,
+};
+
+uint32_t option_bits(const SceneLoadOptions& options)
+{
+    uint32_t bits = 0;
+    if (options.optimize_meshes)
+        bits |= OptionBitOptimizeMeshes;
+    if (options.compact_indices)
+        bits |= OptionBitCompactIndices;
+    if (options.build_meshlets)
+        bits |= OptionBitBuildMeshlets;
+    if (options.skip_empty_nodes)
+        bits |= OptionBitSkipEmptyNodes;
+    if (options.merge_static_meshes)
+        bits |= OptionBitMergeStaticMeshes;
+    if (options.import_animation)
+        bits |= OptionBitImportAnimation;
+    if (options.import_animation && options.quantize_animation)
+        bits |= OptionBitQuantizeAnimation;
+    if (options.validate_meshes)
+        bits |= OptionBitValidateMeshes;
+    bits |= (~options.attributes & VertexAttributeAll) << OptionShiftStrippedAttributes;
+    return bits;
+}
+
+/// 影响导入结果的浮点选项的哈希
+uint64_t hash_options(const SceneLoadOptions& options)
+{
+    if (options.lod_levels.empty() && !options.import_animation)
+        return 0;
+
+    static_assert(sizeof(LodLevelSettings) == sizeof(float) * 2, "LodLevelSettings must not contain padding");
+    uint64_t hash = fnv1a(options.lod_levels.data(), options.lod_levels.size() * sizeof(LodLevelSettings));
+    if (options.import_animation)
+        hash = fnv1a(&options.animation_sample_rate, sizeof(options.animation_sample_rate), hash);
+    return hash;
+}
+
+/// 索引都需要落在顶点范围内，否则上传后会越界访问顶点缓冲
+template <typename Index>
+[[nodiscard]] bool indices_in_range(const std::vector<Index>& indices, const uint32_t vertex_cnt)
+{
+    return std::ranges::all_of(indices, [vertex_cnt](const Index index) { return index < vertex_cnt; });
+}
+
+/// 读取并校验 meshlet 数据
+[[nodiscard]] bool read_meshlets(const CacheView& view, const CachedMesh& cached, MeshletData& out)
+{
+    if (!read_array(view, cached.meshlets_offset, cached.meshlet_count, out.meshlets) ||
+        !read_array(view, cached.meshlet_vertices_offset, cached.meshlet_vertex_count, out.vertices) ||
+        !read_array(view, cached.meshlet_triangles_offset, cached.meshlet_triangle_size, out.triangles) ||
+        !read_array(view, cached.meshlet_spheres_offset, cached.meshlet_count, out.spheres) ||
+        !read_array(view, cached.meshlet_cones_offset, cached.meshlet_count, out.cones) ||
+        !read_array(view, cached.meshlet_cone_apexes_offset, cached.meshlet_count, out.cone_apexes))
+        return false;
+
+    for (const auto& m : out.meshlets)
+    {
+        if (uint64_t{ m.vertex_offset } + m.vertex_count > out.vertices.size() ||
+            uint64_t{ m.triangle_offset } + uint64_t{ m.triangle_count } * 3 > out.triangles.size())
+            return false;
+    }
+    for (const uint32_t v : out.vertices)
+    {
+        if (v >= cached.vertex_cnt)
+            return false;
+    }
+    return true;
+}
+
+/// 读取并校验蒙皮和变形目标
+[[nodiscard]] bool read_skin_and_morph(const CacheView& view, const CachedMesh& cached, const uint32_t node_count, MeshInfo& out)
+{
+    if (cached.joint_count > 0)
+    {
+        if (!read_array(view, cached.skin_offset, cached.vertex_cnt, out.skin) ||
+            !read_array(view, cached.joint_nodes_offset, cached.joint_count, out.joint_nodes) ||
+            !read_array(view, cached.inverse_binds_offset, cached.joint_count, out.inverse_binds))
+            return false;
+
+        for (const auto& vertex : out.skin)
+        {
+            for (const unsigned char joint : vertex.joints)
+            {
+                if (joint >= cached.joint_count)
+                    return false;
+            }
+        }
+        for (const uint32_t node : out.joint_nodes)
+        {
+            if (node != NO_NODE && node >= node_count)
+                return false;
+        }
+    }
+
+    if (cached.morph_target_count > 0)
+    {
+        if (!read_array(view, cached.morph_targets_offset, cached.morph_target_count, out.morph_targets) ||
+            !read_array(view, cached.morph_deltas_offset, cached.morph_delta_count, out.morph_deltas))
+            return false;
+
+        for (const auto& target : out.morph_targets)
+        {
+            if (uint64_t{ target.delta_offset } + target.delta_count > cached.morph_delta_count)
+                return false;
+        }
+        for (const auto& delta : out.morph_deltas)
+        {
+            if (delta.vertex >= cached.vertex_cnt)
+                return false;
+        }
+    }
+    return true;
+}
+
+/// 校验导入时读取的其他文件是否与写入缓存时一致
+[[nodiscard]] bool check_dependencies(const CacheView& view, const CacheHeader& header, const char* strings)
+{
+    const auto* dependencies = view.get<CachedDependency>(header.dependencies_offset, header.dependency_count);
+    if (!dependencies)
+        return false;
+
+    for (uint64_t i = 0; i < header.dependency_count; ++i)
+    {
+        const CachedDependency& cached = dependencies[i];
+        if (cached.path.offset > header.strings_size || cached.path.length > header.strings_size - cached.path.offset)
+            return false;
+
+        const auto current = SceneCacheDependency::make(
+            utf8_to_path(std::string_view(strings + cached.path.offset, cached.path.length))
+        );
+        if (!current || current->mtime != cached.mtime || current->size != cached.size)
+            return false;
+    }
+    return true;
+}
+
+/// 读取并校验节点树和动画片段，mesh 需已读取 (变形通道引用 mesh 的变形目标)
+[[nodiscard]] bool read_animations(const CacheView& view, const CacheHeader& header, SceneData& out)
+{
+    const auto* nodes = view.get<CachedNode>(header.nodes_offset, header.node_count);
+    const auto* animations = view.get<CachedAnimation>(header.animations_offset, header.animation_count);
+    if (!nodes || !animations)
+        return false;
+
+    out.skeleton_nodes.resize(header.node_count);
+    for (uint32_t i = 0; i < header.node_count; ++i)
+    {
+        const CachedNode& cached = nodes[i];
+        SkeletonNode& node = out.skeleton_nodes[i];
+        if (!from_cached(out.strings, cached.name, node.name))
+            return false;
+        // 父节点总在子节点之前
+        if (cached.parent != NO_NODE && cached.parent >= i)
+            return false;
+        node.parent = cached.parent;
+        node.rest = cached.rest;
+    }
+
+    if (!read_array(view, header.animation_channels_offset, header.animation_channel_count, out.animation_channels) ||
+        !read_array(view, header.animation_keys_offset, header.animation_key_count, out.animation_keys) ||
+        !read_array(
+            view, header.animation_quantized_keys_offset, header.animation_quantized_key_count, out.animation_quantized_keys
+        ) ||
+        !read_array(view, header.animation_ranges_offset, header.animation_range_count, out.animation_ranges) ||
+        !read_array(view, header.morph_channels_offset, header.morph_channel_count, out.morph_channels) ||
+        !read_array(view, header.morph_weights_offset, header.morph_weight_count, out.morph_weights))
+        return false;
+
+    if (header.animation_range_count != 0 && header.animation_range_count != header.animation_channel_count)
+        return false;
+    for (const uint32_t node : out.animation_channels)
+    {
+        if (node >= header.node_count)
+            return false;
+    }
+    for (const auto& channel : out.morph_channels)
+    {
+        if (channel.mesh >= out.mesh_count() || channel.weight_count != out.mesh_infos[channel.mesh].morph_targets.size())
+            return false;
+    }
+
+    out.animations.resize(header.animation_count);
+    for (uint32_t i = 0; i < header.animation_count; ++i)
+    {
+        const CachedAnimation& cached = animations[i];
+        AnimationClip& clip = out.animations[i];
+        if (!from_cached(out.strings, cached.name, clip.name))
+            return false;
+
+        clip.duration = cached.duration;
+        clip.sample_rate = cached.sample_rate;
+        clip.frame_count = cached.frame_count;
+        clip.channel_offset = cached.channel_offset;
+        clip.channel_count = cached.channel_count;
+        clip.key_offset = cached.key_offset;
+        clip.morph_channel_offset = cached.morph_channel_offset;
+        clip.morph_channel_count = cached.morph_channel_count;
+        clip.morph_weights_per_frame = cached.morph_weights_per_frame;
+        clip.morph_weight_offset = cached.morph_weight_offset;
+        clip.quantized = cached.quantized != 0;
+
+        // 采样时按区间直接访问，所有区间都需要落在数组内
+        const uint64_t key_count = uint64_t{ clip.frame_count } * clip.channel_count;
+        const uint64_t keys_size = clip.quantized ? header.animation_quantized_key_count : header.animation_key_count;
+        const uint64_t weight_count = uint64_t{ clip.frame_count } * clip.morph_weights_per_frame;
+        if (uint64_t{ clip.channel_offset } + clip.channel_count > header.animation_channel_count ||
+            clip.key_offset > keys_size || key_count > keys_size - clip.key_offset ||
+            (clip.quantized && header.animation_range_count == 0) ||
+            uint64_t{ clip.morph_channel_offset } + clip.morph_channel_count > header.morph_channel_count ||
+            clip.morph_weight_offset > header.morph_weight_count ||
+            weight_count > header.morph_weight_count - clip.morph_weight_offset)
+            return false;
+
+        for (uint32_t c = 0; c < clip.morph_channel_count; ++c)
+        {
+            const MorphChannel& channel = out.morph_channels[clip.morph_channel_offset + c];
+            if (uint64_t{ channel.weight_offset } + channel.weight_count > clip.morph_weights_per_frame)
+                return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+std::optional<SceneCacheKey> SceneCacheKey::make(
+    const std::filesystem::path& path,
+    const uint32_t post_process_flags,
+    const SceneLoadOptions& options
+)
+{
+    std::error_code ec;
+    const auto abs_path = std::filesystem::absolute(path, ec).lexically_normal();
+    if (ec)
+        return std::nullopt;
+
+    const auto mtime = std::filesystem::last_write_time(abs_path, ec);
+    if (ec)
+        return std::nullopt;
+
+    const auto size = std::filesystem::file_size(abs_path, ec);
+    if (ec)
+        return std::nullopt;
+
+    return SceneCacheKey{
+        .source_path = path_to_utf8(abs_path),
+        .source_mtime = static_cast<int64_t>(mtime.time_since_epoch().count()),
+        .source_size = static_cast<uint64_t>(size),
+        .post_process_flags = post_process_flags,
+        .option_flags = option_bits(options),
+        .option_hash = hash_options(options),
+    };
+}
+
+std::optional<SceneCacheKey> SceneCacheKey::make(
+    const std::span<const std::byte> data,
+    const std::string_view format_hint,
+    const std::filesystem::path& base_dir,
+    const uint32_t post_process_flags,
+    const SceneLoadOptions& options
+)
+{
+    // 同样的数据以不同 base_dir 加载时，纹理路径和外部文件 (.bin / .mtl) 都可能不同
+    std::string dir;
+    if (!base_dir.empty())
+    {
+        std::error_code ec;
+        const auto abs_dir = std::filesystem::absolute(base_dir, ec);
+        dir = path_to_utf8((ec ? base_dir : abs_dir).lexically_normal());
+    }
+
+    return SceneCacheKey{
+        .source_path = std::format(
+            "memory-{:016x}-{:016x}.{}",
+            hash_blob(data.data(), data.size()),
+            fnv1a(dir.data(), dir.size()),
+            format_hint
+        ),
+        .source_mtime = 0,
+        .source_size = static_cast<uint64_t>(data.size()),
+        .post_process_flags = post_process_flags,
+        .option_flags = option_bits(options),
+        .option_hash = hash_options(options),
+    };
+}
+
+std::optional<SceneCacheDependency> SceneCacheDependency::make(const std::filesystem::path& path)
+{
+    std::error_code ec;
+    const auto mtime = std::filesystem::last_write_time(path, ec);
+    if (ec)
+        return std::nullopt;
+
+    const auto size = std::filesystem::file_size(path, ec);
+    if (ec)
+        return std::nullopt;
+
+    return SceneCacheDependency{
+        .path = path_to_utf8(path),
+        .mtime = static_cast<int64_t>(mtime.time_since_epoch().count()),
+        .size = static_cast<uint64_t>(size),
+    };
+}
+
+std::filesystem::path default_scene_cache_dir()
+{
+    if (const char* enable = std::getenv("TRUVIXX_SCENE_CACHE"); enable && std::string_view(enable) == "0")
+        return {};
+
+    if (const char* dir = std::getenv("TRUVIXX_SCENE_CACHE_DIR"); dir && *dir)
+        return dir;
+
+    std::error_code ec;
+    auto tmp_dir = std::filesystem::temp_directory_path(ec);
+    if (ec)
+        return {};
+    return tmp_dir / "truvixx-scene-cache";
+}
+
+std::filesystem::path scene_cache_path(const std::filesystem::path& cache_dir, const SceneCacheKey& key)
+{
+    // 同一文件不同后处理标志 / 加载选项使用不同的缓存文件
+    uint64_t hash = fnv1a(key.source_path.data(), key.source_path.size());
+    hash = fnv1a(&key.post_process_flags, sizeof(key.post_process_flags), hash);
+    hash = fnv1a(&key.option_flags, sizeof(key.option_flags), hash);
+    hash = fnv1a(&key.option_hash, sizeof(key.option_hash), hash);
+
+    const std::string stem = path_to_utf8(utf8_to_path(key.source_path).stem());
+    return cache_dir / utf8_to_path(std::format("{}-{:016x}.tvxscene", stem, hash));
+}
+
+bool write_scene_cache(
+    const std::filesystem::path& cache_file,
+    const SceneCacheKey& key,
+    const SceneData& scene,
+    const std::vector<SceneCacheDependency>& dependencies
+)
+{
+    std::error_code ec;
+    std::filesystem::create_directories(cache_file.parent_path(), ec);
+    if (ec)
+        return false;
+
+    auto tmp_file = cache_file;
+    tmp_file += ".tmp";
+
+    CacheWriter writer{ .out = std::ofstream(tmp_file, std::ios::binary | std::ios::trunc) };
+    if (!writer.out)
+        return false;
+
+    CacheHeader header{};
+    std::memcpy(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC));
+    header.version = SCENE_CACHE_VERSION;
+    header.post_process_flags = key.post_process_flags;
+    header.option_flags = key.option_flags;
+    header.option_hash = key.option_hash;
+    header.source_mtime = key.source_mtime;
+    header.source_size = key.source_size;
+    header.mesh_count = scene.mesh_count();
+    header.material_count = scene.material_count();
+    header.instance_count = scene.instance_count();
+    header.texture_count = scene.texture_count();
+
+    // 占位，最后回写
+    writer.write(&header, sizeof(header));
+
+    // 顶点流
+    std::vector<CachedMesh> cached_meshes;
+    cached_meshes.reserve(scene.mesh_count());
+    for (const auto& mesh : scene.mesh_infos)
+    {
+        CachedMesh cached{};
+        cached.vertex_cnt = mesh.vertex_cnt;
+        cached.index_cnt = mesh.total_index_count();
+        cached.index16 = mesh.is_index16();
+        cached.has_normal = mesh.has_normal && mesh.normals;
+        cached.has_tangent = mesh.has_tangent && mesh.tangents;
+        cached.acmr_before = mesh.acmr_before;
+        cached.acmr_after = mesh.acmr_after;
+        cached.bounds = mesh.bounds;
+        cached.validation = mesh.validation;
+
+        if (mesh.positions)
+            cached.positions_offset = writer.write_section(mesh.positions, mesh.vertex_cnt);
+        if (cached.has_normal)
+            cached.normals_offset = writer.write_section(mesh.normals, mesh.vertex_cnt);
+        if (cached.has_tangent)
+            cached.tangents_offset = writer.write_section(mesh.tangents, mesh.vertex_cnt);
+        if (mesh.uvs)
+            cached.uvs_offset = writer.write_section(mesh.uvs, mesh.vertex_cnt);
+        if (mesh.is_index16())
+            cached.indices_offset = writer.write_section(mesh.indices16.data(), mesh.indices16.size());
+        else if (!mesh.indices.empty())
+            cached.indices_offset = writer.write_section(mesh.indices.data(), mesh.indices.size());
+
+        if (const auto& meshlets = mesh.meshlets; meshlets.count() > 0)
+        {
+            cached.meshlet_count = meshlets.count();
+            cached.meshlet_vertex_count = static_cast<uint32_t>(meshlets.vertices.size());
+            cached.meshlet_triangle_size = meshlets.triangles.size();
+            cached.meshlets_offset = writer.write_section(meshlets.meshlets.data(), meshlets.meshlets.size());
+            cached.meshlet_vertices_offset = writer.write_section(meshlets.vertices.data(), meshlets.vertices.size());
+            cached.meshlet_triangles_offset = writer.write_section(meshlets.triangles.data(), meshlets.triangles.size());
+            cached.meshlet_spheres_offset = writer.write_section(meshlets.spheres.data(), meshlets.spheres.size());
+            cached.meshlet_cones_offset = writer.write_section(meshlets.cones.data(), meshlets.cones.size());
+            cached.meshlet_cone_apexes_offset =
+                writer.write_section(meshlets.cone_apexes.data(), meshlets.cone_apexes.size());
+        }
+
+        if (!mesh.lods.empty())
+        {
+            cached.lod_count = static_cast<uint32_t>(mesh.lods.size());
+            cached.lods_offset = writer.write_section(mesh.lods.data(), mesh.lods.size());
+        }
+
+        if (mesh.is_skinned())
+        {
+            cached.joint_count = static_cast<uint32_t>(mesh.joint_nodes.size());
+            cached.skin_offset = writer.write_section(mesh.skin.data(), mesh.skin.size());
+            cached.joint_nodes_offset = writer.write_section(mesh.joint_nodes.data(), mesh.joint_nodes.size());
+            cached.inverse_binds_offset = writer.write_section(mesh.inverse_binds.data(), mesh.inverse_binds.size());
+        }
+
+        if (!mesh.morph_targets.empty())
+        {
+            cached.morph_target_count = static_cast<uint32_t>(mesh.morph_targets.size());
+            cached.morph_delta_count = static_cast<uint32_t>(mesh.morph_deltas.size());
+            cached.morph_targets_offset = writer.write_section(mesh.morph_targets.data(), mesh.morph_targets.size());
+            cached.morph_deltas_offset = writer.write_section(mesh.morph_deltas.data(), mesh.morph_deltas.size());
+        }
+
+        cached_meshes.push_back(cached);
+    }
+
+    // 内嵌纹理数据
+    std::vector<CachedTexture> cached_textures;
+    cached_textures.reserve(scene.texture_count());
+    for (const auto& texture : scene.textures)
+    {
+        const uint64_t data_offset = texture.embedded ? writer.write_section(texture.data, texture.size) : 0;
+        cached_textures.push_back(to_cached(texture, data_offset));
+    }
+
+    // 材质、instance，字符串直接引用 scene.strings
+    std::vector<CachedMaterial> cached_materials;
+    cached_materials.reserve(scene.material_count());
+    for (const auto& mat : scene.materials)
+        cached_materials.push_back(to_cached(mat));
+
+    std::vector<CachedInstance> cached_instances;
+    cached_instances.reserve(scene.instance_count());
+    for (const auto& inst : scene.instances)
+        cached_instances.push_back(to_cached(inst));
+
+    // 节点树和动画
+    std::vector<CachedNode> cached_nodes;
+    cached_nodes.reserve(scene.node_count());
+    for (const auto& node : scene.skeleton_nodes)
+    {
+        cached_nodes.push_back(CachedNode{ .name = to_cached(node.name), .parent = node.parent, ._pad0 = 0, .rest = node.rest });
+    }
+
+    std::vector<CachedAnimation> cached_animations;
+    cached_animations.reserve(scene.animation_count());
+    for (const auto& clip : scene.animations)
+    {
+        cached_animations.push_back(CachedAnimation{
+            .name = to_cached(clip.name),
+            .duration = clip.duration,
+            .sample_rate = clip.sample_rate,
+            .frame_count = clip.frame_count,
+            .channel_offset = clip.channel_offset,
+            .channel_count = clip.channel_count,
+            .morph_channel_offset = clip.morph_channel_offset,
+            .key_offset = clip.key_offset,
+            .morph_channel_count = clip.morph_channel_count,
+            .morph_weights_per_frame = clip.morph_weights_per_frame,
+            .morph_weight_offset = clip.morph_weight_offset,
+            .quantized = clip.quantized,
+            ._pad0 = 0,
+        });
+    }
+
+    header.node_count = scene.node_count();
+    header.animation_count = scene.animation_count();
+    header.animation_channel_count = scene.animation_channels.size();
+    header.animation_channels_offset = writer.write_section(scene.animation_channels.data(), scene.animation_channels.size());
+    header.animation_key_count = scene.animation_keys.size();
+    header.animation_keys_offset = writer.write_section(scene.animation_keys.data(), scene.animation_keys.size());
+    header.animation_quantized_key_count = scene.animation_quantized_keys.size();
+    header.animation_quantized_keys_offset =
+        writer.write_section(scene.animation_quantized_keys.data(), scene.animation_quantized_keys.size());
+    header.animation_range_count = scene.animation_ranges.size();
+    header.animation_ranges_offset = writer.write_section(scene.animation_ranges.data(), scene.animation_ranges.size());
+    header.morph_channel_count = scene.morph_channels.size();
+    header.morph_channels_offset = writer.write_section(scene.morph_channels.data(), scene.morph_channels.size());
+    header.morph_weight_count = scene.morph_weights.size();
+    header.morph_weights_offset = writer.write_section(scene.morph_weights.data(), scene.morph_weights.size());
+
+    header.refs_count = scene.instance_mesh_refs.size();
+    header.refs_offset = writer.write_section(scene.instance_mesh_refs.data(), scene.instance_mesh_refs.size());
+    writer.write(scene.instance_material_refs.data(), scene.instance_material_refs.size() * sizeof(uint32_t));
+
+    // source_path 紧跟在场景字符串之后，读取时只把前一部分放回字符串表
+    header.strings_offset = writer.write_section(scene.strings.data(), scene.strings.size());
+    header.source_path = CachedString{ .offset = scene.strings.size(), .length = key.source_path.size() };
+    writer.write(key.source_path.c_str(), key.source_path.size() + 1);
+    header.strings_size = scene.strings.size() + key.source_path.size() + 1;
+
+    std::vector<CachedDependency> cached_dependencies;
+    cached_dependencies.reserve(dependencies.size());
+    for (const auto& dependency : dependencies)
+    {
+        cached_dependencies.push_back(CachedDependency{
+            .path = CachedString{ .offset = header.strings_size, .length = dependency.path.size() },
+            .mtime = dependency.mtime,
+            .size = dependency.size,
+        });
+        writer.write(dependency.path.c_str(), dependency.path.size() + 1);
+        header.strings_size += dependency.path.size() + 1;
+    }
+
+    header.meshes_offset = writer.write_section(cached_meshes.data(), cached_meshes.size());
+    header.materials_offset = writer.write_section(cached_materials.data(), cached_materials.size());
+    header.instances_offset = writer.write_section(cached_instances.data(), cached_instances.size());
+    header.textures_offset = writer.write_section(cached_textures.data(), cached_textures.size());
+    header.nodes_offset = writer.write_section(cached_nodes.data(), cached_nodes.size());
+    header.animations_offset = writer.write_section(cached_animations.data(), cached_animations.size());
+    header.dependency_count = cached_dependencies.size();
+    header.dependencies_offset = writer.write_section(cached_dependencies.data(), cached_dependencies.size());
+    header.file_size = writer.offset;
+
+    writer.out.seekp(0);
+    writer.out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    writer.out.close();
+    if (!writer.out)
+    {
+        std::filesystem::remove(tmp_file, ec);
+        return false;
+    }
+
+    std::filesystem::rename(tmp_file, cache_file, ec);
+    if (ec)
+    {
+        std::filesystem::remove(tmp_file, ec);
+        return false;
+    }
+    return true;
+}
+
+bool read_scene_cache(
+    const std::filesystem::path& cache_file,
+    const SceneCacheKey& key,
+    MappedFile& out_file,
+    SceneData& out_scene
+)
+{
+    if (!std::filesystem::exists(cache_file))
+        return false;
+
+    if (!out_file.open(cache_file))
+        return false;
+
+    // 任何校验失败都需要解除映射
+    auto fail = [&]() {
+        out_file.close();
+        out_scene = {};
+        return false;
+    };
+
+    const CacheView view{ .base = out_file.data(), .size = out_file.size() };
+
+    const auto* header = view.get<CacheHeader>(0, 1);
+    if (!header)
+        return fail();
+    if (std::memcmp(header->magic, CACHE_MAGIC, sizeof(CACHE_MAGIC)) != 0 || header->version != SCENE_CACHE_VERSION)
+        return fail();
+    if (header->file_size != view.size)
+        return fail();
+    if (header->post_process_flags != key.post_process_flags || header->option_flags != key.option_flags ||
+        header->option_hash != key.option_hash || header->source_mtime != key.source_mtime ||
+        header->source_size != key.source_size)
+        return fail();
+
+    const auto* strings = view.get<char>(header->strings_offset, header->strings_size);
+    if (!strings && header->strings_size != 0)
+        return fail();
+
+    const CachedString& source_path = header->source_path;
+    if (source_path.offset > header->strings_size || source_path.length > header->strings_size - source_path.offset ||
+        std::string_view(strings + source_path.offset, source_path.length) != key.source_path)
+        return fail();
+    if (!check_dependencies(view, *header, strings))
+        return fail();
+    if (!out_scene.strings.assign(strings, source_path.offset))
+        return fail();
+
+    const auto* meshes = view.get<CachedMesh>(header->meshes_offset, header->mesh_count);
+    const auto* materials = view.get<CachedMaterial>(header->materials_offset, header->material_count);
+    const auto* instances = view.get<CachedInstance>(header->instances_offset, header->instance_count);
+    const auto* textures = view.get<CachedTexture>(header->textures_offset, header->texture_count);
+    if (!meshes || !materials || !instances || !textures)
+        return fail();
+
+    // Mesh
+    out_scene.mesh_infos.resize(header->mesh_count);
+    for (uint32_t i = 0; i < header->mesh_count; ++i)
+    {
+        const CachedMesh& cached = meshes[i];
+        MeshInfo& mesh = out_scene.mesh_infos[i];
+
+        mesh.vertex_cnt = cached.vertex_cnt;
+        mesh.has_normal = cached.has_normal != 0;
+        mesh.has_tangent = cached.has_tangent != 0;
+        mesh.acmr_before = cached.acmr_before;
+        mesh.acmr_after = cached.acmr_after;
+        mesh.bounds = cached.bounds;
+        mesh.validation = cached.validation;
+
+        if (cached.positions_offset)
+        {
+            mesh.positions = view.get<TruvixxFloat3>(cached.positions_offset, cached.vertex_cnt);
+            if (!mesh.positions)
+                return fail();
+        }
+        if (cached.normals_offset)
+        {
+            mesh.normals = view.get<TruvixxFloat3>(cached.normals_offset, cached.vertex_cnt);
+            if (!mesh.normals)
+                return fail();
+        }
+        if (cached.tangents_offset)
+        {
+            mesh.tangents = view.get<TruvixxFloat3>(cached.tangents_offset, cached.vertex_cnt);
+            if (!mesh.tangents)
+                return fail();
+        }
+        if (cached.uvs_offset)
+        {
+            mesh.uvs = view.get<TruvixxFloat2>(cached.uvs_offset, cached.vertex_cnt);
+            if (!mesh.uvs)
+                return fail();
+        }
+        if (cached.indices_offset && cached.index16)
+        {
+            const auto* indices = view.get<uint16_t>(cached.indices_offset, cached.index_cnt);
+            if (!indices)
+                return fail();
+            mesh.indices16.assign(indices, indices + cached.index_cnt);
+            if (!indices_in_range(mesh.indices16, cached.vertex_cnt))
+                return fail();
+        }
+        else if (cached.indices_offset)
+        {
+            const auto* indices = view.get<uint32_t>(cached.indices_offset, cached.index_cnt);
+            if (!indices)
+                return fail();
+            mesh.indices.assign(indices, indices + cached.index_cnt);
+            if (!indices_in_range(mesh.indices, cached.vertex_cnt))
+                return fail();
+        }
+
+        if (cached.meshlet_count > 0 && !read_meshlets(view, cached, mesh.meshlets))
+            return fail();
+
+        if (cached.lod_count > 0)
+        {
+            if (!read_array(view, cached.lods_offset, cached.lod_count, mesh.lods))
+                return fail();
+            for (const auto& lod : mesh.lods)
+            {
+                if (uint64_t{ lod.index_offset } + lod.index_count > cached.index_cnt)
+                    return fail();
+            }
+        }
+
+        if (!read_skin_and_morph(view, cached, header->node_count, mesh))
+            return fail();
+    }
+
+    if (!read_animations(view, *header, out_scene))
+        return fail();
+
+    // 纹理
+    out_scene.textures.resize(header->texture_count);
+    for (uint32_t i = 0; i < header->texture_count; ++i)
+    {
+        if (!from_cached(view, out_scene.strings, textures[i], out_scene.textures[i]))
+            return fail();
+    }
+
+    // 材质
+    out_scene.materials.resize(header->material_count);
+    for (uint32_t i = 0; i < header->material_count; ++i)
+    {
+        if (!from_cached(out_scene.strings, materials[i], header->texture_count, out_scene.materials[i]))
+            return fail();
+    }
+
+    // Instance
+    const uint64_t refs_size = header->refs_count;
+    if (refs_size > UINT32_MAX)
+        return fail();
+    const auto* refs = view.get<uint32_t>(header->refs_offset, refs_size * 2);
+    if (!refs && refs_size != 0)
+        return fail();
+
+    out_scene.instance_mesh_refs.assign(refs, refs + refs_size);
+    out_scene.instance_material_refs.assign(refs + refs_size, refs + refs_size * 2);
+    for (uint64_t j = 0; j < refs_size; ++j)
+    {
+        if (out_scene.instance_mesh_refs[j] >= header->mesh_count ||
+            out_scene.instance_material_refs[j] >= header->material_count)
+            return fail();
+    }
+
+    out_scene.instances.resize(header->instance_count);
+    for (uint32_t i = 0; i < header->instance_count; ++i)
+    {
+        InstanceData& inst = out_scene.instances[i];
+        if (!from_cached(out_scene.strings, instances[i], refs_size, header->node_count, inst))
+            return fail();
+        out_scene.bounds = merge_aabb(out_scene.bounds, inst.world_bounds);
+    }
+
+    return true;
+}
+
+} // namespace truvixx
@@ -0,0 +1,143 @@
+#include "TruvixxAssimp/scene_diff.hpp"
+#include "TruvixxAssimp/hash.hpp"
+
+#include <algorithm>
+#include <bit>
+
+namespace truvixx
+{
+
+namespace
+{
+
+uint64_t combine(const uint64_t hash, const uint64_t value) noexcept
+{
+    return fnv1a(&value, sizeof(value), hash);
+}
+
+/// 可能为空的数组的哈希，空数组与不存在的流区分开
+uint64_t hash_stream(const uint64_t hash, const void* data, const size_t size) noexcept
+{
+    return combine(hash, data ? hash_blob(data, size) : 0);
+}
+
+uint64_t hash_mesh(const MeshInfo& mesh)
+{
+    const size_t vertex_bytes = static_cast<size_t>(mesh.vertex_cnt) * sizeof(TruvixxFloat3);
+
+    uint64_t hash = combine(FNV_OFFSET_BASIS, mesh.vertex_cnt);
+    hash = hash_stream(hash, mesh.positions, vertex_bytes);
+    hash = hash_stream(hash, mesh.normals, vertex_bytes);
+    hash = hash_stream(hash, mesh.tangents, vertex_bytes);
+    hash = hash_stream(hash, mesh.uvs, static_cast<size_t>(mesh.vertex_cnt) * sizeof(TruvixxFloat2));
+    hash = combine(hash, mesh.is_index16() ? 16 : 32);
+    if (mesh.is_index16())
+        hash = hash_stream(hash, mesh.indices16.data(), mesh.indices16.size() * sizeof(uint16_t));
+    else
+        hash = hash_stream(hash, mesh.indices.data(), mesh.indices.size() * sizeof(uint32_t));
+
+    // meshlet 由索引推导，不需要单独计入
+    for (const MeshLod& lod : mesh.lods)
+    {
+        hash = combine(hash, lod.index_offset);
+        hash = combine(hash, lod.index_count);
+    }
+
+    // 蒙皮与变形数据：重新刷权重、重新绑定或修改变形目标也需要重新上传
+    hash = combine(hash, mesh.skin.size());
+    hash = hash_stream(hash, mesh.skin.data(), mesh.skin.size() * sizeof(TruvixxSkinVertex));
+    hash = combine(hash, mesh.joint_nodes.size());
+    hash = hash_stream(hash, mesh.joint_nodes.data(), mesh.joint_nodes.size() * sizeof(uint32_t));
+    hash = combine(hash, mesh.inverse_binds.size());
+    hash = hash_stream(hash, mesh.inverse_binds.data(), mesh.inverse_binds.size() * sizeof(TruvixxFloat4x4));
+    hash = combine(hash, mesh.morph_targets.size());
+    for (const MorphTarget& target : mesh.morph_targets)
+    {
+        hash = combine(hash, target.delta_offset);
+        hash = combine(hash, target.delta_count);
+        hash = combine(hash, std::bit_cast<uint32_t>(target.default_weight));
+    }
+    hash = combine(hash, mesh.morph_deltas.size());
+    hash = hash_stream(hash, mesh.morph_deltas.data(), mesh.morph_deltas.size() * sizeof(TruvixxMorphDelta));
+    return hash;
+}
+
+/// 纹理以内容哈希计入，外部纹理文件被修改后材质也视为变化
+uint64_t hash_material(const MaterialData& mat, const SceneData& scene)
+{
+    uint64_t hash = FNV_OFFSET_BASIS;
+    for (const float v : mat.base_color.v)
+        hash = combine(hash, std::bit_cast<uint32_t>(v));
+    for (const float v : mat.emissive.v)
+        hash = combine(hash, std::bit_cast<uint32_t>(v));
+    hash = combine(hash, std::bit_cast<uint32_t>(mat.roughness));
+    hash = combine(hash, std::bit_cast<uint32_t>(mat.metallic));
+    hash = combine(hash, std::bit_cast<uint32_t>(mat.opacity));
+    for (const uint32_t texture : mat.textures)
+        hash = combine(hash, texture == NO_TEXTURE ? 0 : scene.textures[texture].hash);
+    return hash;
+}
+
+uint64_t hash_instances(const SceneData& scene)
+{
+    uint64_t hash = combine(FNV_OFFSET_BASIS, scene.instance_count());
+    for (const auto& instance : scene.instances)
+    {
+        hash = fnv1a(&instance.world_transform, sizeof(instance.world_transform), hash);
+        hash = combine(hash, instance.ref_offset);
+        hash = combine(hash, instance.ref_count);
+    }
+    hash = hash_stream(hash, scene.instance_mesh_refs.data(), scene.instance_mesh_refs.size() * sizeof(uint32_t));
+    hash = hash_stream(hash, scene.instance_material_refs.data(), scene.instance_material_refs.size() * sizeof(uint32_t));
+    return hash;
+}
+
+/// 按下标比较两组哈希
+void diff_hashes(
+    const std::vector<uint64_t>& before,
+    const std::vector<uint64_t>& after,
+    std::vector<uint32_t>& out_added,
+    std::vector<uint32_t>& out_removed,
+    std::vector<uint32_t>& out_changed
+)
+{
+    const size_t common = std::min(before.size(), after.size());
+    for (size_t i = 0; i < common; ++i)
+    {
+        if (before[i] != after[i])
+            out_changed.push_back(static_cast<uint32_t>(i));
+    }
+    for (size_t i = common; i < after.size(); ++i)
+        out_added.push_back(static_cast<uint32_t>(i));
+    for (size_t i = common; i < before.size(); ++i)
+        out_removed.push_back(static_cast<uint32_t>(i));
+}
+
+} // namespace
+
+SceneFingerprint fingerprint_scene(const SceneData& scene)
+{
+    SceneFingerprint result;
+
+    result.meshes.reserve(scene.mesh_count());
+    for (const auto& mesh : scene.mesh_infos)
+        result.meshes.push_back(hash_mesh(mesh));
+
+    result.materials.reserve(scene.material_count());
+    for (const auto& mat : scene.materials)
+        result.materials.push_back(hash_material(mat, scene));
+
+    result.instances = hash_instances(scene);
+    return result;
+}
+
+SceneDiff diff_scenes(const SceneFingerprint& before, const SceneFingerprint& after)
+{
+    SceneDiff diff;
+    diff_hashes(before.meshes, after.meshes, diff.added_meshes, diff.removed_meshes, diff.changed_meshes);
+    diff_hashes(before.materials, after.materials, diff.added_materials, diff.removed_materials, diff.changed_materials);
+    diff.instances_changed = before.instances != after.instances;
+    return diff;
+}
+
+} // namespace truvixx
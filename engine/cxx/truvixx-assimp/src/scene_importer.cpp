@@ -1,51 +1,294 @@
 #include "TruvixxAssimp/scene_importer.hpp"
+#include "TruvixxAssimp/animation_import.hpp"
+#include "TruvixxAssimp/bounds.hpp"
+#include "TruvixxAssimp/instance_batch.hpp"
+#include "TruvixxAssimp/load_stats.hpp"
+#include "TruvixxAssimp/mesh_lod.hpp"
+#include "TruvixxAssimp/mesh_merge.hpp"
+#include "TruvixxAssimp/mesh_optimize.hpp"
+#include "TruvixxAssimp/mesh_validate.hpp"
+#include "TruvixxAssimp/meshlet.hpp"
+#include "TruvixxAssimp/scene_cache.hpp"
+#include "TruvixxAssimp/simd_kernels.hpp"
+#include "TruvixxAssimp/texture_manifest.hpp"
+#include "TruvixxAssimp/thread_pool.hpp"
+#include "TruvixxAssimp/utf8_path.hpp"
+#include "TruvixxAssimp/vertex_arena.hpp"
 
 #include <assimp/Importer.hpp>
+#include <assimp/config.h>
 #include <assimp/postprocess.h>
 #include <assimp/scene.h>
 #include <assimp/matrix4x4.h>
+#include <algorithm>
+#include <cctype>
+#include <chrono>
 #include <deque>
 #include <format>
+#include <initializer_list>
 #include <iostream>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace truvixx
 {
 
+namespace
+{
+
+/// 补全属性依赖：切线由法线计算
+uint32_t resolve_attributes(const uint32_t attributes)
+{
+    return (attributes & VertexAttributeTangent) ? (attributes | VertexAttributeNormal) : attributes;
+}
+
+/// 加载选项 -> Assimp 后处理标志
+///
+/// 坐标系：右手系，X-Right，Y-Up (Assimp 默认)
+/// 三角形环绕：CCW (Assimp 默认)
+/// UV 原点：左上角 (通过 FlipUVs，同时翻转材质的 UV 变换)
+/// 矩阵存储：row-major (Assimp 默认，转换时处理)
+unsigned int to_ai_flags(const uint32_t post_process, const uint32_t attributes, const bool import_animation)
+{
+    unsigned int flags = aiProcess_JoinIdenticalVertices | // 去重顶点，生成索引
+        aiProcess_Triangulate |                            // 三角化
+        aiProcess_SortByPType |                            // 按图元类型排序
+        aiProcess_FlipUVs;                                 // UV 翻转为左上角原点
+
+    const bool keep_normal = attributes & VertexAttributeNormal;
+    const bool keep_tangent = attributes & VertexAttributeTangent;
+
+    if (keep_normal && (post_process & PostProcessGenNormals))
+        flags |= aiProcess_GenNormals; // 生成法线（如果没有）
+    if (keep_tangent && (post_process & PostProcessCalcTangents))
+        flags |= aiProcess_CalcTangentSpace; // 生成切线空间
+    if (post_process & PostProcessImproveCacheLocality)
+        flags |= aiProcess_ImproveCacheLocality;
+    if (post_process & PostProcessOptimizeMeshes)
+        flags |= aiProcess_OptimizeMeshes;
+    if (post_process & PostProcessRemoveRedundantMaterials)
+        flags |= aiProcess_RemoveRedundantMaterials;
+
+    if (attributes != VertexAttributeAll)
+        flags |= aiProcess_RemoveComponent;
+
+    // 蒙皮：每个顶点最多 4 个骨骼影响，单个 mesh 的骨骼数不超过 8 位关节下标的范围
+    if (import_animation)
+        flags |= aiProcess_LimitBoneWeights | aiProcess_SplitByBoneCount;
+
+    return flags;
+}
+
+/// 需要移除的 Assimp 组件 (AI_CONFIG_PP_RVC_FLAGS)
+int to_ai_removed_components(const uint32_t attributes)
+{
+    int components = 0;
+    if (!(attributes & VertexAttributeNormal))
+        components |= aiComponent_NORMALS;
+    if (!(attributes & VertexAttributeTangent))
+        components |= aiComponent_TANGENTS_AND_BITANGENTS;
+    if (!(attributes & VertexAttributeUv))
+        components |= aiComponent_TEXCOORDS;
+    return components;
+}
+
+/// Assimp 后处理之后仍不是三角形的面 (点、线)，转换时会被丢弃
+uint32_t count_non_triangle_faces(const aiMesh* mesh)
+{
+    constexpr unsigned int non_triangle = aiPrimitiveType_POINT | aiPrimitiveType_LINE | aiPrimitiveType_POLYGON;
+    if (!(mesh->mPrimitiveTypes & non_triangle))
+        return 0;
+
+    uint32_t count = 0;
+    for (unsigned int f = 0; f < mesh->mNumFaces; ++f)
+        count += mesh->mFaces[f].mNumIndices != 3;
+    return count;
+}
+
+uint64_t count_non_triangle_faces(const aiScene* scene)
+{
+    uint64_t count = 0;
+    for (unsigned int i = 0; i < scene->mNumMeshes; ++i)
+        count += count_non_triangle_faces(scene->mMeshes[i]);
+    return count;
+}
+
+/// 外部纹理的格式提示：小写扩展名，不含 '.'
+std::string extension_hint(const std::filesystem::path& path)
+{
+    std::string ext = path_to_utf8(path.extension());
+    if (!ext.empty())
+        ext.erase(0, 1);
+    std::ranges::transform(ext, ext.begin(), [](const unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return ext;
+}
+
+/// 导入时读取的其他文件，主文件已由缓存键校验
+/// @return 有文件无法访问时返回 std::nullopt，此时不写入缓存
+std::optional<std::vector<SceneCacheDependency>> collect_dependencies(
+    MappedIOSystem& io_system,
+    const SceneCacheKey& key
+)
+{
+    std::vector<SceneCacheDependency> dependencies;
+    for (const auto& file : io_system.take_opened_files())
+    {
+        auto dependency = SceneCacheDependency::make(file);
+        if (!dependency)
+            return std::nullopt;
+        if (dependency->path != key.source_path)
+            dependencies.push_back(std::move(*dependency));
+    }
+    return dependencies;
+}
+
+/// Assimp 行主序矩阵 -> 列主序
+/// Assimp: a1-a4 是第1行
+/// 我们: m[0-3] 是第1列
+TruvixxFloat4x4 to_column_major(const aiMatrix4x4& m)
+{
+    static_assert(sizeof(aiMatrix4x4) == sizeof(float) * 16, "aiMatrix4x4 must be 16 contiguous floats");
+
+    TruvixxFloat4x4 result;
+    transpose_4x4(&m.a1, result.m);
+    return result;
+}
+
+/// 行主序矩阵乘法 parent * local，结果与 aiMatrix4x4::operator* 一致
+aiMatrix4x4 concat_transform(const aiMatrix4x4& parent, const aiMatrix4x4& local)
+{
+    aiMatrix4x4 result;
+    multiply_4x4(&parent.a1, &local.a1, &result.a1);
+    return result;
+}
+
+} // namespace
+
 SceneImporter::SceneImporter()
     : importer_(std::make_unique<Assimp::Importer>())
+    , io_system_(new MappedIOSystem)
+    , cache_dir_(default_scene_cache_dir())
 {
+    // importer_ 接管 io_system_ 的所有权
+    importer_->SetIOHandler(io_system_);
 }
 
 SceneImporter::~SceneImporter() = default;
 
-bool SceneImporter::load(const std::filesystem::path& path)
+bool SceneImporter::load(const std::filesystem::path& path, const SceneLoadOptions& options)
 {
     // 清理之前的状态
     clear();
+    const auto load_start = std::chrono::steady_clock::now();
 
     // 验证文件存在
     if (!std::filesystem::exists(path) || !std::filesystem::is_regular_file(path))
     {
-        std::cerr << std::format("File not found: {}", path.string()) << "\n";
+        std::cerr << std::format("File not found: {}", path_to_utf8(path)) << "\n";
         return false;
     }
 
     dir_ = path.parent_path();
 
+    const unsigned int flags = to_ai_flags(options.post_process, resolve_attributes(options.attributes), options.import_animation);
+    const auto cache_key = cache_dir_.empty() ? std::nullopt : SceneCacheKey::make(path, flags, options);
+    return import_scene(options, cache_key, load_start, [&] { return importer_->ReadFile(path_to_utf8(path), 0); });
+}
+
+bool SceneImporter::load_from_memory(
+    const std::span<const std::byte> data,
+    std::string_view format_hint,
+    const SceneLoadOptions& options,
+    const std::filesystem::path& base_dir
+)
+{
+    clear();
+    const auto load_start = std::chrono::steady_clock::now();
+
+    if (data.empty())
+    {
+        std::cerr << "Empty scene buffer\n";
+        return false;
+    }
+
+    // Assimp 的格式提示不带 '.'
+    if (format_hint.starts_with('.'))
+        format_hint.remove_prefix(1);
+    const std::string hint(format_hint);
+
+    dir_ = base_dir;
+
+    const unsigned int flags = to_ai_flags(options.post_process, resolve_attributes(options.attributes), options.import_animation);
+    const auto cache_key =
+        cache_dir_.empty() ? std::nullopt : SceneCacheKey::make(data, hint, base_dir, flags, options);
+
+    // 场景内引用的其他文件 (.bin / .mtl 等) 仍然经过 io_system_ 读取，相对 base_dir 解析
+    io_system_->set_base_dir(base_dir);
+    const bool loaded = import_scene(options, cache_key, load_start, [&] {
+        return importer_->ReadFileFromMemory(data.data(), data.size(), 0, hint.c_str());
+    });
+    io_system_->set_base_dir({});
+    return loaded;
+}
+
+bool SceneImporter::import_scene(
+    const SceneLoadOptions& options,
+    const std::optional<SceneCacheKey>& cache_key,
+    const std::chrono::steady_clock::time_point load_start,
+    const std::function<const aiScene*()>& read_source
+)
+{
+    const ProfileZoneHook& profile = options.on_profile_zone;
+
     // Assimp 后处理标志
-    // 坐标系：右手系，X-Right，Y-Up (Assimp 默认)
-    // 三角形环绕：CCW (Assimp 默认)
-    // UV 原点：左上角 (通过 FlipUVs)
-    // 矩阵存储：row-major (Assimp 默认，转换时处理)
-    constexpr unsigned int flags = aiProcess_CalcTangentSpace | // 生成切线空间
-        aiProcess_JoinIdenticalVertices |                       // 去重顶点，生成索引
-        aiProcess_Triangulate |                                 // 三角化
-        aiProcess_GenNormals |                                  // 生成法线（如果没有）
-        aiProcess_SortByPType |                                 // 按图元类型排序
-        aiProcess_FlipUVs;                                      // UV 翻转为左上角原点
-
-    // 加载场景
-    ai_scene_ = importer_->ReadFile(path.string(), flags);
+    const uint32_t attributes = resolve_attributes(options.attributes);
+    const unsigned int flags = to_ai_flags(options.post_process, attributes, options.import_animation);
+
+    // 优先从缓存加载，跳过 Assimp 导入和后处理
+    const auto cache_path = cache_key ? scene_cache_path(cache_dir_, *cache_key) : std::filesystem::path{};
+    bool cache_hit = false;
+    if (cache_key)
+    {
+        LoadZone zone(stats_, LoadPhase::CacheRead, profile);
+        cache_hit = read_scene_cache(cache_path, *cache_key, cache_file_, scene_data_);
+    }
+    if (cache_hit)
+    {
+        // 外部纹理可能在场景文件之外被修改，哈希需要重新计算
+        publish_textures(options, false);
+        if (options.on_meshes_allocated)
+            options.on_meshes_allocated(scene_data_.mesh_count());
+        if (options.on_mesh_ready)
+        {
+            for (uint32_t i = 0; i < scene_data_.mesh_count(); ++i)
+                options.on_mesh_ready(i);
+        }
+        build_derived_data(options);
+
+        is_loaded_ = true;
+        finish_stats(load_start);
+        return true;
+    }
+
+    // 加载场景：解析与后处理分开执行，以便分别计时
+    importer_->SetPropertyInteger(AI_CONFIG_PP_RVC_FLAGS, to_ai_removed_components(attributes));
+    importer_->SetPropertyInteger(AI_CONFIG_PP_LBW_MAX_WEIGHTS, 4);
+    importer_->SetPropertyInteger(AI_CONFIG_PP_SBBC_MAX_BONES, static_cast<int>(MAX_SKIN_JOINTS));
+    // 丢弃之前失败的加载留下的记录，只保留本次导入读取的文件
+    (void)io_system_->take_opened_files();
+    {
+        LoadZone zone(stats_, LoadPhase::Parse, profile);
+        ai_scene_ = read_source();
+    }
+    // 场景引用的 .bin / .mtl 等文件随缓存一起校验，只检查主文件会读到过期的几何数据
+    const auto dependencies = cache_key ? collect_dependencies(*io_system_, *cache_key) : std::nullopt;
+    if (ai_scene_)
+    {
+        LoadZone zone(stats_, LoadPhase::PostProcess, profile);
+        ai_scene_ = importer_->ApplyPostProcessing(flags);
+    }
 
     if (!ai_scene_ || (ai_scene_->mFlags & AI_SCENE_FLAGS_INCOMPLETE) || !ai_scene_->mRootNode)
     {
@@ -53,29 +296,259 @@ bool SceneImporter::load(const std::filesystem::path& path)
         return false;
     }
 
-    // 处理材质
-    scene_data_.materials.reserve(ai_scene_->mNumMaterials);
-    for (unsigned int i = 0; i < ai_scene_->mNumMaterials; ++i)
+    stats_.dropped_face_count = count_non_triangle_faces(ai_scene_);
     {
-        scene_data_.materials.emplace_back();
-        process_material(ai_scene_->mMaterials[i], scene_data_.materials.back());
+        aiMemoryInfo memory;
+        importer_->GetMemoryRequirements(memory);
+        stats_.source_bytes = memory.total;
     }
 
-    // 处理 Mesh
-    scene_data_.mesh_infos.reserve(ai_scene_->mNumMeshes);
-    for (unsigned int i = 0; i < ai_scene_->mNumMeshes; ++i)
+    // 处理材质和 Mesh
+    // 输出预先分配好，每个下标只写自己的槽位，因此并行与串行的结果一致
+    scene_data_.materials.resize(ai_scene_->mNumMaterials);
     {
-        scene_data_.mesh_infos.emplace_back();
-        process_mesh_info(ai_scene_->mMeshes[i], scene_data_.mesh_infos.back());
+        LoadZone zone(stats_, LoadPhase::Materials, profile);
+        std::vector<MaterialStrings> material_strings(ai_scene_->mNumMaterials);
+        for_each_index(options.parallel, ai_scene_->mNumMaterials, [&](const uint32_t i) {
+            process_material(ai_scene_->mMaterials[i], scene_data_.materials[i], material_strings[i]);
+        });
+
+        // 字符串表不是线程安全的，串行写入
+        build_texture_manifest(material_strings);
+    }
+
+    // 紧凑模式下 aiScene 会在加载结束时释放，内嵌纹理需要先拷贝出来，保证回调拿到的 data 一直有效
+    if (options.release_source)
+        pack_embedded_textures(scene_data_);
+    publish_textures(options, true);
+
+    // 节点树先于 mesh 建立，蒙皮的关节按节点名解析为节点下标
+    NodeLookup node_lookup;
+    if (options.import_animation)
+    {
+        LoadZone zone(stats_, LoadPhase::Animations, profile);
+        node_lookup = import_skeleton(ai_scene_->mRootNode, scene_data_);
+    }
+    const NodeLookup* skin_lookup = options.import_animation ? &node_lookup : nullptr;
+
+    {
+        LoadZone zone(stats_, LoadPhase::Meshes, profile);
+        plan_meshes(options, attributes);
+        const uint32_t mesh_count = mesh_plan_.output_count();
+
+        scene_data_.mesh_infos.resize(mesh_count);
+        if (options.on_meshes_allocated)
+            options.on_meshes_allocated(scene_data_.mesh_count());
+
+        // 紧凑模式：按 aiMesh 的顶点数预先划分 arena (后续阶段只会减少顶点)，
+        // 每个 mesh 处理完立即搬入，保证 on_mesh_ready 之后该 mesh 不再被修改
+        std::vector<size_t> arena_offsets;
+        if (options.release_source)
+        {
+            arena_offsets.resize(mesh_count);
+            size_t arena_size = 0;
+            for (uint32_t i = 0; i < mesh_count; ++i)
+            {
+                // 同一输出 mesh 的源 mesh 顶点属性一致
+                const auto sources = mesh_plan_.sources_of(i);
+                const aiMesh* mesh = ai_scene_->mMeshes[sources.front()];
+                uint32_t vertex_count = 0;
+                for (const uint32_t source : sources)
+                    vertex_count += ai_scene_->mMeshes[source]->mNumVertices;
+
+                arena_offsets[i] = arena_size;
+                arena_size += packed_stream_size(
+                    vertex_count,
+                    (attributes & VertexAttributeNormal) && mesh->HasNormals(),
+                    (attributes & VertexAttributeTangent) && mesh->HasTangentsAndBitangents(),
+                    attributes & VertexAttributeUv
+                );
+            }
+            scene_data_.vertex_arena = std::make_unique_for_overwrite<std::byte[]>(arena_size);
+            scene_data_.vertex_arena_size = arena_size;
+        }
+
+        for_each_index(options.parallel, mesh_count, [&](const uint32_t i) {
+            MeshInfo& mesh = scene_data_.mesh_infos[i];
+            {
+                LoadZone step(stats_, LoadPhase::MeshConvert, profile);
+                build_output_mesh(i, attributes, skin_lookup, mesh);
+            }
+            // 越界索引会让后续的 meshopt 步骤越界访问，校验必须最先执行
+            if (options.validate_meshes)
+            {
+                LoadZone step(stats_, LoadPhase::MeshValidate, profile);
+                validate_mesh(mesh);
+                for (const uint32_t source : mesh_plan_.sources_of(i))
+                    mesh.validation.dropped_faces += count_non_triangle_faces(ai_scene_->mMeshes[source]);
+            }
+            if (options.optimize_meshes)
+            {
+                LoadZone step(stats_, LoadPhase::MeshOptimize, profile);
+                optimize_mesh(mesh);
+            }
+            if (options.build_meshlets)
+            {
+                LoadZone step(stats_, LoadPhase::MeshMeshlets, profile);
+                build_meshlets(mesh);
+            }
+            if (!options.lod_levels.empty())
+            {
+                LoadZone step(stats_, LoadPhase::MeshLods, profile);
+                build_lods(mesh, options.lod_levels);
+            }
+            if (options.compact_indices)
+            {
+                LoadZone step(stats_, LoadPhase::MeshCompactIndex, profile);
+                compact_indices(mesh);
+            }
+            if (options.release_source)
+            {
+                LoadZone step(stats_, LoadPhase::MeshPack, profile);
+                pack_mesh_streams(mesh, scene_data_.vertex_arena.get() + arena_offsets[i]);
+            }
+
+            if (options.on_mesh_ready)
+                options.on_mesh_ready(i);
+        });
+    }
+
+    // 变形通道需要 mesh 的变形目标数量，在 mesh 之后重采样
+    if (options.import_animation)
+    {
+        LoadZone zone(stats_, LoadPhase::Animations, profile);
+        const AnimationImportSettings settings{ .sample_rate = options.animation_sample_rate, .quantize = options.quantize_animation };
+        import_animations(ai_scene_, node_lookup, mesh_plan_.output_of_source, settings, scene_data_);
     }
 
     // 处理节点树
-    process_nodes(ai_scene_->mRootNode);
+    {
+        LoadZone zone(stats_, LoadPhase::Nodes, profile);
+        process_nodes(ai_scene_->mRootNode);
+    }
+    build_derived_data(options);
+
+    // 所有数据都已转换为自身持有，不再需要 aiScene
+    if (options.release_source)
+    {
+        importer_->FreeScene();
+        ai_scene_ = nullptr;
+    }
 
     is_loaded_ = true;
+
+    // 写入缓存失败不影响本次加载
+    if (cache_key && dependencies)
+    {
+        LoadZone zone(stats_, LoadPhase::CacheWrite, profile);
+        if (!write_scene_cache(cache_path, *cache_key, scene_data_, *dependencies))
+            std::cerr << std::format("Failed to write scene cache: {}", path_to_utf8(cache_path)) << "\n";
+    }
+
+    finish_stats(load_start);
     return true;
 }
 
+void SceneImporter::build_texture_manifest(const std::span<const MaterialStrings> material_strings)
+{
+    // 外部纹理以绝对路径去重，内嵌纹理以 aiScene::mTextures 下标去重
+    std::unordered_map<std::string, uint32_t> texture_of_key;
+
+    for (size_t i = 0; i < material_strings.size(); ++i)
+    {
+        const MaterialStrings& strings = material_strings[i];
+        MaterialData& mat = scene_data_.materials[i];
+        mat.name = scene_data_.strings.intern(strings.name);
+
+        for (size_t slot = 0; slot < TEXTURE_SLOT_COUNT; ++slot)
+        {
+            const std::string& ref = strings.textures[slot];
+            if (ref.empty())
+                continue;
+
+            const auto [embedded, embedded_idx] = ai_scene_->GetEmbeddedTextureAndIndex(ref.c_str());
+            const std::filesystem::path full_path =
+                embedded ? std::filesystem::path{} : (dir_ / utf8_to_path(ref)).lexically_normal();
+            std::string key = embedded ? std::format("*{}", embedded_idx) : path_to_utf8(full_path);
+
+            const auto [it, inserted] = texture_of_key.try_emplace(std::move(key), scene_data_.texture_count());
+            if (inserted)
+            {
+                TextureData& texture = scene_data_.textures.emplace_back();
+                texture.embedded = embedded != nullptr;
+                if (embedded)
+                {
+                    // mHeight 为 0 表示压缩格式 (png / jpg ...)，mWidth 为字节数；否则为 mWidth * mHeight 个 BGRA8 texel
+                    const bool compressed = embedded->mHeight == 0;
+                    texture.path = scene_data_.strings.intern(ref);
+                    texture.format_hint = scene_data_.strings.intern(compressed ? embedded->achFormatHint : "bgra8");
+                    texture.data = reinterpret_cast<const std::byte*>(embedded->pcData);
+                    texture.size = compressed ? embedded->mWidth
+                                              : static_cast<uint64_t>(embedded->mWidth) * embedded->mHeight * sizeof(aiTexel);
+                    texture.width = compressed ? 0 : embedded->mWidth;
+                    texture.height = compressed ? 0 : embedded->mHeight;
+                }
+                else
+                {
+                    texture.path = scene_data_.strings.intern(it->first);
+                    texture.format_hint = scene_data_.strings.intern(extension_hint(full_path));
+                }
+            }
+            mat.textures[slot] = it->second;
+        }
+
+        // 兼容只认路径的使用方：diffuse_map / normal_map 只记录外部纹理
+        auto external_path = [&](const TextureSlot slot) -> StringRef {
+            const uint32_t texture_idx = mat.texture(slot);
+            if (texture_idx == NO_TEXTURE || scene_data_.textures[texture_idx].embedded)
+                return {};
+            return scene_data_.textures[texture_idx].path;
+        };
+        mat.diffuse_map = external_path(TextureSlot::BaseColor);
+        mat.normal_map = external_path(TextureSlot::Normal);
+    }
+}
+
+void SceneImporter::publish_textures(const SceneLoadOptions& options, const bool hash_embedded)
+{
+    LoadZone zone(stats_, LoadPhase::Textures, options.on_profile_zone);
+
+    // 只读访问字符串表，可以并行
+    for_each_index(options.parallel, scene_data_.texture_count(), [&](const uint32_t i) {
+        TextureData& texture = scene_data_.textures[i];
+        const std::string_view path = scene_data_.strings.view(texture.path);
+        if (hash_embedded || !texture.embedded)
+            hash_texture(path, texture);
+
+        if (options.on_texture_ready)
+            options.on_texture_ready(i, texture, path, scene_data_.strings.view(texture.format_hint));
+    });
+}
+
+void SceneImporter::build_derived_data(const SceneLoadOptions& options)
+{
+    if (options.build_instance_batches)
+    {
+        LoadZone zone(stats_, LoadPhase::InstanceBatches, options.on_profile_zone);
+        build_instance_batches(scene_data_);
+    }
+    if (options.build_instance_bvh)
+    {
+        LoadZone zone(stats_, LoadPhase::InstanceBvh, options.on_profile_zone);
+        build_instance_bvh(scene_data_);
+    }
+}
+
+void SceneImporter::finish_stats(const std::chrono::steady_clock::time_point load_start)
+{
+    collect_scene_counters(scene_data_, stats_);
+    stats_.mapped_bytes = cache_file_.size();
+    stats_.from_cache = cache_file_.is_open();
+    stats_.total_ns = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - load_start).count()
+    );
+}
+
 const SceneData& SceneImporter::get_scene() const noexcept
 {
     return scene_data_;
@@ -86,35 +559,71 @@ bool SceneImporter::is_loaded() const noexcept
     return is_loaded_;
 }
 
-TruvixxFloat3* SceneImporter::get_position(const uint32_t mesh_idx) const
+bool SceneImporter::is_from_cache() const noexcept
 {
-    const auto ai_mesh = ai_scene_->mMeshes[mesh_idx];
-    static_assert(sizeof(aiVector3D) == sizeof(TruvixxFloat3), "Size mismatch between aiVector3D and TruvixxFloat3");
-    return reinterpret_cast<TruvixxFloat3*>(ai_mesh->mVertices);
+    return cache_file_.is_open();
 }
 
-TruvixxFloat3* SceneImporter::get_normal(const uint32_t mesh_idx) const
+const LoadStats& SceneImporter::get_stats() const noexcept
 {
-    const auto ai_mesh = ai_scene_->mMeshes[mesh_idx];
-    static_assert(sizeof(aiVector3D) == sizeof(TruvixxFloat3), "Size mismatch between aiVector3D and TruvixxFloat3");
-    return reinterpret_cast<TruvixxFloat3*>(ai_mesh->mNormals);
+    return stats_;
 }
 
-TruvixxFloat3* SceneImporter::get_tangent(const uint32_t mesh_idx) const
+bool SceneImporter::reload(const std::filesystem::path& path, const SceneLoadOptions& options)
 {
-    const auto ai_mesh = ai_scene_->mMeshes[mesh_idx];
-    static_assert(sizeof(aiVector3D) == sizeof(TruvixxFloat3), "Size mismatch between aiVector3D and TruvixxFloat3");
-    return reinterpret_cast<TruvixxFloat3*>(ai_mesh->mTangents);
+    // 旧场景在 load() 开始时就会被清空，先取出它的指纹
+    SceneFingerprint before;
+    if (is_loaded_)
+        before = has_fingerprint_ ? std::move(fingerprint_) : fingerprint_scene(scene_data_);
+
+    if (!load(path, options))
+        return false;
+
+    fingerprint_ = fingerprint_scene(scene_data_);
+    has_fingerprint_ = true;
+    diff_ = diff_scenes(before, fingerprint_);
+    return true;
+}
+
+const SceneDiff& SceneImporter::get_diff() const noexcept
+{
+    return diff_;
+}
+
+void SceneImporter::set_cache_dir(std::filesystem::path cache_dir)
+{
+    cache_dir_ = std::move(cache_dir);
+}
+
+const TruvixxFloat3* SceneImporter::get_position(const uint32_t mesh_idx) const
+{
+    return scene_data_.mesh_infos[mesh_idx].positions;
+}
+
+const TruvixxFloat3* SceneImporter::get_normal(const uint32_t mesh_idx) const
+{
+    return scene_data_.mesh_infos[mesh_idx].normals;
+}
+
+const TruvixxFloat3* SceneImporter::get_tangent(const uint32_t mesh_idx) const
+{
+    return scene_data_.mesh_infos[mesh_idx].tangents;
 }
 
 void SceneImporter::clear()
 {
     scene_data_ = {};
+    mesh_plan_ = {};
+    stats_ = {};
+    fingerprint_ = {};
+    has_fingerprint_ = false;
+    diff_ = {};
     ai_scene_ = nullptr;
+    cache_file_.close();
     is_loaded_ = false;
 
-    // 重置 Importer（释放之前加载的场景）
-    importer_ = std::make_unique<Assimp::Importer>();
+    // 只释放之前加载的场景，Importer 本身 (注册的格式和后处理步骤) 跨加载复用
+    importer_->FreeScene();
 }
 
 void SceneImporter::process_nodes(const aiNode* root_node)
@@ -122,20 +631,42 @@ void SceneImporter::process_nodes(const aiNode* root_node)
     if (!root_node)
         return;
 
+    // 预先统计节点数和引用数，实例和引用数组各只分配一次
+    size_t node_count = 0;
+    size_t ref_count = 0;
+    {
+        std::vector<const aiNode*> stack{ root_node };
+        while (!stack.empty())
+        {
+            const aiNode* node = stack.back();
+            stack.pop_back();
+            ++node_count;
+            ref_count += node->mNumMeshes;
+            stack.insert(stack.end(), node->mChildren, node->mChildren + node->mNumChildren);
+        }
+    }
+    scene_data_.instances.reserve(node_count + 1);
+    scene_data_.instance_mesh_refs.reserve(ref_count);
+    scene_data_.instance_material_refs.reserve(ref_count);
+
     // BFS 遍历节点树
     std::deque<std::pair<const aiNode*, aiMatrix4x4>> queue;
     queue.emplace_back(root_node, aiMatrix4x4()); // 根节点，单位矩阵
 
+    // 导入动画时实例记录对应的节点，节点顺序与 import_skeleton() 的层序一致
+    const bool has_nodes = !scene_data_.skeleton_nodes.empty();
+    uint32_t node_idx = 0;
     while (!queue.empty())
     {
         auto [node, parent_transform] = queue.front();
         queue.pop_front();
 
         // 处理当前节点
-        process_node(node, parent_transform);
+        process_node(node, parent_transform, has_nodes ? node_idx : NO_NODE);
+        ++node_idx;
 
         // 计算当前累积变换
-        aiMatrix4x4 current_transform = parent_transform * node->mTransformation;
+        aiMatrix4x4 current_transform = concat_transform(parent_transform, node->mTransformation);
 
         // 将子节点加入队列
         for (unsigned int i = 0; i < node->mNumChildren; ++i)
@@ -143,59 +674,171 @@ void SceneImporter::process_nodes(const aiNode* root_node)
             queue.emplace_back(node->mChildren[i], current_transform);
         }
     }
+
+    // 合并后的 mesh 已在世界空间，由一个单位变换的实例统一引用
+    if (!mesh_plan_.merge_groups.empty())
+    {
+        InstanceData merged;
+        merged.name = scene_data_.strings.intern("merged_static_meshes");
+        merged.ref_offset = static_cast<uint32_t>(scene_data_.instance_mesh_refs.size());
+        merged.ref_count = static_cast<uint32_t>(mesh_plan_.merge_groups.size());
+
+        const auto first_merged = static_cast<uint32_t>(mesh_plan_.kept_sources.size());
+        for (uint32_t g = 0; g < merged.ref_count; ++g)
+        {
+            scene_data_.instance_mesh_refs.push_back(first_merged + g);
+            scene_data_.instance_material_refs.push_back(mesh_plan_.merge_groups[g].material_index);
+            merged.world_bounds = merge_aabb(merged.world_bounds, scene_data_.mesh_infos[first_merged + g].bounds);
+        }
+        scene_data_.instances.push_back(merged);
+    }
+
+    for (const auto& instance : scene_data_.instances)
+        scene_data_.bounds = merge_aabb(scene_data_.bounds, instance.world_bounds);
 }
 
-void SceneImporter::process_node(const aiNode* node, const aiMatrix4x4& parent_transform)
+void SceneImporter::plan_meshes(const SceneLoadOptions& options, const uint32_t attributes)
+{
+    const uint32_t mesh_count = ai_scene_->mNumMeshes;
+
+    mesh_plan_ = {};
+    mesh_plan_.skip_empty_nodes = options.skip_empty_nodes;
+    mesh_plan_.output_of_source.assign(mesh_count, MeshPlan::MERGED);
+
+    std::vector<bool> merged(mesh_count, false);
+    if (options.merge_static_meshes)
+    {
+        // 统计每个 mesh 的引用次数，并记录引用处的世界变换
+        std::vector<uint32_t> ref_counts(mesh_count, 0);
+        std::vector<aiMatrix4x4> world_of_source(mesh_count);
+        std::vector<std::pair<const aiNode*, aiMatrix4x4>> stack;
+        stack.emplace_back(ai_scene_->mRootNode, aiMatrix4x4());
+        while (!stack.empty())
+        {
+            const auto [node, parent_transform] = stack.back();
+            stack.pop_back();
+
+            const aiMatrix4x4 world = concat_transform(parent_transform, node->mTransformation);
+            for (unsigned int i = 0; i < node->mNumMeshes; ++i)
+            {
+                ++ref_counts[node->mMeshes[i]];
+                world_of_source[node->mMeshes[i]] = world;
+            }
+            for (unsigned int i = 0; i < node->mNumChildren; ++i)
+                stack.emplace_back(node->mChildren[i], world);
+        }
+
+        // 只被引用一次的 mesh 按 (材质, normal, tangent) 分组，组内按 aiMesh 顺序排列
+        // 导入动画时蒙皮和带变形目标的 mesh 需要保留自身的顶点空间，不参与合并
+        std::unordered_map<uint64_t, uint32_t> group_of_key;
+        for (uint32_t i = 0; i < mesh_count; ++i)
+        {
+            if (ref_counts[i] != 1)
+                continue;
+
+            const aiMesh* mesh = ai_scene_->mMeshes[i];
+            if (options.import_animation && (mesh->HasBones() || mesh->mNumAnimMeshes > 0))
+                continue;
+            const bool has_normal = (attributes & VertexAttributeNormal) && mesh->HasNormals();
+            const bool has_tangent = (attributes & VertexAttributeTangent) && mesh->HasTangentsAndBitangents();
+            const uint64_t key = (uint64_t{ mesh->mMaterialIndex } << 2) | (has_normal ? 1u : 0u) | (has_tangent ? 2u : 0u);
+
+            const auto [it, inserted] =
+                group_of_key.try_emplace(key, static_cast<uint32_t>(mesh_plan_.merge_groups.size()));
+            if (inserted)
+                mesh_plan_.merge_groups.emplace_back().material_index = mesh->mMaterialIndex;
+
+            auto& group = mesh_plan_.merge_groups[it->second];
+            group.sources.push_back(i);
+            group.transforms.push_back(to_column_major(world_of_source[i]));
+        }
+
+        // 只有一个成员的组合并没有收益，保持原样
+        std::erase_if(mesh_plan_.merge_groups, [](const MergeGroup& group) { return group.sources.size() < 2; });
+        for (const auto& group : mesh_plan_.merge_groups)
+        {
+            for (const uint32_t source : group.sources)
+                merged[source] = true;
+        }
+    }
+
+    for (uint32_t i = 0; i < mesh_count; ++i)
+    {
+        if (merged[i])
+            continue;
+        mesh_plan_.output_of_source[i] = static_cast<uint32_t>(mesh_plan_.kept_sources.size());
+        mesh_plan_.kept_sources.push_back(i);
+    }
+}
+
+void SceneImporter::build_output_mesh(
+    const uint32_t output_idx,
+    const uint32_t attributes,
+    const NodeLookup* skin_lookup,
+    MeshInfo& out_mesh
+) const
+{
+    if (output_idx < mesh_plan_.kept_sources.size())
+    {
+        const aiMesh* mesh = ai_scene_->mMeshes[mesh_plan_.kept_sources[output_idx]];
+        process_mesh_info(mesh, attributes, out_mesh);
+        if (skin_lookup)
+        {
+            import_skin(mesh, *skin_lookup, out_mesh);
+            import_morph_targets(mesh, out_mesh);
+        }
+        return;
+    }
+
+    const MergeGroup& group = mesh_plan_.merge_groups[output_idx - mesh_plan_.kept_sources.size()];
+    std::vector<MeshInfo> source_meshes(group.sources.size());
+    std::vector<MeshMergeSource> sources(group.sources.size());
+    for (size_t i = 0; i < group.sources.size(); ++i)
+    {
+        process_mesh_info(ai_scene_->mMeshes[group.sources[i]], attributes, source_meshes[i]);
+        sources[i] = MeshMergeSource{ .mesh = &source_meshes[i], .transform = group.transforms[i] };
+    }
+    merge_meshes(sources, out_mesh);
+}
+
+void SceneImporter::process_node(const aiNode* node, const aiMatrix4x4& parent_transform, const uint32_t node_idx)
 {
     if (!node)
         return;
 
     InstanceData instance;
+    instance.node = node_idx;
 
     // 名称
-    instance.name = node->mName.C_Str();
+    instance.name = scene_data_.strings.intern({ node->mName.C_Str(), node->mName.length });
 
     // 世界变换矩阵 (Assimp row-major -> 我们 column-major)
-    aiMatrix4x4 world = parent_transform * node->mTransformation;
-
-    // 转换为列主序
-    // Assimp: a1-a4 是第1行
-    // 我们: m[0-3] 是第1列
-    instance.world_transform.m[0] = world.a1;
-    instance.world_transform.m[1] = world.b1;
-    instance.world_transform.m[2] = world.c1;
-    instance.world_transform.m[3] = world.d1;
-
-    instance.world_transform.m[4] = world.a2;
-    instance.world_transform.m[5] = world.b2;
-    instance.world_transform.m[6] = world.c2;
-    instance.world_transform.m[7] = world.d2;
-
-    instance.world_transform.m[8] = world.a3;
-    instance.world_transform.m[9] = world.b3;
-    instance.world_transform.m[10] = world.c3;
-    instance.world_transform.m[11] = world.d3;
-
-    instance.world_transform.m[12] = world.a4;
-    instance.world_transform.m[13] = world.b4;
-    instance.world_transform.m[14] = world.c4;
-    instance.world_transform.m[15] = world.d4;
-
-    // Mesh 和材质引用
-    instance.mesh_indices.reserve(node->mNumMeshes);
-    instance.material_indices.reserve(node->mNumMeshes);
+    instance.world_transform = to_column_major(concat_transform(parent_transform, node->mTransformation));
+
+    // Mesh 和材质引用，被合并的 mesh 改由合并实例引用
+    instance.ref_offset = static_cast<uint32_t>(scene_data_.instance_mesh_refs.size());
 
     for (unsigned int i = 0; i < node->mNumMeshes; ++i)
     {
         unsigned int mesh_idx = node->mMeshes[i];
-        instance.mesh_indices.push_back(mesh_idx);
-        instance.material_indices.push_back(ai_scene_->mMeshes[mesh_idx]->mMaterialIndex);
+        const uint32_t output_idx = mesh_plan_.output_of_source[mesh_idx];
+        if (output_idx == MeshPlan::MERGED)
+            continue;
+        scene_data_.instance_mesh_refs.push_back(output_idx);
+        scene_data_.instance_material_refs.push_back(ai_scene_->mMeshes[mesh_idx]->mMaterialIndex);
+
+        const TruvixxAabb& mesh_bounds = scene_data_.mesh_infos[output_idx].bounds;
+        instance.world_bounds = merge_aabb(instance.world_bounds, transform_aabb(mesh_bounds, instance.world_transform));
     }
+    instance.ref_count = static_cast<uint32_t>(scene_data_.instance_mesh_refs.size()) - instance.ref_offset;
+
+    if (mesh_plan_.skip_empty_nodes && instance.ref_count == 0)
+        return;
 
-    scene_data_.instances.push_back(std::move(instance));
+    scene_data_.instances.push_back(instance);
 }
 
-void SceneImporter::process_mesh_info(const aiMesh* mesh, MeshInfo& out_mesh)
+void SceneImporter::process_mesh_info(const aiMesh* mesh, const uint32_t attributes, MeshInfo& out_mesh)
 {
     if (!mesh)
         return;
@@ -204,18 +847,29 @@ void SceneImporter::process_mesh_info(const aiMesh* mesh, MeshInfo& out_mesh)
     const unsigned int face_count = mesh->mNumFaces;
 
     out_mesh.vertex_cnt = vertex_count;
-    out_mesh.has_normal = mesh->HasNormals();
-    out_mesh.has_tangent = mesh->HasTangentsAndBitangents();
+    out_mesh.has_normal = (attributes & VertexAttributeNormal) && mesh->HasNormals();
+    out_mesh.has_tangent = (attributes & VertexAttributeTangent) && mesh->HasTangentsAndBitangents();
 
-    // UV (只取第一套)
-    out_mesh.uvs.resize(static_cast<size_t>(vertex_count), { .x = 0.f, .y = 0.f });
-    if (mesh->HasTextureCoords(0))
+    // 顶点流直接引用 aiMesh 的数据
+    static_assert(sizeof(aiVector3D) == sizeof(TruvixxFloat3), "Size mismatch between aiVector3D and TruvixxFloat3");
+    out_mesh.positions = reinterpret_cast<const TruvixxFloat3*>(mesh->mVertices);
+    out_mesh.normals = out_mesh.has_normal ? reinterpret_cast<const TruvixxFloat3*>(mesh->mNormals) : nullptr;
+    out_mesh.tangents = out_mesh.has_tangent ? reinterpret_cast<const TruvixxFloat3*>(mesh->mTangents) : nullptr;
+
+    // UV (只取第一套)，缺失时以 0 填充
+    if (attributes & VertexAttributeUv)
     {
-        for (unsigned int i = 0; i < vertex_count; ++i)
+        out_mesh.uv_storage.resize(static_cast<size_t>(vertex_count), { .x = 0.f, .y = 0.f });
+        if (mesh->HasTextureCoords(0))
         {
-            out_mesh.uvs[i].x = mesh->mTextureCoords[0][i].x;
-            out_mesh.uvs[i].y = mesh->mTextureCoords[0][i].y;
+            copy_uvs(
+                reinterpret_cast<const TruvixxFloat3*>(mesh->mTextureCoords[0]),
+                vertex_count,
+                false,
+                out_mesh.uv_storage.data()
+            );
         }
+        out_mesh.uvs = out_mesh.uv_storage.data();
     }
 
     // indices
@@ -232,9 +886,15 @@ void SceneImporter::process_mesh_info(const aiMesh* mesh, MeshInfo& out_mesh)
         out_mesh.indices.push_back(face.mIndices[1]);
         out_mesh.indices.push_back(face.mIndices[2]);
     }
+
+    out_mesh.bounds = compute_aabb(out_mesh.positions, vertex_count);
 }
 
-void SceneImporter::process_material(const aiMaterial* material, MaterialData& out_material) const
+void SceneImporter::process_material(
+    const aiMaterial* material,
+    MaterialData& out_material,
+    MaterialStrings& out_strings
+)
 {
     if (!material)
         return;
@@ -242,17 +902,16 @@ void SceneImporter::process_material(const aiMaterial* material, MaterialData& o
     aiString out_str;
     aiColor4D out_color;
     ai_real out_real;
-    // 纹理路径辅助函数
-    auto get_texture_path = [&](const aiTextureType type) -> std::string {
-        if (material->GetTextureCount(type) == 0)
-            return {};
-
-        aiString tex_path;
-        if (material->GetTexture(type, 0, &tex_path) == AI_SUCCESS)
+    // 纹理引用辅助函数：按顺序取第一个存在的纹理类型，路径在 build_texture_manifest() 中解析
+    auto get_texture_ref = [&](const std::initializer_list<aiTextureType> types) -> std::string {
+        for (const aiTextureType type : types)
         {
-            // 转换为绝对路径
-            const std::filesystem::path full_path = dir_ / tex_path.C_Str();
-            return full_path.string();
+            if (material->GetTextureCount(type) == 0)
+                continue;
+
+            aiString tex_path;
+            if (material->GetTexture(type, 0, &tex_path) == AI_SUCCESS && tex_path.length > 0)
+                return tex_path.C_Str();
         }
         return {};
     };
@@ -260,7 +919,7 @@ void SceneImporter::process_material(const aiMaterial* material, MaterialData& o
     // name
     if (material->Get(AI_MATKEY_NAME, out_str) == AI_SUCCESS)
     {
-        out_material.name = out_str.C_Str();
+        out_strings.name = out_str.C_Str();
     }
 
     // base color
@@ -299,8 +958,15 @@ void SceneImporter::process_material(const aiMaterial* material, MaterialData& o
         out_material.opacity = out_real;
     }
 
-    out_material.diffuse_map = get_texture_path(aiTextureType_DIFFUSE);
-    out_material.normal_map = get_texture_path(aiTextureType_NORMALS);
+    auto& textures = out_strings.textures;
+    textures[static_cast<size_t>(TextureSlot::BaseColor)] = get_texture_ref({ aiTextureType_BASE_COLOR, aiTextureType_DIFFUSE });
+    textures[static_cast<size_t>(TextureSlot::Normal)] = get_texture_ref({ aiTextureType_NORMALS });
+    textures[static_cast<size_t>(TextureSlot::MetallicRoughness)] =
+        get_texture_ref({ aiTextureType_METALNESS, aiTextureType_DIFFUSE_ROUGHNESS });
+    textures[static_cast<size_t>(TextureSlot::Emissive)] =
+        get_texture_ref({ aiTextureType_EMISSION_COLOR, aiTextureType_EMISSIVE });
+    textures[static_cast<size_t>(TextureSlot::Occlusion)] =
+        get_texture_ref({ aiTextureType_AMBIENT_OCCLUSION, aiTextureType_LIGHTMAP });
 }
 
 } // namespace truvixx
\ No newline at end of file
@@ -0,0 +1,114 @@
+#include "TruvixxAssimp/shared_materials.hpp"
+#include "TruvixxAssimp/hash.hpp"
+
+#include <array>
+#include <bit>
+#include <unordered_map>
+#include <utility>
+
+namespace truvixx
+{
+
+namespace
+{
+
+/// 材质去重的键：PBR 参数的位模式 + 各槽位去重后的纹理下标
+struct MaterialKey
+{
+    std::array<uint32_t, 11 + TEXTURE_SLOT_COUNT> bits{};
+
+    bool operator==(const MaterialKey&) const = default;
+};
+
+struct MaterialKeyHash
+{
+    size_t operator()(const MaterialKey& key) const noexcept
+    {
+        return static_cast<size_t>(fnv1a(key.bits.data(), sizeof(key.bits)));
+    }
+};
+
+/// @param textures 已替换为共享纹理下标的槽位
+MaterialKey make_key(const MaterialData& mat, const std::array<uint32_t, TEXTURE_SLOT_COUNT>& textures)
+{
+    MaterialKey key;
+    size_t i = 0;
+    for (const float v : mat.base_color.v)
+        key.bits[i++] = std::bit_cast<uint32_t>(v);
+    for (const float v : mat.emissive.v)
+        key.bits[i++] = std::bit_cast<uint32_t>(v);
+    key.bits[i++] = std::bit_cast<uint32_t>(mat.roughness);
+    key.bits[i++] = std::bit_cast<uint32_t>(mat.metallic);
+    key.bits[i++] = std::bit_cast<uint32_t>(mat.opacity);
+    for (const uint32_t texture : textures)
+        key.bits[i++] = texture;
+    return key;
+}
+
+/// 纹理去重的键
+struct TextureKeyHash
+{
+    size_t operator()(const std::pair<uint64_t, uint64_t>& key) const noexcept
+    {
+        return static_cast<size_t>(key.first ^ (key.second * FNV_PRIME));
+    }
+};
+
+} // namespace
+
+SharedMaterials build_shared_materials(const std::span<const SceneData* const> scenes)
+{
+    SharedMaterials result;
+    result.remap_offsets.reserve(scenes.size());
+
+    std::unordered_map<MaterialKey, uint32_t, MaterialKeyHash> material_of_key;
+    std::unordered_map<std::pair<uint64_t, uint64_t>, uint32_t, TextureKeyHash> texture_of_key;
+    std::vector<uint32_t> scene_texture_remap;
+
+    for (const SceneData* scene : scenes)
+    {
+        result.remap_offsets.push_back(static_cast<uint32_t>(result.remap.size()));
+        if (!scene)
+            continue;
+
+        // 场景纹理 -> 去重后的纹理
+        scene_texture_remap.resize(scene->texture_count());
+        for (uint32_t i = 0; i < scene->texture_count(); ++i)
+        {
+            const TextureData& texture = scene->textures[i];
+            const auto [it, inserted] = texture_of_key.try_emplace(
+                std::pair{ texture.hash, texture.size }, static_cast<uint32_t>(result.textures.size())
+            );
+            if (inserted)
+            {
+                TextureData& shared = result.textures.emplace_back(texture);
+                shared.path = result.strings.intern(scene->strings.view(texture.path));
+                shared.format_hint = result.strings.intern(scene->strings.view(texture.format_hint));
+            }
+            scene_texture_remap[i] = it->second;
+        }
+
+        for (const auto& mat : scene->materials)
+        {
+            std::array<uint32_t, TEXTURE_SLOT_COUNT> textures;
+            for (size_t slot = 0; slot < TEXTURE_SLOT_COUNT; ++slot)
+                textures[slot] = mat.textures[slot] == NO_TEXTURE ? NO_TEXTURE : scene_texture_remap[mat.textures[slot]];
+
+            const auto [it, inserted] =
+                material_of_key.try_emplace(make_key(mat, textures), static_cast<uint32_t>(result.materials.size()));
+            if (inserted)
+            {
+                MaterialData& shared = result.materials.emplace_back(mat);
+                shared.name = result.strings.intern(scene->strings.view(mat.name));
+                shared.diffuse_map = result.strings.intern(scene->strings.view(mat.diffuse_map));
+                shared.normal_map = result.strings.intern(scene->strings.view(mat.normal_map));
+                shared.textures = textures;
+            }
+            result.remap.push_back(it->second);
+        }
+    }
+
+    return result;
+}
+
+} // namespace truvixx
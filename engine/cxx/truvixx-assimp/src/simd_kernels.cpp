@@ -0,0 +1,353 @@
+#include "TruvixxAssimp/simd_kernels.hpp"
+
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#define TRUVIXX_SIMD_SSE2 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define TRUVIXX_TARGET_AVX2
+#else
+#define TRUVIXX_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#define TRUVIXX_SIMD_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace truvixx
+{
+
+namespace
+{
+
+void copy_uvs_scalar(const TruvixxFloat3* src, const uint32_t begin, const uint32_t count, const bool flip_v, TruvixxFloat2* dst)
+{
+    for (uint32_t i = begin; i < count; ++i)
+    {
+        dst[i].x = src[i].x;
+        dst[i].y = flip_v ? 1.f - src[i].y : src[i].y;
+    }
+}
+
+void min_max_float3_scalar(
+    const TruvixxFloat3* src,
+    const uint32_t begin,
+    const uint32_t count,
+    TruvixxFloat3& in_out_min,
+    TruvixxFloat3& in_out_max
+)
+{
+    for (uint32_t i = begin; i < count; ++i)
+    {
+        for (int c = 0; c < 3; ++c)
+        {
+            in_out_min.v[c] = std::min(in_out_min.v[c], src[i].v[c]);
+            in_out_max.v[c] = std::max(in_out_max.v[c], src[i].v[c]);
+        }
+    }
+}
+
+#if TRUVIXX_SIMD_SSE2
+
+bool detect_avx2()
+{
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 1);
+    const bool os_xsave = (info[2] & (1 << 27)) != 0;
+    const bool avx = (info[2] & (1 << 28)) != 0;
+    if (!os_xsave || !avx || (_xgetbv(0) & 0x6) != 0x6)
+        return false;
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+
+/// 4 个顶点 = 12 个 float = 3 个寄存器：
+/// r0 = x0 y0 z0 x1 | r1 = y1 z1 x2 y2 | r2 = z2 x3 y3 z3
+uint32_t copy_uvs_sse2(const TruvixxFloat3* src, const uint32_t count, const bool flip_v, TruvixxFloat2* dst)
+{
+    // 只替换 y 分量，x 原样保留
+    const __m128 one = _mm_set1_ps(1.f);
+    const __m128 y_mask = _mm_castsi128_ps(_mm_setr_epi32(0, -1, 0, -1));
+    auto flip = [&](const __m128 v) {
+        return flip_v ? _mm_or_ps(_mm_andnot_ps(y_mask, v), _mm_and_ps(y_mask, _mm_sub_ps(one, v))) : v;
+    };
+
+    uint32_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        const float* s = &src[i].x;
+        const __m128 r0 = _mm_loadu_ps(s);
+        const __m128 r1 = _mm_loadu_ps(s + 4);
+        const __m128 r2 = _mm_loadu_ps(s + 8);
+
+        const __m128 t = _mm_shuffle_ps(r0, r1, _MM_SHUFFLE(0, 0, 3, 3));  // x1 x1 y1 y1
+        const __m128 o0 = _mm_shuffle_ps(r0, t, _MM_SHUFFLE(2, 0, 1, 0));  // x0 y0 x1 y1
+        const __m128 o1 = _mm_shuffle_ps(r1, r2, _MM_SHUFFLE(2, 1, 3, 2)); // x2 y2 x3 y3
+
+        float* d = &dst[i].x;
+        _mm_storeu_ps(d, flip(o0));
+        _mm_storeu_ps(d + 4, flip(o1));
+    }
+    return i;
+}
+
+/// 寄存器布局与 copy_uvs_sse2() 相同，第 k 个 float 属于分量 k % 3
+uint32_t min_max_float3_sse2(const TruvixxFloat3* src, const uint32_t count, TruvixxFloat3& in_out_min, TruvixxFloat3& in_out_max)
+{
+    if (count < 4)
+        return 0;
+
+    const float* s = &src[0].x;
+    __m128 min0 = _mm_loadu_ps(s), min1 = _mm_loadu_ps(s + 4), min2 = _mm_loadu_ps(s + 8);
+    __m128 max0 = min0, max1 = min1, max2 = min2;
+    uint32_t i = 4;
+    for (; i + 4 <= count; i += 4)
+    {
+        const float* p = s + static_cast<size_t>(i) * 3;
+        const __m128 r0 = _mm_loadu_ps(p);
+        const __m128 r1 = _mm_loadu_ps(p + 4);
+        const __m128 r2 = _mm_loadu_ps(p + 8);
+        min0 = _mm_min_ps(min0, r0);
+        min1 = _mm_min_ps(min1, r1);
+        min2 = _mm_min_ps(min2, r2);
+        max0 = _mm_max_ps(max0, r0);
+        max1 = _mm_max_ps(max1, r1);
+        max2 = _mm_max_ps(max2, r2);
+    }
+
+    float mn[12], mx[12];
+    _mm_storeu_ps(mn, min0);
+    _mm_storeu_ps(mn + 4, min1);
+    _mm_storeu_ps(mn + 8, min2);
+    _mm_storeu_ps(mx, max0);
+    _mm_storeu_ps(mx + 4, max1);
+    _mm_storeu_ps(mx + 8, max2);
+    for (int k = 0; k < 12; ++k)
+    {
+        in_out_min.v[k % 3] = std::min(in_out_min.v[k % 3], mn[k]);
+        in_out_max.v[k % 3] = std::max(in_out_max.v[k % 3], mx[k]);
+    }
+    return i;
+}
+
+/// 8 个顶点 = 24 个 float = 3 个寄存器，跨 lane 置换后混合
+TRUVIXX_TARGET_AVX2 uint32_t copy_uvs_avx2(const TruvixxFloat3* src, const uint32_t count, const bool flip_v, TruvixxFloat2* dst)
+{
+    const __m256 one = _mm256_set1_ps(1.f);
+
+    // 输出 float k 在源中的下标为 k / 2 * 3 + k % 2
+    const __m256i perm_v0_lo = _mm256_setr_epi32(0, 1, 3, 4, 6, 7, 0, 0); // o0[0..5]
+    const __m256i perm_v1_lo = _mm256_setr_epi32(0, 0, 0, 0, 0, 0, 1, 2); // o0[6..7]
+    const __m256i perm_v1_hi = _mm256_setr_epi32(4, 5, 7, 0, 0, 0, 0, 0); // o1[0..2]
+    const __m256i perm_v2_hi = _mm256_setr_epi32(0, 0, 0, 0, 2, 3, 5, 6); // o1[3..7]
+
+    uint32_t i = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        const float* s = &src[i].x;
+        const __m256 v0 = _mm256_loadu_ps(s);
+        const __m256 v1 = _mm256_loadu_ps(s + 8);
+        const __m256 v2 = _mm256_loadu_ps(s + 16);
+
+        const __m256 o0 = _mm256_blend_ps(
+            _mm256_permutevar8x32_ps(v0, perm_v0_lo),
+            _mm256_permutevar8x32_ps(v1, perm_v1_lo),
+            0b11000000
+        );
+        const __m256 o1 = _mm256_blend_ps(
+            _mm256_permutevar8x32_ps(v1, perm_v1_hi),
+            _mm256_permutevar8x32_ps(v2, perm_v2_hi),
+            0b11111000
+        );
+
+        // 奇数 lane 为 y 分量
+        float* d = &dst[i].x;
+        _mm256_storeu_ps(d, flip_v ? _mm256_blend_ps(o0, _mm256_sub_ps(one, o0), 0b10101010) : o0);
+        _mm256_storeu_ps(d + 8, flip_v ? _mm256_blend_ps(o1, _mm256_sub_ps(one, o1), 0b10101010) : o1);
+    }
+    return i;
+}
+
+#elif TRUVIXX_SIMD_NEON
+
+uint32_t copy_uvs_neon(const TruvixxFloat3* src, const uint32_t count, const bool flip_v, TruvixxFloat2* dst)
+{
+    const float32x4_t one = vdupq_n_f32(1.f);
+
+    uint32_t i = 0;
+    for (; i + 4 <= count; i += 4)
+    {
+        // 按分量解交错读取，再交错写回 xy
+        const float32x4x3_t v = vld3q_f32(&src[i].x);
+        float32x4x2_t out;
+        out.val[0] = v.val[0];
+        out.val[1] = flip_v ? vsubq_f32(one, v.val[1]) : v.val[1];
+        vst2q_f32(&dst[i].x, out);
+    }
+    return i;
+}
+
+uint32_t min_max_float3_neon(const TruvixxFloat3* src, const uint32_t count, TruvixxFloat3& in_out_min, TruvixxFloat3& in_out_max)
+{
+    if (count < 4)
+        return 0;
+
+    // 按分量解交错读取，每个寄存器只含一个分量
+    float32x4x3_t mn = vld3q_f32(&src[0].x);
+    float32x4x3_t mx = mn;
+    uint32_t i = 4;
+    for (; i + 4 <= count; i += 4)
+    {
+        const float32x4x3_t v = vld3q_f32(&src[i].x);
+        for (int c = 0; c < 3; ++c)
+        {
+            mn.val[c] = vminq_f32(mn.val[c], v.val[c]);
+            mx.val[c] = vmaxq_f32(mx.val[c], v.val[c]);
+        }
+    }
+    for (int c = 0; c < 3; ++c)
+    {
+        in_out_min.v[c] = std::min(in_out_min.v[c], vminvq_f32(mn.val[c]));
+        in_out_max.v[c] = std::max(in_out_max.v[c], vmaxvq_f32(mx.val[c]));
+    }
+    return i;
+}
+
+#endif
+
+SimdLevel detect_simd_level()
+{
+#if TRUVIXX_SIMD_SSE2
+    return detect_avx2() ? SimdLevel::Avx2 : SimdLevel::Sse2;
+#elif TRUVIXX_SIMD_NEON
+    return SimdLevel::Neon;
+#else
+    return SimdLevel::Scalar;
+#endif
+}
+
+} // namespace
+
+SimdLevel simd_level() noexcept
+{
+    static const SimdLevel level = detect_simd_level();
+    return level;
+}
+
+const char* simd_level_name(const SimdLevel level) noexcept
+{
+    switch (level)
+    {
+    case SimdLevel::Sse2:
+        return "SSE2";
+    case SimdLevel::Avx2:
+        return "AVX2";
+    case SimdLevel::Neon:
+        return "NEON";
+    case SimdLevel::Scalar:
+    default:
+        return "Scalar";
+    }
+}
+
+void copy_uvs(const TruvixxFloat3* src, const uint32_t count, const bool flip_v, TruvixxFloat2* dst) noexcept
+{
+    uint32_t done = 0;
+#if TRUVIXX_SIMD_SSE2
+    done = simd_level() == SimdLevel::Avx2 ? copy_uvs_avx2(src, count, flip_v, dst) : 0;
+    done += copy_uvs_sse2(src + done, count - done, flip_v, dst + done);
+#elif TRUVIXX_SIMD_NEON
+    done = copy_uvs_neon(src, count, flip_v, dst);
+#endif
+    copy_uvs_scalar(src, done, count, flip_v, dst);
+}
+
+void min_max_float3(const TruvixxFloat3* src, const uint32_t count, TruvixxFloat3& in_out_min, TruvixxFloat3& in_out_max) noexcept
+{
+    uint32_t done = 0;
+#if TRUVIXX_SIMD_SSE2
+    done = min_max_float3_sse2(src, count, in_out_min, in_out_max);
+#elif TRUVIXX_SIMD_NEON
+    done = min_max_float3_neon(src, count, in_out_min, in_out_max);
+#endif
+    min_max_float3_scalar(src, done, count, in_out_min, in_out_max);
+}
+
+void transpose_4x4(const float* src, float* dst) noexcept
+{
+#if TRUVIXX_SIMD_SSE2
+    __m128 r0 = _mm_loadu_ps(src);
+    __m128 r1 = _mm_loadu_ps(src + 4);
+    __m128 r2 = _mm_loadu_ps(src + 8);
+    __m128 r3 = _mm_loadu_ps(src + 12);
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+    _mm_storeu_ps(dst, r0);
+    _mm_storeu_ps(dst + 4, r1);
+    _mm_storeu_ps(dst + 8, r2);
+    _mm_storeu_ps(dst + 12, r3);
+#elif TRUVIXX_SIMD_NEON
+    // vld4q 按 4 路解交错读取，第 k 路恰好是第 k 列
+    const float32x4x4_t m = vld4q_f32(src);
+    vst1q_f32(dst, m.val[0]);
+    vst1q_f32(dst + 4, m.val[1]);
+    vst1q_f32(dst + 8, m.val[2]);
+    vst1q_f32(dst + 12, m.val[3]);
+#else
+    for (int r = 0; r < 4; ++r)
+        for (int c = 0; c < 4; ++c)
+            dst[c * 4 + r] = src[r * 4 + c];
+#endif
+}
+
+void multiply_4x4(const float* a, const float* b, float* dst) noexcept
+{
+    // dst 的第 r 行 = sum_k a[r][k] * b 的第 k 行
+#if TRUVIXX_SIMD_SSE2
+    const __m128 b0 = _mm_loadu_ps(b);
+    const __m128 b1 = _mm_loadu_ps(b + 4);
+    const __m128 b2 = _mm_loadu_ps(b + 8);
+    const __m128 b3 = _mm_loadu_ps(b + 12);
+    for (int r = 0; r < 4; ++r)
+    {
+        const float* row = a + r * 4;
+        __m128 acc = _mm_mul_ps(_mm_set1_ps(row[0]), b0);
+        acc = _mm_add_ps(acc, _mm_mul_ps(_mm_set1_ps(row[1]), b1));
+        acc = _mm_add_ps(acc, _mm_mul_ps(_mm_set1_ps(row[2]), b2));
+        acc = _mm_add_ps(acc, _mm_mul_ps(_mm_set1_ps(row[3]), b3));
+        _mm_storeu_ps(dst + r * 4, acc);
+    }
+#elif TRUVIXX_SIMD_NEON
+    const float32x4_t b0 = vld1q_f32(b);
+    const float32x4_t b1 = vld1q_f32(b + 4);
+    const float32x4_t b2 = vld1q_f32(b + 8);
+    const float32x4_t b3 = vld1q_f32(b + 12);
+    for (int r = 0; r < 4; ++r)
+    {
+        const float* row = a + r * 4;
+        float32x4_t acc = vmulq_n_f32(b0, row[0]);
+        acc = vmlaq_n_f32(acc, b1, row[1]);
+        acc = vmlaq_n_f32(acc, b2, row[2]);
+        acc = vmlaq_n_f32(acc, b3, row[3]);
+        vst1q_f32(dst + r * 4, acc);
+    }
+#else
+    for (int r = 0; r < 4; ++r)
+    {
+        for (int c = 0; c < 4; ++c)
+        {
+            float sum = 0.f;
+            for (int k = 0; k < 4; ++k)
+                sum += a[r * 4 + k] * b[k * 4 + c];
+            dst[r * 4 + c] = sum;
+        }
+    }
+#endif
+}
+
+} // namespace truvixx
@@ -0,0 +1,136 @@
+#include "TruvixxAssimp/string_table.hpp"
+
+namespace truvixx
+{
+
+namespace
+{
+
+/// FNV-1a 32 bit
+uint32_t hash_string(const std::string_view str) noexcept
+{
+    uint32_t hash = 0x811c9dc5u;
+    for (const char c : str)
+    {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 0x01000193u;
+    }
+    return hash;
+}
+
+constexpr size_t INITIAL_SLOT_COUNT = 64;
+
+} // namespace
+
+StringTable::StringTable()
+{
+    clear();
+}
+
+StringRef StringTable::intern(const std::string_view str)
+{
+    if (str.empty())
+        return {};
+
+    const size_t mask = slots_.size() - 1;
+    size_t slot = hash_string(str) & mask;
+    while (const uint32_t entry = slots_[slot])
+    {
+        const StringRef ref = entries_[entry - 1];
+        if (view(ref) == str)
+            return ref;
+        slot = (slot + 1) & mask;
+    }
+
+    const StringRef ref{ .offset = static_cast<uint32_t>(blob_.size()), .length = static_cast<uint32_t>(str.size()) };
+    blob_.append(str);
+    blob_.push_back('\0');
+
+    // 负载因子不超过 1/2
+    entries_.push_back(ref);
+    if (entries_.size() * 2 > slots_.size())
+        rehash(slots_.size() * 2);
+    else
+        slots_[slot] = static_cast<uint32_t>(entries_.size());
+
+    return ref;
+}
+
+std::string_view StringTable::view(const StringRef ref) const noexcept
+{
+    return { blob_.data() + ref.offset, ref.length };
+}
+
+const char* StringTable::c_str(const StringRef ref) const noexcept
+{
+    return blob_.data() + ref.offset;
+}
+
+bool StringTable::is_valid(const StringRef ref) const noexcept
+{
+    return ref.offset < blob_.size() && ref.length < blob_.size() - ref.offset && blob_[ref.offset + ref.length] == '\0';
+}
+
+const char* StringTable::data() const noexcept
+{
+    return blob_.data();
+}
+
+size_t StringTable::size() const noexcept
+{
+    return blob_.size();
+}
+
+bool StringTable::assign(const char* blob, const size_t size)
+{
+    if (!blob || size == 0 || blob[0] != '\0' || blob[size - 1] != '\0')
+    {
+        clear();
+        return false;
+    }
+
+    blob_.assign(blob, size);
+    entries_.clear();
+
+    // 按 '\0' 切分重建索引，跳过偏移 0 处的空字符串
+    for (size_t offset = 1; offset < blob_.size();)
+    {
+        const size_t end = blob_.find('\0', offset);
+        if (end > offset)
+            entries_.push_back({ .offset = static_cast<uint32_t>(offset), .length = static_cast<uint32_t>(end - offset) });
+        offset = end + 1;
+    }
+
+    size_t slot_count = INITIAL_SLOT_COUNT;
+    while (entries_.size() * 2 > slot_count)
+        slot_count *= 2;
+    rehash(slot_count);
+    return true;
+}
+
+void StringTable::clear()
+{
+    blob_.assign(1, '\0');
+    entries_.clear();
+    slots_.assign(INITIAL_SLOT_COUNT, 0);
+}
+
+void StringTable::rehash(const size_t slot_count)
+{
+    slots_.assign(slot_count, 0);
+    for (uint32_t i = 0; i < entries_.size(); ++i)
+        insert_slot(i);
+}
+
+void StringTable::insert_slot(const uint32_t entry_idx)
+{
+    const size_t mask = slots_.size() - 1;
+    size_t slot = hash_string(view(entries_[entry_idx])) & mask;
+    while (slots_[slot])
+        slot = (slot + 1) & mask;
+
+    // 重复的字符串 (来自外部 blob) 也会被索引，查找时先命中的那份即可
+    slots_[slot] = entry_idx + 1;
+}
+
+} // namespace truvixx
@@ -0,0 +1,58 @@
+#include "TruvixxAssimp/texture_manifest.hpp"
+#include "TruvixxAssimp/hash.hpp"
+#include "TruvixxAssimp/utf8_path.hpp"
+
+#include <cstring>
+#include <filesystem>
+#include <system_error>
+
+namespace truvixx
+{
+
+void hash_texture(const std::string_view path, TextureData& texture)
+{
+    if (texture.embedded)
+    {
+        texture.hash = hash_blob(texture.data, texture.size);
+        return;
+    }
+
+    // 外部纹理不读取内容：路径 + 大小 + 修改时间足以发现文件变化，代价只是一次 stat
+    std::error_code ec;
+    const std::filesystem::path file = utf8_to_path(path);
+    const auto size = std::filesystem::file_size(file, ec);
+    texture.size = ec ? 0 : static_cast<uint64_t>(size);
+    const auto mtime = std::filesystem::last_write_time(file, ec);
+    const int64_t mtime_count = ec ? 0 : static_cast<int64_t>(mtime.time_since_epoch().count());
+
+    uint64_t hash = fnv1a(path.data(), path.size());
+    hash = fnv1a(&texture.size, sizeof(texture.size), hash);
+    texture.hash = fnv1a(&mtime_count, sizeof(mtime_count), hash);
+}
+
+void pack_embedded_textures(SceneData& scene)
+{
+    size_t arena_size = 0;
+    for (const auto& texture : scene.textures)
+    {
+        if (texture.embedded)
+            arena_size += texture.size;
+    }
+    if (arena_size == 0)
+        return;
+
+    scene.texture_arena = std::make_unique_for_overwrite<std::byte[]>(arena_size);
+    scene.texture_arena_size = arena_size;
+
+    std::byte* dst = scene.texture_arena.get();
+    for (auto& texture : scene.textures)
+    {
+        if (!texture.embedded)
+            continue;
+        std::memcpy(dst, texture.data, texture.size);
+        texture.data = dst;
+        dst += texture.size;
+    }
+}
+
+} // namespace truvixx
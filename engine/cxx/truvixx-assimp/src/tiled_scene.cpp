@@ -0,0 +1,739 @@
+#include "TruvixxAssimp/tiled_scene.hpp"
+#include "TruvixxAssimp/bounds.hpp"
+#include "TruvixxAssimp/cache_io.hpp"
+#include "TruvixxAssimp/thread_pool.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <system_error>
+#include <utility>
+
+namespace truvixx
+{
+
+namespace
+{
+
+// 分块场景文件布局 (offset 均相对文件起始，16 字节对齐，见 cache_io.hpp)
+//
+// | TiledHeader | mesh chunk (顶点流 / 索引 / LOD 表) ... | 内嵌纹理数据 ... | refs (uint32) | 字符串 blob |
+// | CachedChunk[] | CachedTile[] | tile_instances | tile_meshes |
+// | CachedMaterial[] | CachedInstance[] | CachedTexture[] |
+//
+// mesh chunk 按所属 tile 的顺序写入，同一 tile 的 mesh 在文件中相邻，读入时访问的页面集中
+
+constexpr char TILED_MAGIC[8] = { 'T', 'V', 'X', 'T', 'I', 'L', 'E', 'D' };
+
+struct TiledHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t _pad0;
+    uint64_t file_size;
+
+    uint32_t mesh_count;
+    uint32_t material_count;
+    uint32_t instance_count;
+    uint32_t texture_count;
+    uint32_t tile_count;
+    uint32_t _pad1;
+
+    uint64_t chunks_offset;
+    uint64_t tiles_offset;
+    uint64_t tile_instance_count;
+    uint64_t tile_instances_offset;
+    uint64_t tile_mesh_count;
+    uint64_t tile_meshes_offset;
+    uint64_t materials_offset;
+    uint64_t instances_offset;
+    uint64_t textures_offset;
+    uint64_t refs_offset;
+    uint64_t refs_count; ///< mesh 引用数量，材质引用数量与之相同
+    uint64_t strings_offset;
+    uint64_t strings_size;
+};
+
+struct CachedChunk
+{
+    uint32_t vertex_cnt;
+    uint32_t index_cnt;
+    uint32_t lod_count;
+    uint32_t index16;
+    uint32_t has_normal;
+    uint32_t has_tangent;
+    uint32_t _pad0[2];
+
+    uint64_t positions_offset; ///< 0 表示不存在
+    uint64_t normals_offset;
+    uint64_t tangents_offset;
+    uint64_t uvs_offset;
+    uint64_t indices_offset;
+    uint64_t lods_offset;
+
+    TruvixxAabb bounds;
+};
+
+struct CachedTile
+{
+    TruvixxAabb bounds;
+    uint32_t instance_offset;
+    uint32_t instance_count;
+    uint32_t mesh_offset;
+    uint32_t mesh_count;
+};
+
+/// mesh 常驻时占用的内存，与 TiledScene::load_mesh 分配的一致
+uint64_t chunk_bytes(const CachedChunk& chunk)
+{
+    const uint64_t float3_streams = (chunk.positions_offset ? 1 : 0) + (chunk.normals_offset ? 1 : 0) +
+                                    (chunk.tangents_offset ? 1 : 0);
+    const uint64_t index_size = chunk.index16 ? sizeof(uint16_t) : sizeof(uint32_t);
+    return uint64_t{ chunk.vertex_cnt } * float3_streams * sizeof(TruvixxFloat3) +
+           (chunk.uvs_offset ? uint64_t{ chunk.vertex_cnt } * sizeof(TruvixxFloat2) : 0) +
+           (chunk.indices_offset ? uint64_t{ chunk.index_cnt } * index_size : 0) +
+           uint64_t{ chunk.lod_count } * sizeof(MeshLod);
+}
+
+/// 与写入后的 chunk_bytes 一致，用于分块时估算 tile 大小
+uint64_t mesh_bytes(const MeshInfo& mesh)
+{
+    const uint64_t float3_streams = (mesh.positions ? 1 : 0) + (mesh.has_normal && mesh.normals ? 1 : 0) +
+                                    (mesh.has_tangent && mesh.tangents ? 1 : 0);
+    const uint64_t index_bytes = mesh.is_index16() ? mesh.indices16.size() * sizeof(uint16_t)
+                                                   : mesh.indices.size() * sizeof(uint32_t);
+    return uint64_t{ mesh.vertex_cnt } * float3_streams * sizeof(TruvixxFloat3) +
+           (mesh.uvs ? uint64_t{ mesh.vertex_cnt } * sizeof(TruvixxFloat2) : 0) + index_bytes +
+           mesh.lods.size() * sizeof(MeshLod);
+}
+
+/// 实例的代表点：包围盒中心，空包围盒取平移
+TruvixxFloat3 instance_centre(const InstanceData& inst)
+{
+    const TruvixxAabb& b = inst.world_bounds;
+    if (is_empty(b))
+        return { .x = inst.world_transform.m03, .y = inst.world_transform.m13, .z = inst.world_transform.m23 };
+    return { .x = (b.min.x + b.max.x) * 0.5f, .y = (b.min.y + b.max.y) * 0.5f, .z = (b.min.z + b.max.z) * 0.5f };
+}
+
+/// 递归切分实例集合，叶子写入 tile 表
+struct TileBuilder
+{
+    const SceneData& scene;
+    const TileBuildSettings& settings;
+    std::span<const uint64_t> mesh_sizes;
+    std::span<const TruvixxFloat3> centres;
+
+    std::vector<CachedTile> tiles{};
+    std::vector<uint32_t> tile_instances{};
+    std::vector<uint32_t> tile_meshes{};
+
+    /// 实例引用的 mesh，去重后升序
+    [[nodiscard]] std::vector<uint32_t> collect_meshes(const std::span<const uint32_t> instances) const
+    {
+        std::vector<uint32_t> meshes;
+        for (const uint32_t inst : instances)
+        {
+            const auto refs = scene.mesh_refs(scene.instances[inst]);
+            meshes.insert(meshes.end(), refs.begin(), refs.end());
+        }
+        std::ranges::sort(meshes);
+        meshes.erase(std::ranges::unique(meshes).begin(), meshes.end());
+        return meshes;
+    }
+
+    void build(const std::span<uint32_t> instances)
+    {
+        const std::vector<uint32_t> meshes = collect_meshes(instances);
+        uint64_t bytes = 0;
+        for (const uint32_t mesh : meshes)
+            bytes += mesh_sizes[mesh];
+
+        const uint32_t max_instances = std::max(settings.max_instances_per_tile, 1u);
+        if (instances.size() > 1 && (instances.size() > max_instances || bytes > settings.max_tile_bytes))
+        {
+            TruvixxAabb extent = empty_aabb();
+            for (const uint32_t inst : instances)
+                extent = merge_aabb(extent, TruvixxAabb{ .min = centres[inst], .max = centres[inst] });
+
+            int axis = 0;
+            for (int c = 1; c < 3; ++c)
+            {
+                if (extent.max.v[c] - extent.min.v[c] > extent.max.v[axis] - extent.min.v[axis])
+                    axis = c;
+            }
+
+            // 中心完全重合时同样按下标对半切分，保证递归终止
+            const size_t mid = instances.size() / 2;
+            const auto less = [&](const uint32_t a, const uint32_t b) {
+                return centres[a].v[axis] < centres[b].v[axis] || (centres[a].v[axis] == centres[b].v[axis] && a < b);
+            };
+            std::ranges::nth_element(instances, instances.begin() + static_cast<ptrdiff_t>(mid), less);
+            build(instances.first(mid));
+            build(instances.subspan(mid));
+            return;
+        }
+
+        std::ranges::sort(instances);
+        CachedTile tile{
+            .bounds = empty_aabb(),
+            .instance_offset = static_cast<uint32_t>(tile_instances.size()),
+            .instance_count = static_cast<uint32_t>(instances.size()),
+            .mesh_offset = static_cast<uint32_t>(tile_meshes.size()),
+            .mesh_count = static_cast<uint32_t>(meshes.size()),
+        };
+        for (const uint32_t inst : instances)
+            tile.bounds = merge_aabb(tile.bounds, scene.instances[inst].world_bounds);
+
+        tile_instances.insert(tile_instances.end(), instances.begin(), instances.end());
+        tile_meshes.insert(tile_meshes.end(), meshes.begin(), meshes.end());
+        tiles.push_back(tile);
+    }
+};
+
+/// 点到包围盒的距离平方，点在盒内时为 0
+float distance_sq(const TruvixxAabb& aabb, const TruvixxFloat3& point)
+{
+    float d2 = 0.f;
+    for (int c = 0; c < 3; ++c)
+    {
+        const float d = std::max({ aabb.min.v[c] - point.v[c], 0.f, point.v[c] - aabb.max.v[c] });
+        d2 += d * d;
+    }
+    return d2;
+}
+
+} // namespace
+
+bool write_tiled_scene(const std::filesystem::path& path, const SceneData& scene, const TileBuildSettings& settings)
+{
+    // 分块
+    std::vector<uint64_t> mesh_sizes(scene.mesh_count());
+    for (uint32_t i = 0; i < scene.mesh_count(); ++i)
+        mesh_sizes[i] = mesh_bytes(scene.mesh_infos[i]);
+
+    std::vector<TruvixxFloat3> centres(scene.instance_count());
+    std::vector<uint32_t> instances;
+    instances.reserve(scene.instance_count());
+    for (uint32_t i = 0; i < scene.instance_count(); ++i)
+    {
+        centres[i] = instance_centre(scene.instances[i]);
+        if (scene.instances[i].mesh_count() > 0)
+            instances.push_back(i);
+    }
+
+    TileBuilder builder{ .scene = scene, .settings = settings, .mesh_sizes = mesh_sizes, .centres = centres };
+    if (!instances.empty())
+        builder.build(instances);
+
+    // mesh 按第一次出现的 tile 排序，不被任何 tile 引用的放在最后
+    std::vector<uint32_t> mesh_order;
+    mesh_order.reserve(scene.mesh_count());
+    std::vector<bool> ordered(scene.mesh_count(), false);
+    for (const uint32_t mesh : builder.tile_meshes)
+    {
+        if (!ordered[mesh])
+        {
+            ordered[mesh] = true;
+            mesh_order.push_back(mesh);
+        }
+    }
+    for (uint32_t i = 0; i < scene.mesh_count(); ++i)
+    {
+        if (!ordered[i])
+            mesh_order.push_back(i);
+    }
+
+    std::error_code ec;
+    if (path.has_parent_path())
+    {
+        std::filesystem::create_directories(path.parent_path(), ec);
+        if (ec)
+            return false;
+    }
+
+    auto tmp_file = path;
+    tmp_file += ".tmp";
+
+    CacheWriter writer{ .out = std::ofstream(tmp_file, std::ios::binary | std::ios::trunc) };
+    if (!writer.out)
+        return false;
+
+    TiledHeader header{};
+    std::memcpy(header.magic, TILED_MAGIC, sizeof(TILED_MAGIC));
+    header.version = TILED_SCENE_VERSION;
+    header.mesh_count = scene.mesh_count();
+    header.material_count = scene.material_count();
+    header.instance_count = scene.instance_count();
+    header.texture_count = scene.texture_count();
+    header.tile_count = static_cast<uint32_t>(builder.tiles.size());
+
+    // 占位，最后回写
+    writer.write(&header, sizeof(header));
+
+    // mesh chunk
+    std::vector<CachedChunk> chunks(scene.mesh_count());
+    for (const uint32_t i : mesh_order)
+    {
+        const MeshInfo& mesh = scene.mesh_infos[i];
+        CachedChunk& chunk = chunks[i];
+        chunk.vertex_cnt = mesh.vertex_cnt;
+        chunk.index_cnt = mesh.total_index_count();
+        chunk.index16 = mesh.is_index16();
+        chunk.has_normal = mesh.has_normal && mesh.normals;
+        chunk.has_tangent = mesh.has_tangent && mesh.tangents;
+        chunk.bounds = mesh.bounds;
+
+        if (mesh.positions)
+            chunk.positions_offset = writer.write_section(mesh.positions, mesh.vertex_cnt);
+        if (chunk.has_normal)
+            chunk.normals_offset = writer.write_section(mesh.normals, mesh.vertex_cnt);
+        if (chunk.has_tangent)
+            chunk.tangents_offset = writer.write_section(mesh.tangents, mesh.vertex_cnt);
+        if (mesh.uvs)
+            chunk.uvs_offset = writer.write_section(mesh.uvs, mesh.vertex_cnt);
+        if (mesh.is_index16())
+            chunk.indices_offset = writer.write_section(mesh.indices16.data(), mesh.indices16.size());
+        else if (!mesh.indices.empty())
+            chunk.indices_offset = writer.write_section(mesh.indices.data(), mesh.indices.size());
+        if (!mesh.lods.empty())
+        {
+            chunk.lod_count = static_cast<uint32_t>(mesh.lods.size());
+            chunk.lods_offset = writer.write_section(mesh.lods.data(), mesh.lods.size());
+        }
+    }
+
+    // 内嵌纹理数据
+    std::vector<CachedTexture> cached_textures;
+    cached_textures.reserve(scene.texture_count());
+    for (const auto& texture : scene.textures)
+    {
+        const uint64_t data_offset = texture.embedded ? writer.write_section(texture.data, texture.size) : 0;
+        cached_textures.push_back(to_cached(texture, data_offset));
+    }
+
+    std::vector<CachedMaterial> cached_materials;
+    cached_materials.reserve(scene.material_count());
+    for (const auto& mat : scene.materials)
+        cached_materials.push_back(to_cached(mat));
+
+    // 节点树不写入，instance 不再引用节点
+    std::vector<CachedInstance> cached_instances;
+    cached_instances.reserve(scene.instance_count());
+    for (const auto& inst : scene.instances)
+    {
+        CachedInstance cached = to_cached(inst);
+        cached.node = NO_NODE;
+        cached_instances.push_back(cached);
+    }
+
+    header.refs_count = scene.instance_mesh_refs.size();
+    header.refs_offset = writer.write_section(scene.instance_mesh_refs.data(), scene.instance_mesh_refs.size());
+    writer.write(scene.instance_material_refs.data(), scene.instance_material_refs.size() * sizeof(uint32_t));
+
+    header.strings_offset = writer.write_section(scene.strings.data(), scene.strings.size());
+    header.strings_size = scene.strings.size();
+    header.chunks_offset = writer.write_section(chunks.data(), chunks.size());
+    header.tiles_offset = writer.write_section(builder.tiles.data(), builder.tiles.size());
+    header.tile_instance_count = builder.tile_instances.size();
+    header.tile_instances_offset = writer.write_section(builder.tile_instances.data(), builder.tile_instances.size());
+    header.tile_mesh_count = builder.tile_meshes.size();
+    header.tile_meshes_offset = writer.write_section(builder.tile_meshes.data(), builder.tile_meshes.size());
+    header.materials_offset = writer.write_section(cached_materials.data(), cached_materials.size());
+    header.instances_offset = writer.write_section(cached_instances.data(), cached_instances.size());
+    header.textures_offset = writer.write_section(cached_textures.data(), cached_textures.size());
+    header.file_size = writer.offset;
+
+    writer.out.seekp(0);
+    writer.out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    writer.out.close();
+    if (!writer.out)
+    {
+        std::filesystem::remove(tmp_file, ec);
+        return false;
+    }
+
+    std::filesystem::rename(tmp_file, path, ec);
+    if (ec)
+    {
+        std::filesystem::remove(tmp_file, ec);
+        return false;
+    }
+    return true;
+}
+
+bool TiledScene::open(const std::filesystem::path& path, const uint64_t budget_bytes)
+{
+    close();
+    if (!std::filesystem::exists(path) || !file_.open(path))
+        return false;
+
+    // 任何校验失败都需要解除映射
+    auto fail = [&]() {
+        close();
+        return false;
+    };
+
+    const CacheView view{ .base = file_.data(), .size = file_.size() };
+
+    const auto* header = view.get<TiledHeader>(0, 1);
+    if (!header)
+        return fail();
+    if (std::memcmp(header->magic, TILED_MAGIC, sizeof(TILED_MAGIC)) != 0 || header->version != TILED_SCENE_VERSION ||
+        header->file_size != view.size)
+        return fail();
+
+    const auto* strings = view.get<char>(header->strings_offset, header->strings_size);
+    if (!strings && header->strings_size != 0)
+        return fail();
+    if (!metadata_.strings.assign(strings, header->strings_size))
+        return fail();
+
+    const auto* chunks = view.get<CachedChunk>(header->chunks_offset, header->mesh_count);
+    const auto* tiles = view.get<CachedTile>(header->tiles_offset, header->tile_count);
+    const auto* materials = view.get<CachedMaterial>(header->materials_offset, header->material_count);
+    const auto* instances = view.get<CachedInstance>(header->instances_offset, header->instance_count);
+    const auto* textures = view.get<CachedTexture>(header->textures_offset, header->texture_count);
+    if (!chunks || !tiles || !materials || !instances || !textures)
+        return fail();
+
+    // mesh chunk 只校验范围，数据在 update() 时才读入
+    meshes_.resize(header->mesh_count);
+    chunks_.resize(header->mesh_count);
+    std::vector<MeshLod> lods;
+    for (uint32_t i = 0; i < header->mesh_count; ++i)
+    {
+        const CachedChunk& cached = chunks[i];
+        const uint32_t n = cached.vertex_cnt;
+        if ((cached.positions_offset && !view.get<TruvixxFloat3>(cached.positions_offset, n)) ||
+            (cached.normals_offset && !view.get<TruvixxFloat3>(cached.normals_offset, n)) ||
+            (cached.tangents_offset && !view.get<TruvixxFloat3>(cached.tangents_offset, n)) ||
+            (cached.uvs_offset && !view.get<TruvixxFloat2>(cached.uvs_offset, n)))
+            return fail();
+        if (cached.indices_offset && (cached.index16 ? !view.get<uint16_t>(cached.indices_offset, cached.index_cnt)
+                                                     : !view.get<uint32_t>(cached.indices_offset, cached.index_cnt)))
+            return fail();
+        if (!read_array(view, cached.lods_offset, cached.lod_count, lods))
+            return fail();
+        for (const auto& lod : lods)
+        {
+            if (uint64_t{ lod.index_offset } + lod.index_count > cached.index_cnt)
+                return fail();
+        }
+
+        const uint32_t index_cnt = cached.indices_offset ? cached.index_cnt : 0;
+        meshes_[i] = TiledMeshInfo{
+            .vertex_cnt = n,
+            .index_cnt = index_cnt,
+            .lod_index_cnt = lods.empty() ? index_cnt : lods[0].index_count,
+            .lod_count = cached.lod_count,
+            .has_normal = cached.normals_offset != 0,
+            .has_tangent = cached.tangents_offset != 0,
+            .has_uv = cached.uvs_offset != 0,
+            .index16 = cached.index16 != 0 && index_cnt > 0,
+            .bounds = cached.bounds,
+            .bytes = chunk_bytes(cached),
+        };
+        chunks_[i] = ChunkOffsets{
+            .positions = cached.positions_offset,
+            .normals = cached.normals_offset,
+            .tangents = cached.tangents_offset,
+            .uvs = cached.uvs_offset,
+            .indices = cached.indices_offset,
+            .lods = cached.lods_offset,
+        };
+    }
+
+    // tile
+    if (!read_array(view, header->tile_instances_offset, header->tile_instance_count, tile_instances_) ||
+        !read_array(view, header->tile_meshes_offset, header->tile_mesh_count, tile_meshes_))
+        return fail();
+    for (const uint32_t inst : tile_instances_)
+    {
+        if (inst >= header->instance_count)
+            return fail();
+    }
+    for (const uint32_t mesh : tile_meshes_)
+    {
+        if (mesh >= header->mesh_count)
+            return fail();
+    }
+
+    tiles_.resize(header->tile_count);
+    for (uint32_t i = 0; i < header->tile_count; ++i)
+    {
+        const CachedTile& cached = tiles[i];
+        if (uint64_t{ cached.instance_offset } + cached.instance_count > tile_instances_.size() ||
+            uint64_t{ cached.mesh_offset } + cached.mesh_count > tile_meshes_.size())
+            return fail();
+
+        TileInfo& tile = tiles_[i];
+        tile.bounds = cached.bounds;
+        tile.instance_offset = cached.instance_offset;
+        tile.instance_count = cached.instance_count;
+        tile.mesh_offset = cached.mesh_offset;
+        tile.mesh_count = cached.mesh_count;
+        for (uint32_t m = 0; m < cached.mesh_count; ++m)
+            tile.bytes += meshes_[tile_meshes_[cached.mesh_offset + m]].bytes;
+    }
+
+    // 纹理、材质
+    metadata_.textures.resize(header->texture_count);
+    for (uint32_t i = 0; i < header->texture_count; ++i)
+    {
+        if (!from_cached(view, metadata_.strings, textures[i], metadata_.textures[i]))
+            return fail();
+    }
+
+    metadata_.materials.resize(header->material_count);
+    for (uint32_t i = 0; i < header->material_count; ++i)
+    {
+        if (!from_cached(metadata_.strings, materials[i], header->texture_count, metadata_.materials[i]))
+            return fail();
+    }
+
+    // Instance
+    const uint64_t refs_size = header->refs_count;
+    if (refs_size > UINT32_MAX)
+        return fail();
+    const auto* refs = view.get<uint32_t>(header->refs_offset, refs_size * 2);
+    if (!refs && refs_size != 0)
+        return fail();
+
+    metadata_.instance_mesh_refs.assign(refs, refs + refs_size);
+    metadata_.instance_material_refs.assign(refs + refs_size, refs + refs_size * 2);
+    for (uint64_t j = 0; j < refs_size; ++j)
+    {
+        if (metadata_.instance_mesh_refs[j] >= header->mesh_count ||
+            metadata_.instance_material_refs[j] >= header->material_count)
+            return fail();
+    }
+
+    metadata_.instances.resize(header->instance_count);
+    for (uint32_t i = 0; i < header->instance_count; ++i)
+    {
+        InstanceData& inst = metadata_.instances[i];
+        if (!from_cached(metadata_.strings, instances[i], refs_size, 0, inst))
+            return fail();
+        metadata_.bounds = merge_aabb(metadata_.bounds, inst.world_bounds);
+    }
+
+    slots_.resize(header->mesh_count);
+    budget_ = budget_bytes;
+    return true;
+}
+
+void TiledScene::close() noexcept
+{
+    file_.close();
+    metadata_ = {};
+    meshes_.clear();
+    chunks_.clear();
+    tiles_.clear();
+    tile_instances_.clear();
+    tile_meshes_.clear();
+    slots_.clear();
+    resident_bytes_ = 0;
+    resident_count_ = 0;
+    frame_ = 0;
+    loaded_.clear();
+    evicted_.clear();
+    loaded_bytes_ = 0;
+    skipped_tiles_ = 0;
+}
+
+const MeshInfo* TiledScene::resident_mesh(const uint32_t mesh) const noexcept
+{
+    if (mesh >= slots_.size() || !slots_[mesh].resident)
+        return nullptr;
+    return &slots_[mesh].mesh;
+}
+
+bool TiledScene::is_tile_resident(const uint32_t tile) const noexcept
+{
+    if (tile >= tiles_.size())
+        return false;
+
+    const TileInfo& info = tiles_[tile];
+    for (uint32_t m = 0; m < info.mesh_count; ++m)
+    {
+        if (!slots_[tile_meshes_[info.mesh_offset + m]].resident)
+            return false;
+    }
+    return true;
+}
+
+void TiledScene::update(const std::span<const uint32_t> tiles)
+{
+    ++frame_;
+    loaded_.clear();
+    evicted_.clear();
+    loaded_bytes_ = 0;
+    skipped_tiles_ = 0;
+
+    // 按优先级为 tile 分配预算，已被前面的 tile 请求的 mesh 不重复计入
+    uint64_t wanted_bytes = 0;
+    std::vector<uint32_t> to_load;
+    for (const uint32_t tile : tiles)
+    {
+        if (tile >= tiles_.size())
+            continue;
+
+        const TileInfo& info = tiles_[tile];
+        const std::span<const uint32_t> meshes(tile_meshes_.data() + info.mesh_offset, info.mesh_count);
+        uint64_t extra_bytes = 0;
+        for (const uint32_t mesh : meshes)
+        {
+            if (slots_[mesh].wanted != frame_)
+                extra_bytes += meshes_[mesh].bytes;
+        }
+        if (budget_ != 0 && wanted_bytes + extra_bytes > budget_)
+        {
+            ++skipped_tiles_;
+            continue;
+        }
+
+        wanted_bytes += extra_bytes;
+        for (const uint32_t mesh : meshes)
+        {
+            MeshSlot& slot = slots_[mesh];
+            if (slot.wanted == frame_)
+                continue;
+            slot.wanted = frame_;
+            slot.last_used = frame_;
+            if (!slot.resident)
+            {
+                to_load.push_back(mesh);
+                loaded_bytes_ += meshes_[mesh].bytes;
+            }
+        }
+    }
+
+    // 淘汰本次未被请求的 mesh，最久未使用的优先；被请求的 mesh 总量不超过预算，因此一定能腾出空间
+    if (budget_ != 0 && resident_bytes_ + loaded_bytes_ > budget_)
+    {
+        std::vector<uint32_t> candidates;
+        for (uint32_t i = 0; i < slots_.size(); ++i)
+        {
+            if (slots_[i].resident && slots_[i].wanted != frame_)
+                candidates.push_back(i);
+        }
+        std::ranges::stable_sort(candidates, {}, [&](const uint32_t i) { return slots_[i].last_used; });
+
+        for (const uint32_t mesh : candidates)
+        {
+            if (resident_bytes_ + loaded_bytes_ <= budget_)
+                break;
+
+            MeshSlot& slot = slots_[mesh];
+            slot.mesh = MeshInfo{};
+            slot.resident = false;
+            resident_bytes_ -= meshes_[mesh].bytes;
+            --resident_count_;
+            evicted_.push_back(mesh);
+        }
+    }
+
+    // 每个任务只写入自身的 slot
+    parallel_for(static_cast<uint32_t>(to_load.size()), [&](const uint32_t i) {
+        load_mesh(to_load[i], slots_[to_load[i]].mesh);
+    });
+    for (const uint32_t mesh : to_load)
+        slots_[mesh].resident = true;
+    resident_bytes_ += loaded_bytes_;
+    resident_count_ += static_cast<uint32_t>(to_load.size());
+    loaded_ = std::move(to_load);
+}
+
+void TiledScene::update(const TruvixxFloat3& camera, const float radius)
+{
+    const float radius_sq = radius * radius;
+    std::vector<std::pair<float, uint32_t>> nearby;
+    for (uint32_t i = 0; i < tiles_.size(); ++i)
+    {
+        if (is_empty(tiles_[i].bounds))
+            continue;
+        if (const float d2 = distance_sq(tiles_[i].bounds, camera); d2 <= radius_sq)
+            nearby.emplace_back(d2, i);
+    }
+    std::ranges::sort(nearby);
+
+    std::vector<uint32_t> order(nearby.size());
+    std::ranges::transform(nearby, order.begin(), &std::pair<float, uint32_t>::second);
+    update(order);
+}
+
+TileStreamStats TiledScene::stats() const noexcept
+{
+    TileStreamStats result{
+        .budget_bytes = budget_,
+        .resident_bytes = resident_bytes_,
+        .resident_mesh_count = resident_count_,
+        .resident_tile_count = 0,
+        .loaded_mesh_count = static_cast<uint32_t>(loaded_.size()),
+        .evicted_mesh_count = static_cast<uint32_t>(evicted_.size()),
+        .loaded_bytes = loaded_bytes_,
+        .skipped_tile_count = skipped_tiles_,
+    };
+    for (uint32_t i = 0; i < tiles_.size(); ++i)
+    {
+        if (is_tile_resident(i))
+            ++result.resident_tile_count;
+    }
+    return result;
+}
+
+void TiledScene::load_mesh(const uint32_t mesh, MeshInfo& out) const
+{
+    const TiledMeshInfo& info = meshes_[mesh];
+    const ChunkOffsets& chunk = chunks_[mesh];
+    const CacheView view{ .base = file_.data(), .size = file_.size() };
+    const uint32_t n = info.vertex_cnt;
+
+    out = MeshInfo{};
+    out.vertex_cnt = n;
+    out.has_normal = info.has_normal;
+    out.has_tangent = info.has_tangent;
+    out.bounds = info.bounds;
+
+    // positions / normals / tangents 依次存放在 vertex_storage 中
+    const size_t stream_count = (chunk.positions ? 1 : 0) + (chunk.normals ? 1 : 0) + (chunk.tangents ? 1 : 0);
+    out.vertex_storage.resize(size_t{ n } * stream_count);
+    TruvixxFloat3* dst = out.vertex_storage.data();
+    auto copy_stream = [&](const uint64_t offset) -> const TruvixxFloat3* {
+        if (!offset)
+            return nullptr;
+        const TruvixxFloat3* stream = dst;
+        std::copy_n(view.get<TruvixxFloat3>(offset, n), n, dst);
+        dst += n;
+        return stream;
+    };
+    out.positions = copy_stream(chunk.positions);
+    out.normals = copy_stream(chunk.normals);
+    out.tangents = copy_stream(chunk.tangents);
+
+    if (chunk.uvs)
+    {
+        const auto* uvs = view.get<TruvixxFloat2>(chunk.uvs, n);
+        out.uv_storage.assign(uvs, uvs + n);
+        out.uvs = out.uv_storage.data();
+    }
+
+    if (chunk.indices && info.index16)
+    {
+        const auto* indices = view.get<uint16_t>(chunk.indices, info.index_cnt);
+        out.indices16.assign(indices, indices + info.index_cnt);
+    }
+    else if (chunk.indices)
+    {
+        const auto* indices = view.get<uint32_t>(chunk.indices, info.index_cnt);
+        out.indices.assign(indices, indices + info.index_cnt);
+    }
+
+    if (info.lod_count > 0)
+    {
+        const auto* lods = view.get<MeshLod>(chunk.lods, info.lod_count);
+        out.lods.assign(lods, lods + info.lod_count);
+    }
+}
+
+} // namespace truvixx
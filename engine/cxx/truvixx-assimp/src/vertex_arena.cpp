@@ -0,0 +1,35 @@
+#include "TruvixxAssimp/vertex_arena.hpp"
+
+#include <cstring>
+
+namespace truvixx
+{
+
+size_t packed_stream_size(const uint32_t vertex_cnt, const bool has_normal, const bool has_tangent, const bool has_uv) noexcept
+{
+    const size_t float3_streams = 1 + (has_normal ? 1 : 0) + (has_tangent ? 1 : 0);
+    return static_cast<size_t>(vertex_cnt) * (float3_streams * sizeof(TruvixxFloat3) + (has_uv ? sizeof(TruvixxFloat2) : 0));
+}
+
+void pack_mesh_streams(MeshInfo& mesh, std::byte* dst)
+{
+    static_assert(alignof(TruvixxFloat3) == alignof(TruvixxFloat2), "streams are packed back to back");
+
+    const size_t vertex_cnt = mesh.vertex_cnt;
+    auto pack = [&]<typename T>(const T*& stream) {
+        if (!stream)
+            return;
+        std::memcpy(dst, stream, vertex_cnt * sizeof(T));
+        stream = reinterpret_cast<const T*>(dst);
+        dst += vertex_cnt * sizeof(T);
+    };
+    pack(mesh.positions);
+    pack(mesh.normals);
+    pack(mesh.tangents);
+    pack(mesh.uvs);
+
+    std::vector<TruvixxFloat3>().swap(mesh.vertex_storage);
+    std::vector<TruvixxFloat2>().swap(mesh.uv_storage);
+}
+
+} // namespace truvixx
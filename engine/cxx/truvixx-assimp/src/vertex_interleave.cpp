@@ -0,0 +1,223 @@
+#include "TruvixxAssimp/vertex_interleave.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <utility>
+#include <meshoptimizer.h>
+
+namespace truvixx
+{
+
+namespace
+{
+
+// 每种属性可用的格式，下标 0 固定为 None
+// 写入函数按 (position, normal, tangent, uv) 的格式下标组合特化，共 4^4 个
+constexpr std::array POSITION_FORMATS = { VertexFormat::None, VertexFormat::Float32x3, VertexFormat::Float16x4, VertexFormat::Unorm16x4 };
+constexpr std::array DIRECTION_FORMATS = { VertexFormat::None, VertexFormat::Float32x3, VertexFormat::Snorm8x4, VertexFormat::Snorm16x2Octahedral };
+constexpr std::array UV_FORMATS = { VertexFormat::None, VertexFormat::Float32x2, VertexFormat::Float16x2, VertexFormat::Unorm16x2 };
+
+constexpr size_t FORMAT_CHOICES = 4;
+
+/// format 在 formats 中的下标，不可用时返回 FORMAT_CHOICES
+size_t format_index(const std::array<VertexFormat, FORMAT_CHOICES>& formats, const VertexFormat format)
+{
+    return static_cast<size_t>(std::ranges::find(formats, format) - formats.begin());
+}
+
+template <typename T, size_t N>
+void store(std::byte* dst, const std::array<T, N>& values)
+{
+    std::memcpy(dst, values.data(), sizeof(values));
+}
+
+template <VertexFormat Format>
+void write_position(std::byte* dst, const TruvixxFloat3& p, const QuantizationParams& params)
+{
+    if constexpr (Format == VertexFormat::Float32x3)
+    {
+        std::memcpy(dst, &p, sizeof(p));
+    }
+    else if constexpr (Format == VertexFormat::Float16x4)
+    {
+        constexpr uint16_t HALF_ONE = 0x3C00;
+        store(dst, std::array<uint16_t, 4>{ meshopt_quantizeHalf(p.x), meshopt_quantizeHalf(p.y), meshopt_quantizeHalf(p.z), HALF_ONE });
+    }
+    else if constexpr (Format == VertexFormat::Unorm16x4)
+    {
+        std::array<uint16_t, 4> q{};
+        for (int c = 0; c < 3; ++c)
+            q[c] = to_unorm16(normalize_in_range(p.v[c], params.position_offset.v[c], params.position_scale.v[c]));
+        store(dst, q);
+    }
+}
+
+template <VertexFormat Format>
+void write_direction(std::byte* dst, const TruvixxFloat3& n)
+{
+    if constexpr (Format == VertexFormat::Float32x3)
+    {
+        std::memcpy(dst, &n, sizeof(n));
+    }
+    else if constexpr (Format == VertexFormat::Snorm8x4)
+    {
+        store(dst, std::array<int8_t, 4>{ to_snorm8(n.x), to_snorm8(n.y), to_snorm8(n.z), 0 });
+    }
+    else if constexpr (Format == VertexFormat::Snorm16x2Octahedral)
+    {
+        std::array<int16_t, 2> e;
+        encode_octahedral_snorm16(n, e.data());
+        store(dst, e);
+    }
+}
+
+template <VertexFormat Format>
+void write_uv(std::byte* dst, const TruvixxFloat2& uv, const QuantizationParams& params)
+{
+    if constexpr (Format == VertexFormat::Float32x2)
+    {
+        std::memcpy(dst, &uv, sizeof(uv));
+    }
+    else if constexpr (Format == VertexFormat::Float16x2)
+    {
+        store(dst, std::array<uint16_t, 2>{ meshopt_quantizeHalf(uv.x), meshopt_quantizeHalf(uv.y) });
+    }
+    else if constexpr (Format == VertexFormat::Unorm16x2)
+    {
+        store(dst, std::array<uint16_t, 2>{
+            to_unorm16(normalize_in_range(uv.x, params.uv_offset.x, params.uv_scale.x)),
+            to_unorm16(normalize_in_range(uv.y, params.uv_offset.y, params.uv_scale.y)),
+        });
+    }
+}
+
+/// 一种格式组合的写入函数：属性格式在编译期确定，循环内没有格式分支
+template <VertexFormat Position, VertexFormat Normal, VertexFormat Tangent, VertexFormat Uv>
+void write_vertices(const MeshInfo& mesh, const InterleavedLayout& layout, const QuantizationParams& params, std::byte* dst)
+{
+    const size_t stride = layout.stride;
+    for (uint32_t i = 0; i < mesh.vertex_cnt; ++i)
+    {
+        std::byte* vertex = dst + i * stride;
+        if constexpr (Position != VertexFormat::None)
+            write_position<Position>(vertex + layout.position.offset, mesh.positions[i], params);
+        if constexpr (Normal != VertexFormat::None)
+            write_direction<Normal>(vertex + layout.normal.offset, mesh.normals[i]);
+        if constexpr (Tangent != VertexFormat::None)
+            write_direction<Tangent>(vertex + layout.tangent.offset, mesh.tangents[i]);
+        if constexpr (Uv != VertexFormat::None)
+            write_uv<Uv>(vertex + layout.uv.offset, mesh.uvs[i], params);
+    }
+}
+
+using WriteFn = void (*)(const MeshInfo&, const InterleavedLayout&, const QuantizationParams&, std::byte*);
+
+/// 写入函数表的下标: position | normal << 2 | tangent << 4 | uv << 6
+template <size_t Id>
+constexpr WriteFn writer_of()
+{
+    return &write_vertices<
+        POSITION_FORMATS[Id % FORMAT_CHOICES],
+        DIRECTION_FORMATS[Id / FORMAT_CHOICES % FORMAT_CHOICES],
+        DIRECTION_FORMATS[Id / (FORMAT_CHOICES * FORMAT_CHOICES) % FORMAT_CHOICES],
+        UV_FORMATS[Id / (FORMAT_CHOICES * FORMAT_CHOICES * FORMAT_CHOICES)]>;
+}
+
+template <size_t... Ids>
+constexpr std::array<WriteFn, sizeof...(Ids)> make_writers(std::index_sequence<Ids...>)
+{
+    return { writer_of<Ids>()... };
+}
+
+constexpr auto WRITERS = make_writers(std::make_index_sequence<FORMAT_CHOICES * FORMAT_CHOICES * FORMAT_CHOICES * FORMAT_CHOICES>{});
+
+} // namespace
+
+uint32_t vertex_format_size(const VertexFormat format) noexcept
+{
+    switch (format)
+    {
+    case VertexFormat::Float32x2:
+        return 8;
+    case VertexFormat::Float32x3:
+        return 12;
+    case VertexFormat::Float16x2:
+    case VertexFormat::Unorm16x2:
+    case VertexFormat::Snorm8x4:
+    case VertexFormat::Snorm16x2Octahedral:
+        return 4;
+    case VertexFormat::Float16x4:
+    case VertexFormat::Unorm16x4:
+        return 8;
+    default:
+        return 0;
+    }
+}
+
+bool is_valid_layout(const InterleavedLayout& layout) noexcept
+{
+    if (layout.stride == 0)
+        return false;
+    if (format_index(POSITION_FORMATS, layout.position.format) == FORMAT_CHOICES ||
+        format_index(DIRECTION_FORMATS, layout.normal.format) == FORMAT_CHOICES ||
+        format_index(DIRECTION_FORMATS, layout.tangent.format) == FORMAT_CHOICES ||
+        format_index(UV_FORMATS, layout.uv.format) == FORMAT_CHOICES)
+        return false;
+
+    const std::array attributes = { layout.position, layout.normal, layout.tangent, layout.uv };
+    for (size_t i = 0; i < attributes.size(); ++i)
+    {
+        const uint32_t size = vertex_format_size(attributes[i].format);
+        if (size == 0)
+            continue;
+        if (static_cast<uint64_t>(attributes[i].offset) + size > layout.stride)
+            return false;
+
+        for (size_t j = 0; j < i; ++j)
+        {
+            const uint32_t other_size = vertex_format_size(attributes[j].format);
+            if (other_size == 0)
+                continue;
+            const bool disjoint = attributes[i].offset + size <= attributes[j].offset ||
+                                  attributes[j].offset + other_size <= attributes[i].offset;
+            if (!disjoint)
+                return false;
+        }
+    }
+    return true;
+}
+
+bool needs_quantization_params(const InterleavedLayout& layout) noexcept
+{
+    return layout.position.format == VertexFormat::Unorm16x4 || layout.uv.format == VertexFormat::Unorm16x2;
+}
+
+void write_interleaved(const MeshInfo& mesh, const InterleavedLayout& layout, const QuantizationParams& params, std::byte* dst)
+{
+    size_t position = format_index(POSITION_FORMATS, layout.position.format);
+    size_t normal = format_index(DIRECTION_FORMATS, layout.normal.format);
+    size_t tangent = format_index(DIRECTION_FORMATS, layout.tangent.format);
+    size_t uv = format_index(UV_FORMATS, layout.uv.format);
+
+    // mesh 缺少的属性整体清零，写入时按 None 跳过
+    const bool missing_position = position != 0 && !mesh.positions;
+    const bool missing_normal = normal != 0 && (!mesh.has_normal || !mesh.normals);
+    const bool missing_tangent = tangent != 0 && (!mesh.has_tangent || !mesh.tangents);
+    const bool missing_uv = uv != 0 && !mesh.uvs;
+    if (missing_position || missing_normal || missing_tangent || missing_uv)
+        std::memset(dst, 0, static_cast<size_t>(mesh.vertex_cnt) * layout.stride);
+    if (missing_position)
+        position = 0;
+    if (missing_normal)
+        normal = 0;
+    if (missing_tangent)
+        tangent = 0;
+    if (missing_uv)
+        uv = 0;
+
+    const size_t id = position + FORMAT_CHOICES * (normal + FORMAT_CHOICES * (tangent + FORMAT_CHOICES * uv));
+    WRITERS[id](mesh, layout, params, dst);
+}
+
+} // namespace truvixx
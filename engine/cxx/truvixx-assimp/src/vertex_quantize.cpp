@@ -0,0 +1,105 @@
+#include "TruvixxAssimp/vertex_quantize.hpp"
+
+#include <limits>
+#include <meshoptimizer.h>
+
+namespace truvixx
+{
+
+QuantizationParams compute_quantization_params(const MeshInfo& mesh)
+{
+    QuantizationParams params;
+    if (mesh.vertex_cnt == 0)
+        return params;
+
+    if (mesh.positions)
+    {
+        constexpr float inf = std::numeric_limits<float>::infinity();
+        TruvixxFloat3 min_pos = { inf, inf, inf };
+        TruvixxFloat3 max_pos = { -inf, -inf, -inf };
+        for (uint32_t i = 0; i < mesh.vertex_cnt; ++i)
+        {
+            for (int c = 0; c < 3; ++c)
+            {
+                min_pos.v[c] = std::min(min_pos.v[c], mesh.positions[i].v[c]);
+                max_pos.v[c] = std::max(max_pos.v[c], mesh.positions[i].v[c]);
+            }
+        }
+
+        params.position_offset = min_pos;
+        for (int c = 0; c < 3; ++c)
+            params.position_scale.v[c] = max_pos.v[c] - min_pos.v[c];
+    }
+
+    if (mesh.uvs)
+    {
+        constexpr float inf = std::numeric_limits<float>::infinity();
+        TruvixxFloat2 min_uv = { inf, inf };
+        TruvixxFloat2 max_uv = { -inf, -inf };
+        for (uint32_t i = 0; i < mesh.vertex_cnt; ++i)
+        {
+            for (int c = 0; c < 2; ++c)
+            {
+                min_uv.v[c] = std::min(min_uv.v[c], mesh.uvs[i].v[c]);
+                max_uv.v[c] = std::max(max_uv.v[c], mesh.uvs[i].v[c]);
+            }
+        }
+
+        params.uv_offset = min_uv;
+        for (int c = 0; c < 2; ++c)
+            params.uv_scale.v[c] = max_uv.v[c] - min_uv.v[c];
+    }
+
+    return params;
+}
+
+void quantize_positions(const MeshInfo& mesh, const QuantizationParams& params, uint16_t* out)
+{
+    if (!mesh.positions)
+        return;
+
+    for (uint32_t i = 0; i < mesh.vertex_cnt; ++i)
+    {
+        for (int c = 0; c < 3; ++c)
+        {
+            const float t = normalize_in_range(mesh.positions[i].v[c], params.position_offset.v[c], params.position_scale.v[c]);
+            out[i * 4 + c] = to_unorm16(t);
+        }
+        out[i * 4 + 3] = 0;
+    }
+}
+
+void encode_octahedral_snorm16(const TruvixxFloat3* src, const uint32_t count, int16_t* out)
+{
+    for (uint32_t i = 0; i < count; ++i)
+        encode_octahedral_snorm16(src[i], out + i * 2);
+}
+
+void quantize_uvs_half(const MeshInfo& mesh, uint16_t* out)
+{
+    if (!mesh.uvs)
+        return;
+
+    for (uint32_t i = 0; i < mesh.vertex_cnt; ++i)
+    {
+        out[i * 2 + 0] = meshopt_quantizeHalf(mesh.uvs[i].x);
+        out[i * 2 + 1] = meshopt_quantizeHalf(mesh.uvs[i].y);
+    }
+}
+
+void quantize_uvs_unorm16(const MeshInfo& mesh, const QuantizationParams& params, uint16_t* out)
+{
+    if (!mesh.uvs)
+        return;
+
+    for (uint32_t i = 0; i < mesh.vertex_cnt; ++i)
+    {
+        for (int c = 0; c < 2; ++c)
+        {
+            const float t = normalize_in_range(mesh.uvs[i].v[c], params.uv_offset.v[c], params.uv_scale.v[c]);
+            out[i * 2 + c] = to_unorm16(t);
+        }
+    }
+}
+
+} // namespace truvixx
@@ -0,0 +1,760 @@
+#include "TruvixxAssimp/hash.hpp"
+#include "TruvixxAssimp/load_stats.hpp"
+#include "TruvixxAssimp/scene_importer.hpp"
+#include "TruvixxInterface/truvixx_api.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+namespace
+{
+
+constexpr double MIB = 1024.0 * 1024.0;
+
+/// 进程启动以来的峰值常驻内存 (字节)
+uint64_t peak_rss_bytes()
+{
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters{};
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        return 0;
+    return counters.PeakWorkingSetSize;
+#else
+    rusage usage{};
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+#ifdef __APPLE__
+    return static_cast<uint64_t>(usage.ru_maxrss);
+#else
+    return static_cast<uint64_t>(usage.ru_maxrss) * 1024;
+#endif
+#endif
+}
+
+/// 语料中的一个场景
+struct CorpusScene
+{
+    std::filesystem::path path;
+    std::string name; ///< 基准名中使用的名称 (文件名)
+    uint64_t file_size = 0;
+};
+
+bool is_scene_file(const std::filesystem::path& path)
+{
+    std::string ext = path.extension().string();
+    std::ranges::transform(ext, ext.begin(), [](const unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return ext == ".fbx" || ext == ".gltf" || ext == ".glb" || ext == ".obj";
+}
+
+/// 收集语料：参数可以是场景文件或目录 (递归查找 fbx / gltf / glb / obj)
+std::vector<CorpusScene> collect_corpus(const std::vector<std::string>& inputs)
+{
+    std::vector<std::filesystem::path> files;
+    for (const auto& input : inputs)
+    {
+        const std::filesystem::path path(input);
+        if (std::filesystem::is_directory(path))
+        {
+            for (const auto& entry : std::filesystem::recursive_directory_iterator(path))
+            {
+                if (entry.is_regular_file() && is_scene_file(entry.path()))
+                    files.push_back(entry.path());
+            }
+        }
+        else if (std::filesystem::is_regular_file(path))
+        {
+            files.push_back(path);
+        }
+        else
+        {
+            std::cerr << std::format("Skipping missing corpus entry: {}", input) << "\n";
+        }
+    }
+
+    // 排序保证不同机器 / 不同提交之间基准的顺序和名称一致
+    std::ranges::sort(files);
+    files.erase(std::ranges::unique(files).begin(), files.end());
+
+    std::vector<CorpusScene> corpus;
+    corpus.reserve(files.size());
+    for (const auto& file : files)
+    {
+        corpus.push_back(CorpusScene{
+            .path = file,
+            .name = file.filename().string(),
+            .file_size = std::filesystem::file_size(file),
+        });
+    }
+    return corpus;
+}
+
+/// 一组导入选项
+struct ImportConfig
+{
+    const char* name;
+    truvixx::SceneLoadOptions options;
+};
+
+std::vector<ImportConfig> import_configs()
+{
+    std::vector<ImportConfig> configs;
+
+    configs.push_back({ .name = "default", .options = {} });
+
+    truvixx::SceneLoadOptions parallel;
+    parallel.parallel = true;
+    configs.push_back({ .name = "parallel", .options = parallel });
+
+    // 渲染器实际使用的完整流水线
+    truvixx::SceneLoadOptions full;
+    full.parallel = true;
+    full.optimize_meshes = true;
+    full.build_meshlets = true;
+    full.compact_indices = true;
+    full.release_source = true;
+    full.skip_empty_nodes = true;
+    full.build_instance_bvh = true;
+    configs.push_back({ .name = "full", .options = full });
+
+    return configs;
+}
+
+/// 导入相关的计数器：吞吐量、顶点速率、内存和各阶段的平均耗时
+void report_import(benchmark::State& state, const CorpusScene& scene, const truvixx::SceneImporter& importer, const std::vector<uint64_t>& phase_ns)
+{
+    const truvixx::LoadStats& stats = importer.get_stats();
+    const auto iterations = static_cast<double>(state.iterations());
+
+    state.SetBytesProcessed(static_cast<int64_t>(scene.file_size) * state.iterations());
+    state.counters["vertices/s"] = benchmark::Counter(static_cast<double>(stats.vertex_count) * iterations, benchmark::Counter::kIsRate);
+    state.counters["scene_MiB"] = static_cast<double>(stats.scene_bytes) / MIB;
+    state.counters["source_MiB"] = static_cast<double>(stats.source_bytes) / MIB;
+    state.counters["peak_rss_MiB"] = static_cast<double>(peak_rss_bytes()) / MIB;
+
+    for (size_t i = 0; i < truvixx::LOAD_PHASE_COUNT; ++i)
+    {
+        if (phase_ns[i] == 0)
+            continue;
+
+        // "truvixx::parse" -> "parse_ms"
+        std::string name = truvixx::load_phase_name(static_cast<truvixx::LoadPhase>(i));
+        name = name.substr(name.rfind(':') + 1) + "_ms";
+        state.counters[name] = benchmark::Counter(static_cast<double>(phase_ns[i]) / 1.0e6, benchmark::Counter::kAvgIterations);
+    }
+}
+
+/// SceneImporter::load，不使用场景缓存
+void bm_import(benchmark::State& state, const CorpusScene& scene, const truvixx::SceneLoadOptions& options)
+{
+    truvixx::SceneImporter importer;
+    importer.set_cache_dir({});
+
+    std::vector<uint64_t> phase_ns(truvixx::LOAD_PHASE_COUNT, 0);
+    for (auto _ : state)
+    {
+        if (!importer.load(scene.path, options))
+        {
+            state.SkipWithError("SceneImporter::load failed");
+            return;
+        }
+        const auto& stats = importer.get_stats();
+        for (size_t i = 0; i < truvixx::LOAD_PHASE_COUNT; ++i)
+            phase_ns[i] += stats.phase_ns[i];
+    }
+    report_import(state, scene, importer, phase_ns);
+}
+
+/// SceneImporter::load_from_memory，不使用场景缓存
+///
+/// 文件内容预先读入内存，与 import/default 对比可以看出文件读取本身的开销
+void bm_import_memory(benchmark::State& state, const CorpusScene& scene)
+{
+    std::vector<std::byte> data(scene.file_size);
+    std::ifstream file(scene.path, std::ios::binary);
+    if (!file.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(data.size())))
+    {
+        state.SkipWithError("failed to read scene file");
+        return;
+    }
+    const std::string hint = scene.path.extension().string();
+
+    truvixx::SceneImporter importer;
+    importer.set_cache_dir({});
+
+    std::vector<uint64_t> phase_ns(truvixx::LOAD_PHASE_COUNT, 0);
+    for (auto _ : state)
+    {
+        if (!importer.load_from_memory(data, hint, {}, scene.path.parent_path()))
+        {
+            state.SkipWithError("SceneImporter::load_from_memory failed");
+            return;
+        }
+        const auto& stats = importer.get_stats();
+        for (size_t i = 0; i < truvixx::LOAD_PHASE_COUNT; ++i)
+            phase_ns[i] += stats.phase_ns[i];
+    }
+    report_import(state, scene, importer, phase_ns);
+}
+
+/// SceneImporter::load，命中场景缓存
+void bm_import_cached(benchmark::State& state, const CorpusScene& scene, const std::filesystem::path& cache_dir)
+{
+    truvixx::SceneImporter importer;
+    importer.set_cache_dir(cache_dir);
+
+    // 预热：写入缓存
+    if (!importer.load(scene.path))
+    {
+        state.SkipWithError("SceneImporter::load failed");
+        return;
+    }
+
+    std::vector<uint64_t> phase_ns(truvixx::LOAD_PHASE_COUNT, 0);
+    for (auto _ : state)
+    {
+        if (!importer.load(scene.path) || !importer.is_from_cache())
+        {
+            state.SkipWithError("scene cache was not hit");
+            return;
+        }
+        const auto& stats = importer.get_stats();
+        for (size_t i = 0; i < truvixx::LOAD_PHASE_COUNT; ++i)
+            phase_ns[i] += stats.phase_ns[i];
+    }
+    report_import(state, scene, importer, phase_ns);
+}
+
+/// 通过 C API 加载的场景，用于 mesh 访问路径的基准
+struct LoadedScene
+{
+    TruvixxSceneHandle handle = nullptr;
+    std::vector<TruvixxMeshInfo> mesh_infos;
+    uint64_t stream_bytes = 0; ///< 每次遍历所有 mesh 复制的字节数
+
+    explicit LoadedScene(const CorpusScene& scene)
+    {
+        handle = truvixx_scene_load(scene.path.string().c_str());
+        if (truvixx_scene_poll(handle) != TruvixxLoadStatusSuccess)
+            return;
+
+        mesh_infos.resize(truvixx_scene_mesh_count(handle));
+        for (uint32_t i = 0; i < mesh_infos.size(); ++i)
+        {
+            truvixx_mesh_get_info(handle, i, &mesh_infos[i]);
+            stream_bytes += static_cast<uint64_t>(mesh_infos[i].vertex_count) * (sizeof(TruvixxFloat3) * 3 + sizeof(TruvixxFloat2)) +
+                static_cast<uint64_t>(mesh_infos[i].total_index_count) * sizeof(uint32_t);
+        }
+    }
+
+    ~LoadedScene()
+    {
+        truvixx_scene_free(handle);
+    }
+
+    LoadedScene(const LoadedScene&) = delete;
+    LoadedScene& operator=(const LoadedScene&) = delete;
+
+    [[nodiscard]] bool ok() const
+    {
+        return truvixx_scene_poll(handle) == TruvixxLoadStatusSuccess;
+    }
+
+    /// 按最大的 mesh 分配的目标 buffer
+    [[nodiscard]] std::vector<float> make_vertex_buffer() const
+    {
+        uint32_t max_vertices = 0;
+        for (const auto& info : mesh_infos)
+            max_vertices = std::max(max_vertices, info.vertex_count);
+        return std::vector<float>(static_cast<size_t>(max_vertices) * 3);
+    }
+
+    [[nodiscard]] std::vector<uint32_t> make_index_buffer() const
+    {
+        uint32_t max_indices = 0;
+        for (const auto& info : mesh_infos)
+            max_indices = std::max(max_indices, info.total_index_count);
+        return std::vector<uint32_t>(max_indices);
+    }
+};
+
+void report_streams(benchmark::State& state, const LoadedScene& loaded)
+{
+    uint64_t vertex_count = 0;
+    for (const auto& info : loaded.mesh_infos)
+        vertex_count += info.vertex_count;
+
+    const auto iterations = static_cast<double>(state.iterations());
+    state.SetBytesProcessed(static_cast<int64_t>(loaded.stream_bytes) * state.iterations());
+    state.counters["vertices/s"] = benchmark::Counter(static_cast<double>(vertex_count) * iterations, benchmark::Counter::kIsRate);
+}
+
+/// truvixx_mesh_fill_*：复制所有 mesh 的顶点流和索引
+void bm_fill_streams(benchmark::State& state, const CorpusScene& scene)
+{
+    const LoadedScene loaded(scene);
+    if (!loaded.ok())
+    {
+        state.SkipWithError("truvixx_scene_load failed");
+        return;
+    }
+
+    auto vertices = loaded.make_vertex_buffer();
+    auto indices = loaded.make_index_buffer();
+    for (auto _ : state)
+    {
+        for (uint32_t i = 0; i < loaded.mesh_infos.size(); ++i)
+        {
+            truvixx_mesh_fill_positions(loaded.handle, i, vertices.data());
+            truvixx_mesh_fill_normals(loaded.handle, i, vertices.data());
+            truvixx_mesh_fill_tangents(loaded.handle, i, vertices.data());
+            truvixx_mesh_fill_uvs(loaded.handle, i, vertices.data());
+            truvixx_mesh_fill_indices(loaded.handle, i, indices.data());
+            benchmark::ClobberMemory();
+        }
+    }
+    report_streams(state, loaded);
+}
+
+/// truvixx_mesh_get_*：取得零拷贝指针后复制到目标 buffer (与 Rust 侧上传顶点的方式一致)
+void bm_get_streams(benchmark::State& state, const CorpusScene& scene)
+{
+    const LoadedScene loaded(scene);
+    if (!loaded.ok())
+    {
+        state.SkipWithError("truvixx_scene_load failed");
+        return;
+    }
+
+    auto vertices = loaded.make_vertex_buffer();
+    auto indices = loaded.make_index_buffer();
+    auto copy = [](void* dst, const void* src, const size_t size) {
+        if (src)
+            std::memcpy(dst, src, size);
+    };
+    for (auto _ : state)
+    {
+        for (uint32_t i = 0; i < loaded.mesh_infos.size(); ++i)
+        {
+            const size_t vertex_count = loaded.mesh_infos[i].vertex_count;
+            copy(vertices.data(), truvixx_mesh_get_positions(loaded.handle, i), vertex_count * sizeof(TruvixxFloat3));
+            copy(vertices.data(), truvixx_mesh_get_normals(loaded.handle, i), vertex_count * sizeof(TruvixxFloat3));
+            copy(vertices.data(), truvixx_mesh_get_tangents(loaded.handle, i), vertex_count * sizeof(TruvixxFloat3));
+            copy(vertices.data(), truvixx_mesh_get_uvs(loaded.handle, i), vertex_count * sizeof(TruvixxFloat2));
+            copy(indices.data(), truvixx_mesh_get_indices(loaded.handle, i), loaded.mesh_infos[i].total_index_count * sizeof(uint32_t));
+            benchmark::ClobberMemory();
+        }
+    }
+    report_streams(state, loaded);
+}
+
+/// truvixx_scene_export_meshes：一次导出所有 mesh 到 staging buffer
+void bm_export_meshes(benchmark::State& state, const CorpusScene& scene)
+{
+    const LoadedScene loaded(scene);
+    if (!loaded.ok())
+    {
+        state.SkipWithError("truvixx_scene_load failed");
+        return;
+    }
+
+    constexpr uint32_t alignment = 16;
+    const uint64_t export_size = truvixx_scene_export_size(loaded.handle, alignment);
+    std::vector<std::byte> staging(export_size);
+    std::vector<TruvixxMeshRange> ranges(loaded.mesh_infos.size());
+    for (auto _ : state)
+    {
+        if (!truvixx_scene_export_meshes(loaded.handle, staging.data(), export_size, alignment, ranges.data()))
+        {
+            state.SkipWithError("truvixx_scene_export_meshes failed");
+            return;
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(export_size) * state.iterations());
+}
+
+/// truvixx_scene_export_interleaved，常见的光栅 pass 格式:
+/// position f32x3 | normal oct16 | tangent oct16 | uv f16x2，每顶点 24 字节
+void bm_export_interleaved(benchmark::State& state, const CorpusScene& scene)
+{
+    const LoadedScene loaded(scene);
+    if (!loaded.ok())
+    {
+        state.SkipWithError("truvixx_scene_load failed");
+        return;
+    }
+
+    const TruvixxInterleavedLayout layout{
+        .position = { .format = TruvixxVertexFormatFloat32x3, .offset = 0 },
+        .normal = { .format = TruvixxVertexFormatSnorm16x2Octahedral, .offset = 12 },
+        .tangent = { .format = TruvixxVertexFormatSnorm16x2Octahedral, .offset = 16 },
+        .uv = { .format = TruvixxVertexFormatFloat16x2, .offset = 20 },
+        .stride = 24,
+    };
+    constexpr uint32_t alignment = 16;
+    const uint64_t export_size = truvixx_scene_export_interleaved_size(loaded.handle, &layout, alignment);
+    std::vector<std::byte> staging(export_size);
+    std::vector<TruvixxMeshRange> ranges(loaded.mesh_infos.size());
+    for (auto _ : state)
+    {
+        if (!truvixx_scene_export_interleaved(loaded.handle, &layout, staging.data(), export_size, alignment, ranges.data(), nullptr))
+        {
+            state.SkipWithError("truvixx_scene_export_interleaved failed");
+            return;
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(export_size) * state.iterations());
+}
+
+/// 每帧的动画路径：采样 -> 节点矩阵 -> 所有蒙皮 mesh 的蒙皮矩阵，一次迭代相当于一个角色实例
+void bm_sample_animation(benchmark::State& state, const CorpusScene& scene, const uint32_t quantize)
+{
+    TruvixxSceneLoadOptions options{};
+    options.import_animation = 1;
+    options.quantize_animation = quantize;
+    TruvixxSceneHandle handle = truvixx_scene_load_ex(scene.path.string().c_str(), &options);
+    if (truvixx_scene_poll(handle) != TruvixxLoadStatusSuccess)
+    {
+        truvixx_scene_free(handle);
+        state.SkipWithError("truvixx_scene_load_ex failed");
+        return;
+    }
+
+    const uint32_t node_count = truvixx_scene_node_count(handle);
+    std::vector<TruvixxAnimationRecord> clips(truvixx_scene_animation_count(handle));
+    truvixx_scene_fill_animations(handle, clips.data());
+
+    std::vector<uint32_t> skinned_meshes;
+    uint32_t max_joints = 0;
+    for (uint32_t i = 0; i < truvixx_scene_mesh_count(handle); ++i)
+    {
+        TruvixxMeshSkinInfo info{};
+        truvixx_mesh_get_skin_info(handle, i, &info);
+        if (info.skinned)
+        {
+            skinned_meshes.push_back(i);
+            max_joints = std::max(max_joints, info.joint_count);
+        }
+    }
+    if (clips.empty())
+    {
+        truvixx_scene_free(handle);
+        state.SkipWithError("scene has no animation");
+        return;
+    }
+
+    std::vector<TruvixxNodeTransform> pose(node_count);
+    std::vector<TruvixxFloat4x4> node_matrices(node_count);
+    std::vector<TruvixxFloat4x4> skin_matrices(max_joints);
+
+    // 每次迭代推进半帧，覆盖帧内插值和循环回绕
+    const float step = clips[0].sample_rate > 0.f ? 0.5f / clips[0].sample_rate : 0.f;
+    float time = 0.f;
+    for (auto _ : state)
+    {
+        truvixx_animation_sample(handle, 0, time, 1, pose.data());
+        truvixx_scene_compute_node_matrices(handle, pose.data(), node_matrices.data());
+        for (const uint32_t mesh : skinned_meshes)
+            truvixx_mesh_compute_skin_matrices(handle, mesh, node_matrices.data(), skin_matrices.data());
+        benchmark::ClobberMemory();
+        time += step;
+    }
+    state.counters["nodes"] = node_count;
+    state.counters["skinned_meshes"] = static_cast<double>(skinned_meshes.size());
+    state.counters["instances/s"] = benchmark::Counter(static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+    truvixx_scene_free(handle);
+}
+
+/// 分块场景的流式路径：相机沿场景包围盒对角线往返，预算为全部 mesh 的 1/4，一次迭代为一帧的 update
+void bm_stream_tiled(benchmark::State& state, const CorpusScene& scene, const std::filesystem::path& cache_dir)
+{
+    std::error_code ec;
+    std::filesystem::create_directories(cache_dir, ec);
+    const auto tiled_path = (cache_dir / std::format("{}.tvxtiled", scene.name)).string();
+    if (!truvixx_scene_convert_tiled(scene.path.string().c_str(), tiled_path.c_str(), nullptr, nullptr))
+    {
+        state.SkipWithError("truvixx_scene_convert_tiled failed");
+        return;
+    }
+
+    TruvixxTiledSceneHandle tiled = truvixx_tiled_scene_open(tiled_path.c_str(), 0);
+    const uint32_t tile_count = truvixx_tiled_scene_tile_count(tiled);
+    if (tile_count == 0)
+    {
+        truvixx_tiled_scene_free(tiled);
+        state.SkipWithError("scene has no tiles");
+        return;
+    }
+
+    std::vector<TruvixxTileRecord> tiles(tile_count);
+    truvixx_tiled_scene_fill_tiles(tiled, tiles.data());
+    TruvixxAabb bounds = tiles[0].bounds;
+    for (const auto& tile : tiles)
+    {
+        for (int c = 0; c < 3; ++c)
+        {
+            bounds.min.v[c] = std::min(bounds.min.v[c], tile.bounds.min.v[c]);
+            bounds.max.v[c] = std::max(bounds.max.v[c], tile.bounds.max.v[c]);
+        }
+    }
+
+    // 先全部读入一次得到 mesh 总量，再按 1/4 的预算从空开始
+    std::vector<uint32_t> all_tiles(tile_count);
+    for (uint32_t i = 0; i < tile_count; ++i)
+        all_tiles[i] = i;
+    TruvixxTileStreamStats stats{};
+    truvixx_tiled_scene_update_tiles(tiled, all_tiles.data(), tile_count);
+    truvixx_tiled_scene_get_stats(tiled, &stats);
+    const uint64_t total_bytes = stats.resident_bytes;
+    truvixx_tiled_scene_set_budget(tiled, std::max<uint64_t>(total_bytes / 4, 1));
+    truvixx_tiled_scene_update_tiles(tiled, nullptr, 0);
+
+    TruvixxFloat3 diagonal;
+    for (int c = 0; c < 3; ++c)
+        diagonal.v[c] = bounds.max.v[c] - bounds.min.v[c];
+    const float radius = std::sqrt(diagonal.x * diagonal.x + diagonal.y * diagonal.y + diagonal.z * diagonal.z) / 8.f;
+
+    constexpr uint32_t STEPS = 64;
+    uint64_t frame = 0;
+    uint64_t loaded_bytes = 0;
+    uint64_t evicted = 0;
+    for (auto _ : state)
+    {
+        // 0 -> STEPS -> 0 往返
+        const uint64_t phase = frame++ % (STEPS * 2);
+        const float t = static_cast<float>(phase < STEPS ? phase : STEPS * 2 - phase) / STEPS;
+        TruvixxFloat3 camera;
+        for (int c = 0; c < 3; ++c)
+            camera.v[c] = bounds.min.v[c] + diagonal.v[c] * t;
+
+        truvixx_tiled_scene_update_camera(tiled, &camera, radius);
+        truvixx_tiled_scene_get_stats(tiled, &stats);
+        loaded_bytes += stats.loaded_bytes;
+        evicted += stats.evicted_mesh_count;
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(loaded_bytes));
+    state.counters["tiles"] = tile_count;
+    state.counters["total_MiB"] = static_cast<double>(total_bytes) / MIB;
+    state.counters["evicted/frame"] =
+        benchmark::Counter(static_cast<double>(evicted), benchmark::Counter::kAvgIterations);
+    truvixx_tiled_scene_free(tiled);
+}
+
+/// 读取线程数量，与加载用的线程池同时运行
+constexpr uint32_t CONCURRENT_READER_COUNT = 4;
+
+/// 零拷贝指针与 fill 的结果一致 (索引只比较 fill 写入的 LOD0)
+bool check_mesh(const TruvixxSceneHandle handle, const uint32_t mesh_index)
+{
+    TruvixxMeshInfo info{};
+    if (!truvixx_mesh_get_info(handle, mesh_index, &info))
+        return false;
+    if (info.vertex_count == 0 || info.index_count == 0)
+        return true;
+
+    std::vector<float> positions(static_cast<size_t>(info.vertex_count) * 3);
+    const TruvixxFloat3* position_ptr = truvixx_mesh_get_positions(handle, mesh_index);
+    if (!position_ptr || !truvixx_mesh_fill_positions(handle, mesh_index, positions.data()) ||
+        std::memcmp(positions.data(), position_ptr, positions.size() * sizeof(float)) != 0)
+        return false;
+
+    std::vector<uint32_t> indices(info.index_count);
+    if (!truvixx_mesh_fill_indices(handle, mesh_index, indices.data()))
+        return false;
+    if (info.index_format == TruvixxIndexFormatUint16)
+    {
+        const uint16_t* index_ptr = truvixx_mesh_get_indices16(handle, mesh_index);
+        return index_ptr && std::equal(indices.begin(), indices.end(), index_ptr);
+    }
+    const uint32_t* index_ptr = truvixx_mesh_get_indices(handle, mesh_index);
+    return index_ptr && std::equal(indices.begin(), indices.end(), index_ptr);
+}
+
+/// 加载完成后场景级访问结果的摘要，所有线程应得到相同的值
+uint64_t scene_digest(const TruvixxSceneHandle handle)
+{
+    const uint32_t mesh_count = truvixx_scene_mesh_count(handle);
+    const uint32_t instance_count = truvixx_scene_instance_count(handle);
+    uint64_t digest = truvixx::fnv1a(&mesh_count, sizeof(mesh_count));
+    digest = truvixx::fnv1a(&instance_count, sizeof(instance_count), digest);
+
+    TruvixxAabb bounds{};
+    if (truvixx_scene_get_bounds(handle, &bounds))
+        digest = truvixx::fnv1a(&bounds, sizeof(bounds), digest);
+
+    std::vector<TruvixxInstanceRecord> instances(instance_count);
+    if (truvixx_scene_fill_instances(handle, instances.data()))
+    {
+        for (const auto& inst : instances)
+            digest = truvixx::fnv1a(&inst.world_bounds, sizeof(inst.world_bounds), digest);
+    }
+
+    // query 的结果顺序不保证，只比较数量
+    std::vector<uint32_t> hits(instance_count);
+    const uint32_t hit_count = truvixx_scene_query_aabb(handle, &bounds, hits.data(), instance_count);
+    digest = truvixx::fnv1a(&hit_count, sizeof(hit_count), digest);
+
+    for (uint32_t i = 0; i < mesh_count; ++i)
+    {
+        TruvixxMeshInfo info{};
+        truvixx_mesh_get_info(handle, i, &info);
+        digest = truvixx::fnv1a(&info, sizeof(info), digest);
+    }
+    return digest;
+}
+
+/// 异步加载时多个线程通过 truvixx_scene_pop_ready_mesh 消费 mesh 并读取其数据，
+/// 加载结束后所有线程再同时读取全部 mesh 和场景级数据
+///
+/// 用于在 ThreadSanitizer 下验证 TruvixxSceneHandle 的线程安全约定 (见 build.md)，
+/// 数据不一致时报错
+void bm_concurrent_readers(benchmark::State& state, const CorpusScene& scene)
+{
+    const auto path = scene.path.string();
+    for (auto _ : state)
+    {
+        const TruvixxSceneHandle handle = truvixx_scene_load_async(path.c_str(), nullptr, nullptr, nullptr);
+        std::atomic<uint32_t> popped = 0;
+        std::atomic<uint32_t> errors = 0;
+        std::vector<uint64_t> digests(CONCURRENT_READER_COUNT);
+        {
+            std::vector<std::jthread> readers;
+            for (uint32_t t = 0; t < CONCURRENT_READER_COUNT; ++t)
+            {
+                readers.emplace_back([&, t] {
+                    uint32_t mesh_index = 0;
+                    while (truvixx_scene_pop_ready_mesh(handle, TRUVIXX_WAIT_INFINITE, &mesh_index))
+                    {
+                        popped.fetch_add(1, std::memory_order_relaxed);
+                        if (!check_mesh(handle, mesh_index))
+                            errors.fetch_add(1, std::memory_order_relaxed);
+                    }
+
+                    if (truvixx_scene_wait(handle) != TruvixxLoadStatusSuccess)
+                        return;
+                    for (uint32_t i = 0; i < truvixx_scene_mesh_count(handle); ++i)
+                    {
+                        if (!check_mesh(handle, i))
+                            errors.fetch_add(1, std::memory_order_relaxed);
+                    }
+                    digests[t] = scene_digest(handle);
+                });
+            }
+        }
+
+        const bool loaded = truvixx_scene_poll(handle) == TruvixxLoadStatusSuccess;
+        const bool consistent = loaded && errors == 0 && popped == truvixx_scene_mesh_count(handle) &&
+            std::ranges::all_of(digests, [&](const uint64_t d) { return d == digests[0]; });
+        truvixx_scene_free(handle);
+        if (!loaded)
+        {
+            state.SkipWithError("truvixx_scene_load_async failed");
+            return;
+        }
+        if (!consistent)
+        {
+            state.SkipWithError("concurrent readers observed inconsistent scene data");
+            return;
+        }
+    }
+    state.counters["readers"] = CONCURRENT_READER_COUNT;
+}
+
+void print_usage(const char* program)
+{
+    std::cerr << std::format(
+        "Usage: {} [benchmark options] <scene file or directory>...\n"
+        "  Directories are searched recursively for .fbx / .gltf / .glb / .obj files.\n"
+        "  TRUVIXX_BENCH_CORPUS can name an additional file or directory.\n"
+        "  Compare runs with --benchmark_out=<file> --benchmark_out_format=json.\n",
+        program
+    );
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    benchmark::Initialize(&argc, argv);
+
+    // Initialize 移除了 benchmark 自身的参数，剩下的都是语料
+    std::vector<std::string> inputs(argv + 1, argv + argc);
+    if (const char* env = std::getenv("TRUVIXX_BENCH_CORPUS"); env && *env)
+        inputs.emplace_back(env);
+
+    const auto corpus = collect_corpus(inputs);
+    if (corpus.empty())
+    {
+        print_usage(argv[0]);
+        return -1;
+    }
+
+    const auto cache_dir = std::filesystem::temp_directory_path() / "truvixx-bench-cache";
+    const auto configs = import_configs();
+    for (const auto& scene : corpus)
+    {
+        // 名称以 const char* 传入以兼容旧版 Google Benchmark，注册时会被复制
+        auto register_bm = [](const std::string& name, auto&& fn, auto&&... args) {
+            return benchmark::RegisterBenchmark(name.c_str(), fn, args...);
+        };
+
+        for (const auto& config : configs)
+        {
+            register_bm(std::format("import/{}/{}", config.name, scene.name), bm_import, scene, config.options)
+                ->Unit(benchmark::kMillisecond)
+                ->UseRealTime();
+        }
+        register_bm(std::format("import/memory/{}", scene.name), bm_import_memory, scene)
+            ->Unit(benchmark::kMillisecond)
+            ->UseRealTime();
+        register_bm(std::format("import/cached/{}", scene.name), bm_import_cached, scene, cache_dir)
+            ->Unit(benchmark::kMillisecond)
+            ->UseRealTime();
+
+        register_bm(std::format("mesh_fill/{}", scene.name), bm_fill_streams, scene)->Unit(benchmark::kMicrosecond);
+        register_bm(std::format("mesh_get/{}", scene.name), bm_get_streams, scene)->Unit(benchmark::kMicrosecond);
+        register_bm(std::format("export_meshes/{}", scene.name), bm_export_meshes, scene)->Unit(benchmark::kMicrosecond);
+        register_bm(std::format("export_interleaved/{}", scene.name), bm_export_interleaved, scene)
+            ->Unit(benchmark::kMicrosecond);
+        register_bm(std::format("animation/float/{}", scene.name), bm_sample_animation, scene, 0u)->Unit(benchmark::kMicrosecond);
+        register_bm(std::format("animation/quantized/{}", scene.name), bm_sample_animation, scene, 1u)
+            ->Unit(benchmark::kMicrosecond);
+        register_bm(std::format("stream/{}", scene.name), bm_stream_tiled, scene, cache_dir)
+            ->Unit(benchmark::kMicrosecond)
+            ->UseRealTime();
+        register_bm(std::format("concurrent/{}", scene.name), bm_concurrent_readers, scene)
+            ->Unit(benchmark::kMillisecond)
+            ->UseRealTime();
+    }
+
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+
+    std::error_code ec;
+    std::filesystem::remove_all(cache_dir, ec);
+    return 0;
+}
@@ -3,6 +3,8 @@
 #include "TruvixxAssimp/base_type.h"
 #include "TruvixxInterface/truvixx_interface.export.h"
 
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -17,8 +19,231 @@ typedef enum : uint32_t
 } ResType;
 
 /// 场景句柄 (不透明指针)
+///
+/// 线程安全:
+/// - 加载完成 (truvixx_scene_poll 返回 Success) 后句柄只读，除 truvixx_scene_reload / truvixx_scene_free 外
+///   的所有函数都可以在任意多个线程中同时调用；返回的数据指针在 reload / free 之前一直有效
+/// - truvixx_scene_reload / truvixx_scene_free 需要独占句柄：调用期间不能有其他线程访问同一句柄，
+///   也不能再使用之前取得的指针
+/// - 异步加载期间 truvixx_mesh_* 可以在多个线程中读取已就绪的 mesh；
+///   truvixx_scene_pop_ready_mesh 可以被多个线程同时调用，每个 mesh 只会被取出一次
+/// - fill / export 函数只写入调用方提供的 buffer，多个线程同时调用时各自使用不同的输出即可
+///
+/// truvixx-bench 的 concurrent/<scene> 在 ThreadSanitizer 下验证以上约定 (见 build.md)
 typedef struct TruvixxScene* TruvixxSceneHandle;
 
+/// 批量加载的场景集合句柄 (不透明指针)
+/// truvixx_scene_set_load 返回后只读，线程安全规则与 TruvixxSceneHandle 相同 (truvixx_scene_set_free 需要独占)
+typedef struct TruvixxSceneSet* TruvixxSceneSetHandle;
+
+/// 分块流式场景句柄 (不透明指针)，线程安全规则见 "分块流式场景"
+typedef struct TruvixxTiledScene* TruvixxTiledSceneHandle;
+
+/// 场景加载状态
+typedef enum : uint32_t
+{
+    TruvixxLoadStatusLoading = 0,
+    TruvixxLoadStatusSuccess = 1,
+    TruvixxLoadStatusFailed = 2,
+} TruvixxLoadStatus;
+
+/// 无限等待
+#define TRUVIXX_WAIT_INFINITE 0xFFFFFFFFu
+
+/// mesh 就绪回调
+/// 在加载线程 (并行模式下为线程池线程) 中调用，可能被多个线程同时调用
+/// @param user_data truvixx_scene_load_async 传入的 user_data
+/// @param scene 场景句柄，回调内可以访问该 mesh 的数据
+/// @param mesh_index 已就绪的 mesh 索引
+typedef void (*TruvixxMeshReadyCallback)(void* user_data, TruvixxSceneHandle scene, uint32_t mesh_index);
+
+/// 性能分析区间回调，用于转发给 Tracy 等工具
+/// 每个导入阶段 (TruvixxLoadPhase) 开始时 begin = 1、结束时 begin = 0；同一区间的开始和结束在同一线程，区间在线程内严格嵌套
+/// mesh 内部步骤在并行模式下从线程池线程调用
+/// @param user_data TruvixxSceneLoadOptions::profile_user_data
+/// @param name 阶段名称，静态字符串
+typedef void (*TruvixxProfileZoneCallback)(void* user_data, const char* name, uint32_t begin);
+
+/// 场景字符串 blob 中的一个字符串 (见 truvixx_scene_get_strings)
+/// blob + offset 处是以 '\0' 结尾的完整字符串，不会被截断
+typedef struct
+{
+    uint32_t offset;
+    uint32_t length; ///< 不含结尾的 '\0'
+} TruvixxStringRef;
+
+/// 材质的纹理槽位
+typedef enum : uint32_t
+{
+    TruvixxTextureSlotBaseColor = 0,
+    TruvixxTextureSlotNormal,
+    TruvixxTextureSlotMetallicRoughness,
+    TruvixxTextureSlotEmissive,
+    TruvixxTextureSlotOcclusion,
+
+    TruvixxTextureSlotCount,
+} TruvixxTextureSlot;
+
+/// 材质槽位没有纹理
+#define TRUVIXX_NO_TEXTURE 0xFFFFFFFFu
+
+/// 纹理清单中的一项
+/// 同一场景中相同的外部路径 / 同一个内嵌纹理只出现一次
+typedef struct
+{
+    TruvixxStringRef path;        ///< 外部纹理为绝对路径; 内嵌纹理为材质中的原始引用 ("*0" 或内嵌文件名)
+    TruvixxStringRef format_hint; ///< 外部纹理为小写扩展名; 压缩的内嵌纹理为 "png" / "jpg" 等, 未压缩的为 "bgra8"
+
+    const void* data; ///< 内嵌纹理数据 (不拷贝, 场景释放前有效), 外部纹理为 NULL
+    uint64_t size;    ///< 内嵌纹理为数据字节数, 外部纹理为文件大小 (不存在时为 0)
+
+    /// 内容标识, 可作为转码结果 (BC7 / ASTC 等) 的缓存键
+    /// 内嵌纹理为数据的哈希; 外部纹理为 (路径, 文件大小, 修改时间) 的哈希
+    uint64_t hash;
+
+    uint32_t width;  ///< 仅未压缩的内嵌纹理 (BGRA8), 其余为 0
+    uint32_t height; ///< 仅未压缩的内嵌纹理 (BGRA8), 其余为 0
+    uint32_t embedded;
+} TruvixxTextureRecord;
+
+/// 纹理就绪回调，纹理清单中的每一项在哈希计算完成后调用，早于所有 mesh
+/// 用于在 mesh 转换的同时开始读取 / 解码 / 转码纹理；并行模式下可能被多个线程同时调用
+/// @param user_data TruvixxSceneLoadOptions::texture_user_data
+/// @param texture_index 在场景纹理清单中的下标
+/// @param record 纹理记录, 其中的字符串引用在加载完成前无法访问, 改用 path / format_hint
+/// @param path 与 record->path 相同的字符串, 只在回调期间有效
+/// @param format_hint 与 record->format_hint 相同的字符串, 只在回调期间有效
+typedef void (*TruvixxTextureReadyCallback)(
+    void* user_data,
+    uint32_t texture_index,
+    const TruvixxTextureRecord* record,
+    const char* path,
+    const char* format_hint
+);
+
+/// 可选的后处理步骤 (位掩码)
+/// 三角化、顶点去重、按图元类型拆分、UV 翻转总是执行
+typedef enum : uint32_t
+{
+    TruvixxPostProcessGenNormals = 1u << 0,                ///< 为缺少法线的 mesh 生成法线
+    TruvixxPostProcessCalcTangents = 1u << 1,              ///< 计算切线
+    TruvixxPostProcessImproveCacheLocality = 1u << 2,      ///< Assimp 顶点缓存优化
+    TruvixxPostProcessOptimizeMeshes = 1u << 3,            ///< 合并 mesh 以减少 draw call
+    TruvixxPostProcessRemoveRedundantMaterials = 1u << 4, ///< 去除重复 / 未使用的材质
+
+    TruvixxPostProcessDefault = TruvixxPostProcessGenNormals | TruvixxPostProcessCalcTangents,
+} TruvixxPostProcess;
+
+/// 顶点属性 (位掩码)，position 和索引总是保留
+typedef enum : uint32_t
+{
+    TruvixxVertexAttributeNormal = 1u << 0,
+    TruvixxVertexAttributeTangent = 1u << 1, ///< 切线依赖法线，保留切线时法线也会保留
+    TruvixxVertexAttributeUv = 1u << 2,
+
+    TruvixxVertexAttributeAll = TruvixxVertexAttributeNormal | TruvixxVertexAttributeTangent | TruvixxVertexAttributeUv,
+} TruvixxVertexAttribute;
+
+/// 单个 LOD 层级的简化参数
+typedef struct
+{
+    float target_ratio; ///< 目标索引数量相对 LOD0 的比例, (0, 1]
+    float target_error; ///< 允许的最大误差, 相对 mesh 尺寸 (0.01 表示 1%)
+} TruvixxLodLevel;
+
+/// 场景加载选项
+/// 全部字段为 0 时与 truvixx_scene_load 行为一致
+typedef struct
+{
+    uint32_t parallel;                 ///< 非 0 时使用线程池并行转换 mesh 和材质，输出与串行一致
+    uint32_t optimize_meshes;          ///< 非 0 时对 mesh 做顶点缓存 / overdraw / 顶点拉取重排
+    uint32_t compact_indices;          ///< 非 0 时顶点数不超过 65536 的 mesh 使用 16 位索引
+    uint32_t build_meshlets;           ///< 非 0 时将 mesh 划分为 meshlet 并计算包围球 / 法线锥
+    uint32_t lod_level_count;          ///< lod_levels 的长度, 0 表示不生成 LOD
+    const TruvixxLodLevel* lod_levels; ///< LOD 1..N 的简化参数
+    uint32_t override_post_process;    ///< 非 0 时使用 post_process, 否则使用 TruvixxPostProcessDefault
+    uint32_t post_process;             ///< TruvixxPostProcess 位掩码
+    uint32_t strip_attributes;         ///< 丢弃的 TruvixxVertexAttribute, 0 表示全部保留
+    uint32_t release_source;           ///< 非 0 时顶点流拷贝到一块连续内存，转换后立即释放 Assimp 场景
+    uint32_t build_instance_batches;   ///< 非 0 时按 (mesh, 材质) 将实例分组为实例化批次
+    uint32_t skip_empty_nodes;         ///< 非 0 时只输出引用了 mesh 的 instance
+    uint32_t merge_static_meshes;      ///< 非 0 时将只被引用一次的 mesh 按材质预变换并合并，多次引用的 mesh 保持实例化
+    uint32_t build_instance_bvh;       ///< 非 0 时在 instance 包围盒上构建 BVH，供 truvixx_scene_query_* 使用
+    uint32_t import_animation;         ///< 非 0 时导入蒙皮、变形目标和动画片段 (见 "蒙皮与动画")
+    float animation_sample_rate;       ///< 动画重采样帧率 (帧 / 秒), 0 表示 30
+    uint32_t quantize_animation;       ///< 非 0 时动画关键帧量化存储 (每帧每通道 20 字节)
+    uint32_t validate_meshes;          ///< 非 0 时转换后校验并修复 mesh (越界 / 退化三角形、NaN、法线长度)
+
+    TruvixxProfileZoneCallback profile_zone_callback; ///< 性能分析区间回调, 可为 NULL
+    void* profile_user_data;                          ///< 透传给 profile_zone_callback
+
+    TruvixxTextureReadyCallback texture_ready_callback; ///< 纹理就绪回调, 可为 NULL
+    void* texture_user_data;                            ///< 透传给 texture_ready_callback
+} TruvixxSceneLoadOptions;
+
+/// 导入阶段
+/// CacheRead ~ CacheWrite 依次执行 (墙钟时间)；MeshConvert ~ MeshPack 是 Meshes 内部的步骤，
+/// 按所有 mesh 累加，并行模式下是多个线程的时间之和
+typedef enum : uint32_t
+{
+    TruvixxLoadPhaseCacheRead = 0,   ///< 读取场景缓存
+    TruvixxLoadPhaseParse,           ///< Assimp 解析文件
+    TruvixxLoadPhasePostProcess,     ///< Assimp 后处理 (全部步骤作为一个整体)
+    TruvixxLoadPhaseMaterials,       ///< 材质转换和纹理清单
+    TruvixxLoadPhaseTextures,        ///< 纹理哈希和纹理就绪回调
+    TruvixxLoadPhaseMeshes,          ///< mesh 规划与转换 (包含下列各步骤)
+    TruvixxLoadPhaseNodes,           ///< 节点树遍历
+    TruvixxLoadPhaseInstanceBatches, ///< 实例化批次
+    TruvixxLoadPhaseInstanceBvh,     ///< 实例 BVH
+    TruvixxLoadPhaseCacheWrite,      ///< 写入场景缓存
+
+    TruvixxLoadPhaseMeshConvert,      ///< aiMesh 转换 (包括静态 mesh 合并)
+    TruvixxLoadPhaseMeshOptimize,     ///< mesh 优化
+    TruvixxLoadPhaseMeshMeshlets,     ///< meshlet 划分
+    TruvixxLoadPhaseMeshLods,         ///< LOD 生成
+    TruvixxLoadPhaseMeshCompactIndex, ///< 16 位索引
+    TruvixxLoadPhaseMeshPack,         ///< 顶点流搬入紧凑内存
+
+    TruvixxLoadPhaseAnimations, ///< 节点树和动画片段重采样 (import_animation)
+
+    TruvixxLoadPhaseMeshValidate, ///< mesh 校验与修复 (validate_meshes)，Meshes 内部的步骤
+
+    TruvixxLoadPhaseCount,
+} TruvixxLoadPhase;
+
+/// 一次加载的耗时和统计
+typedef struct
+{
+    uint64_t phase_ns[TruvixxLoadPhaseCount]; ///< 各阶段耗时 (纳秒), 下标为 TruvixxLoadPhase, 未执行的阶段为 0
+    uint64_t total_ns;                        ///< 加载总耗时 (纳秒)
+
+    uint32_t mesh_count;
+    uint32_t material_count;
+    uint32_t instance_count;
+    uint32_t meshlet_count;
+    uint32_t texture_count;
+    uint32_t embedded_texture_count;
+    uint64_t vertex_count;
+    uint64_t index_count;        ///< 包含所有 LOD
+    uint64_t dropped_face_count; ///< 被丢弃的非三角形面 (点、线), 命中缓存时为 0
+
+    uint32_t repaired_mesh_count;    ///< 校验时被修改的 mesh 数量, 逐 mesh 的结果见 truvixx_mesh_get_validation
+    uint64_t removed_triangle_count; ///< 校验时移除的三角形总数
+
+    uint64_t scene_bytes;  ///< 场景数据持有的堆内存
+    uint64_t source_bytes; ///< Assimp 场景占用的内存, 命中缓存时为 0
+    uint64_t mapped_bytes; ///< 场景缓存映射的文件大小, 未命中时为 0
+
+    uint32_t from_cache; ///< 非 0 表示命中场景缓存
+} TruvixxLoadStats;
+
+/// 索引格式
+typedef enum : uint32_t
+{
+    TruvixxIndexFormatUint32 = 0,
+    TruvixxIndexFormatUint16 = 1,
+} TruvixxIndexFormat;
+
 /// 材质信息
 typedef struct
 {
@@ -42,6 +267,33 @@ typedef struct
     unsigned int mesh_count;
 } TruvixxInstance;
 
+/// 材质记录 (批量访问)
+typedef struct
+{
+    TruvixxFloat4 base_color;
+    TruvixxFloat4 emissive;
+    float roughness;
+    float metallic;
+    float opacity;
+
+    TruvixxStringRef name;
+    TruvixxStringRef diffuse_map; ///< 外部纹理的绝对路径, 没有或为内嵌纹理时长度为 0
+    TruvixxStringRef normal_map;
+
+    uint32_t textures[TruvixxTextureSlotCount]; ///< 各槽位 (TruvixxTextureSlot) 的纹理清单下标, 没有时为 TRUVIXX_NO_TEXTURE
+} TruvixxMaterialRecord;
+
+/// Instance 记录 (批量访问)
+typedef struct
+{
+    TruvixxFloat4x4 world_transform; ///< 世界变换矩阵
+    TruvixxStringRef name;
+    uint32_t ref_offset; ///< 在 truvixx_scene_get_instance_mesh_refs / material_refs 中的起始下标
+    uint32_t mesh_count;
+    TruvixxAabb world_bounds; ///< 世界空间包围盒, mesh_count 为 0 时为空 (min > max); 蒙皮 mesh 按绑定姿态计算
+    uint32_t node;            ///< 对应的节点下标 (truvixx_scene_fill_nodes), 未导入动画时为 TRUVIXX_NO_NODE
+} TruvixxInstanceRecord;
+
 /// Mesh 元信息 (用于预分配 buffer)
 typedef struct
 {
@@ -51,8 +303,63 @@ typedef struct
     uint32_t has_normals;
     uint32_t has_tangents;
     uint32_t has_uvs;
+
+    uint32_t index_format; ///< TruvixxIndexFormat, 决定 get_indices / get_indices16 哪个可用
+
+    uint32_t lod_count;         ///< LOD 层级数 (包含 LOD0), 至少为 1
+    uint32_t total_index_count; ///< 包含所有 LOD 的索引数量, get_indices / get_indices16 的有效长度
+
+    TruvixxAabb bounds; ///< 局部空间包围盒
 } TruvixxMeshInfo;
 
+/// 单个 LOD 层级在 mesh 索引中的范围
+///
+/// 所有层级共享顶点流，按 error 选择 LOD:
+///     屏幕空间误差 = error / distance * (viewport_height / (2 * tan(fov_y / 2)))
+typedef struct
+{
+    uint32_t index_offset; ///< 相对 mesh 索引起始的下标
+    uint32_t index_count;
+    float error; ///< 相对 LOD0 的几何误差 (mesh 局部空间距离), LOD0 为 0, 随层级单调不减
+} TruvixxMeshLod;
+
+/// Mesh 优化统计
+/// ACMR: 每个三角形的平均顶点变换次数 (16 项 FIFO 缓存模型)，越低越好
+typedef struct
+{
+    float acmr_before; ///< 优化前 ACMR
+    float acmr_after;  ///< 优化后 ACMR, 未启用优化时与 acmr_before 相同
+} TruvixxMeshOptimizeStats;
+
+/// Mesh 几何校验与修复的结果 (validate_meshes)，未校验时全部为 0
+typedef struct
+{
+    uint32_t dropped_faces;          ///< 转换时丢弃的非三角形面 (点、线)
+    uint32_t out_of_range_triangles; ///< 索引越界的三角形, 已移除
+    uint32_t non_finite_triangles;   ///< 引用了 NaN / Inf position 的三角形, 已移除
+    uint32_t degenerate_triangles;   ///< 顶点重复或三点共线的三角形, 已移除
+    uint32_t removed_vertices;       ///< 不再被引用、被压缩掉的顶点 (含 NaN / Inf position)
+    uint32_t denormal_positions;     ///< 含非规格化分量的 position, 这些分量已置 0
+    uint32_t repaired_normals;       ///< 重新归一化或替换的法线
+    uint32_t repaired_tangents;      ///< 重新归一化或替换的切线
+    uint32_t non_finite_uvs;         ///< NaN / Inf uv, 已置 0
+} TruvixxMeshValidation;
+
+/// 重新加载时一项变化的类型
+typedef enum : uint32_t
+{
+    TruvixxSceneChangeAdded = 0,   ///< 只在新场景中存在
+    TruvixxSceneChangeRemoved = 1, ///< 只在旧场景中存在
+    TruvixxSceneChangeChanged = 2, ///< 两次都存在但内容不同
+} TruvixxSceneChangeKind;
+
+/// 重新加载时的一项变化 (mesh 或材质)
+typedef struct
+{
+    uint32_t index; ///< mesh / 材质下标; Removed 为旧场景中的下标
+    TruvixxSceneChangeKind kind;
+} TruvixxSceneChange;
+
 #pragma region 场景生命周期
 
 /// 加载场景文件
@@ -60,12 +367,164 @@ typedef struct
 /// @return 场景句柄, 失败返回 NULL
 TruvixxSceneHandle TRUVIXX_INTERFACE_API truvixx_scene_load(const char* path);
 
+/// 使用加载选项加载场景文件
+/// @param path 文件路径 (UTF-8)
+/// @param options 加载选项, 为 NULL 时使用默认选项
+/// @return 场景句柄, 失败返回 NULL
+TruvixxSceneHandle TRUVIXX_INTERFACE_API truvixx_scene_load_ex(const char* path, const TruvixxSceneLoadOptions* options);
+
+/// 从内存加载场景 (归档包、网络下载等)，不需要先写入临时文件
+///
+/// 同步加载，返回后 data 即可释放
+/// @param data 场景文件的完整内容
+/// @param size data 的字节数
+/// @param format_hint 文件扩展名 ("glb", "fbx", "obj" 等), 用于选择导入器
+/// @param base_dir 外部资源 (纹理、.bin、.mtl) 相对路径的基准目录 (UTF-8), 为 NULL 时使用当前工作目录
+/// @param options 加载选项, 可为 NULL
+/// @return 场景句柄, data 或 format_hint 为 NULL 时返回 NULL
+TruvixxSceneHandle TRUVIXX_INTERFACE_API truvixx_scene_load_from_memory(
+    const void* data,
+    uint64_t size,
+    const char* format_hint,
+    const char* base_dir,
+    const TruvixxSceneLoadOptions* options
+);
+
+/// 异步加载场景文件，立即返回
+///
+/// 加载过程中:
+/// - mesh 访问函数 (truvixx_mesh_*) 只对已就绪的 mesh 有效
+/// - 场景级访问 (数量、instance、材质、导出等) 在加载完成前返回失败
+/// @param path 文件路径 (UTF-8)
+/// @param options 加载选项, 可为 NULL
+/// @param callback mesh 就绪回调, 可为 NULL (可改用 truvixx_scene_pop_ready_mesh 轮询)
+/// @param user_data 透传给 callback
+/// @return 场景句柄, path 为 NULL 时返回 NULL
+TruvixxSceneHandle TRUVIXX_INTERFACE_API truvixx_scene_load_async(
+    const char* path,
+    const TruvixxSceneLoadOptions* options,
+    TruvixxMeshReadyCallback callback,
+    void* user_data
+);
+
+/// 查询加载状态 (不阻塞)
+TruvixxLoadStatus TRUVIXX_INTERFACE_API truvixx_scene_poll(TruvixxSceneHandle scene);
+
+/// 阻塞直到加载结束
+/// @return 最终状态 (Success 或 Failed)
+TruvixxLoadStatus TRUVIXX_INTERFACE_API truvixx_scene_wait(TruvixxSceneHandle scene);
+
+/// 加载中已确定的 mesh 总数，mesh 数组分配前为 0
+uint32_t TRUVIXX_INTERFACE_API truvixx_scene_pending_mesh_count(TruvixxSceneHandle scene);
+
+/// 从就绪队列中取出一个 mesh 索引
+///
+/// 队列为空时最多等待 timeout_ms 毫秒 (TRUVIXX_WAIT_INFINITE 表示一直等待)，
+/// 加载结束且队列为空时立即返回失败，因此可以用 while 循环消费所有 mesh
+/// @param out_mesh_index [out] 取到的 mesh 索引
+/// @return 取到返回 1, 超时或已全部取完返回 0
+ResType TRUVIXX_INTERFACE_API truvixx_scene_pop_ready_mesh(TruvixxSceneHandle scene, uint32_t timeout_ms, uint32_t* out_mesh_index);
+
 /// 释放场景
+/// 异步加载尚未结束时会阻塞等待加载线程退出
 /// @param scene 场景句柄 (可以为 NULL)
 void TRUVIXX_INTERFACE_API truvixx_scene_free(TruvixxSceneHandle scene);
 
 #pragma endregion
 
+#pragma region 热重载
+// 重新导入同一个场景并按内容哈希与上一次的结果比较，调用方只需重新上传变化的 mesh / 材质
+// mesh 与材质按下标对应：未变化的下标保持原有的 GPU 资源即可
+
+/// 在原句柄上重新加载场景文件 (同步)
+///
+/// 之前取得的 mesh 数据指针、字符串引用全部失效；异步加载尚未结束时先等待其结束。
+/// 不能用于场景集合中的场景 (集合的共享材质不会随之更新)
+/// @param path 文件路径 (UTF-8), 通常与上一次加载相同
+/// @param options 加载选项, 可为 NULL
+/// @return 成功返回 1; 失败返回 0, 场景状态变为 TruvixxLoadStatusFailed
+ResType TRUVIXX_INTERFACE_API truvixx_scene_reload(
+    TruvixxSceneHandle scene,
+    const char* path,
+    const TruvixxSceneLoadOptions* options
+);
+
+/// 最近一次重新加载中变化的 mesh 数量，未重新加载过时为 0
+uint32_t TRUVIXX_INTERFACE_API truvixx_scene_mesh_change_count(TruvixxSceneHandle scene);
+
+/// 批量获取变化的 mesh，按下标升序
+/// @param out [out] 大小 >= truvixx_scene_mesh_change_count
+ResType TRUVIXX_INTERFACE_API truvixx_scene_fill_mesh_changes(TruvixxSceneHandle scene, TruvixxSceneChange* out);
+
+/// 最近一次重新加载中变化的材质数量 (包括引用的纹理文件被修改)
+uint32_t TRUVIXX_INTERFACE_API truvixx_scene_material_change_count(TruvixxSceneHandle scene);
+
+/// 批量获取变化的材质，按下标升序
+/// @param out [out] 大小 >= truvixx_scene_material_change_count
+ResType TRUVIXX_INTERFACE_API truvixx_scene_fill_material_changes(TruvixxSceneHandle scene, TruvixxSceneChange* out);
+
+/// 最近一次重新加载中实例的变换或引用是否变化 (需要重建 TLAS)
+/// @return 变化返回 1, 否则返回 0
+uint32_t TRUVIXX_INTERFACE_API truvixx_scene_instances_changed(TruvixxSceneHandle scene);
+
+#pragma endregion
+
+#pragma region 批量加载
+// 在共享线程池上同时导入多个文件，并对所有文件的材质和纹理路径去重
+// 集合中的每个场景都可以用 truvixx_scene_* / truvixx_mesh_* 访问，但由集合持有，不能单独 truvixx_scene_free
+
+/// 批量加载场景文件，所有文件加载结束后返回
+///
+/// 单个文件加载失败不影响其他文件，对应场景的状态为 TruvixxLoadStatusFailed
+/// @param paths 文件路径数组 (UTF-8)
+/// @param path_count 文件数量
+/// @param options 所有文件共用的加载选项, 可为 NULL
+/// @return 集合句柄, paths 为 NULL 时返回 NULL
+TruvixxSceneSetHandle TRUVIXX_INTERFACE_API truvixx_scene_set_load(
+    const char* const* paths,
+    uint32_t path_count,
+    const TruvixxSceneLoadOptions* options
+);
+
+/// 集合中的场景数量 (与 path_count 相同)
+uint32_t TRUVIXX_INTERFACE_API truvixx_scene_set_count(TruvixxSceneSetHandle set);
+
+/// 获取第 index 个场景 (与 paths 顺序一致)，由集合持有
+/// @return 场景句柄, 越界返回 NULL
+TruvixxSceneHandle TRUVIXX_INTERFACE_API truvixx_scene_set_get(TruvixxSceneSetHandle set, uint32_t index);
+
+/// 去重后的材质数量
+/// PBR 参数和纹理路径都相同的材质视为同一个，名称取第一次出现的
+uint32_t TRUVIXX_INTERFACE_API truvixx_scene_set_material_count(TruvixxSceneSetHandle set);
+
+/// 批量获取去重后的材质，字符串引用 truvixx_scene_set_get_strings
+/// @param out [out] 大小 >= truvixx_scene_set_material_count
+ResType TRUVIXX_INTERFACE_API truvixx_scene_set_fill_materials(TruvixxSceneSetHandle set, TruvixxMaterialRecord* out);
+
+/// 去重后的纹理数量
+/// 相同路径的外部纹理、内容相同的内嵌纹理视为同一个
+uint32_t TRUVIXX_INTERFACE_API truvixx_scene_set_texture_count(TruvixxSceneSetHandle set);
+
+/// 批量获取去重后的纹理清单，按第一次被引用的顺序
+/// 字符串引用 truvixx_scene_set_get_strings，truvixx_scene_set_fill_materials 中的纹理下标指向这里
+/// @param out [out] 大小 >= truvixx_scene_set_texture_count
+ResType TRUVIXX_INTERFACE_API truvixx_scene_set_fill_textures(TruvixxSceneSetHandle set, TruvixxTextureRecord* out);
+
+/// 集合共享表的字符串 blob，与单个场景的字符串 blob 相互独立
+const char* TRUVIXX_INTERFACE_API truvixx_scene_set_get_strings(TruvixxSceneSetHandle set);
+
+uint32_t TRUVIXX_INTERFACE_API truvixx_scene_set_strings_size(TruvixxSceneSetHandle set);
+
+/// 场景材质 -> 去重后材质的映射
+/// @return 长度为 truvixx_scene_material_count(场景) 的数组；越界、加载失败或没有材质时返回 NULL
+const uint32_t* TRUVIXX_INTERFACE_API truvixx_scene_set_get_material_remap(TruvixxSceneSetHandle set, uint32_t index);
+
+/// 释放集合及其中的所有场景
+/// @param set 集合句柄 (可以为 NULL)
+void TRUVIXX_INTERFACE_API truvixx_scene_set_free(TruvixxSceneSetHandle set);
+
+#pragma endregion
+
 #pragma region Scene
 
 /// 获取 mesh 数量
@@ -77,6 +536,21 @@ uint32_t TRUVIXX_INTERFACE_API truvixx_scene_material_count(TruvixxSceneHandle s
 /// 获取 instance 数量
 uint32_t TRUVIXX_INTERFACE_API truvixx_scene_instance_count(TruvixxSceneHandle scene);
 
+/// 获取场景世界空间包围盒 (所有 instance 包围盒的并集)
+/// @return 成功返回 1, 失败返回 0; 没有 instance 时包围盒为空 (min > max)
+ResType TRUVIXX_INTERFACE_API truvixx_scene_get_bounds(TruvixxSceneHandle scene, TruvixxAabb* out);
+
+/// 获取 instance 世界空间包围盒
+ResType TRUVIXX_INTERFACE_API truvixx_instance_get_bounds(TruvixxSceneHandle scene, uint32_t index, TruvixxAabb* out);
+
+/// 获取加载耗时和统计
+/// @return 成功返回 1, 加载未完成或失败返回 0
+ResType TRUVIXX_INTERFACE_API truvixx_scene_get_stats(TruvixxSceneHandle scene, TruvixxLoadStats* out);
+
+/// 导入阶段名称 (与 profile_zone_callback 收到的 name 一致)
+/// @return 静态字符串, phase 越界时返回 "truvixx::unknown"
+const char* TRUVIXX_INTERFACE_API truvixx_load_phase_name(TruvixxLoadPhase phase);
+
 #pragma endregion
 
 #pragma region Instance访问
@@ -103,12 +577,168 @@ ResType TRUVIXX_INTERFACE_API truvixx_instance_get_refs(
 
 #pragma endregion
 
+#pragma region 实例空间查询
+// 需要以 build_instance_bvh 加载，否则不返回任何结果
+// 查询只读，可以在多个线程中同时调用
+// 返回命中总数，只写入前 capacity 个；返回值大于 capacity 时可以扩大 buffer 重新查询
+
+/// 射线，参数范围 [t_min, t_max]
+typedef struct
+{
+    TruvixxFloat3 origin;
+    TruvixxFloat3 direction; ///< 不要求归一化
+    float t_min;
+    float t_max;
+} TruvixxRay;
+
+/// 射线命中
+typedef struct
+{
+    uint32_t instance_index;
+    float t; ///< 射线进入 instance 包围盒的参数
+} TruvixxRayHit;
+
+/// 是否构建了 BVH (没有可索引的 instance 时也为 0)
+uint32_t TRUVIXX_INTERFACE_API truvixx_scene_has_bvh(TruvixxSceneHandle scene);
+
+/// 包围盒与射线相交的 instance，按 t 从近到远排序
+uint32_t TRUVIXX_INTERFACE_API truvixx_scene_query_ray(
+    TruvixxSceneHandle scene,
+    const TruvixxRay* ray,
+    TruvixxRayHit* out_hits,
+    uint32_t capacity
+);
+
+/// 包围盒与视锥相交的 instance (保守测试)
+/// @param planes 6 个平面, xyz = 指向视锥内部的法线, w = d, 点 p 在内侧当且仅当 dot(n, p) + d >= 0
+uint32_t TRUVIXX_INTERFACE_API truvixx_scene_query_frustum(
+    TruvixxSceneHandle scene,
+    const TruvixxFloat4* planes,
+    uint32_t* out_instances,
+    uint32_t capacity
+);
+
+/// 包围盒与 box 重叠的 instance
+uint32_t TRUVIXX_INTERFACE_API truvixx_scene_query_aabb(
+    TruvixxSceneHandle scene,
+    const TruvixxAabb* box,
+    uint32_t* out_instances,
+    uint32_t capacity
+);
+
+#pragma endregion
+
+#pragma region 实例化批次
+
+/// 实例化批次数量，加载时未开启 build_instance_batches 时为 0
+///
+/// 每个 (instance, mesh) 引用恰好属于一个批次，可以直接用于 instanced draw 和 TLAS instance
+uint32_t TRUVIXX_INTERFACE_API truvixx_scene_batch_count(TruvixxSceneHandle scene);
+
+/// 批次数组，长度为 truvixx_scene_batch_count，没有批次时返回 NULL
+const TruvixxInstanceBatch* TRUVIXX_INTERFACE_API truvixx_scene_get_batches(TruvixxSceneHandle scene);
+
+/// 所有批次的世界变换 (列主序)，长度为所有批次 instance_count 之和，没有批次时返回 NULL
+/// 同一批次的变换连续存放，可以直接上传为实例 buffer
+const TruvixxFloat4x4* TRUVIXX_INTERFACE_API truvixx_scene_get_batch_transforms(TruvixxSceneHandle scene);
+
+/// 批次变换数组的长度
+uint32_t TRUVIXX_INTERFACE_API truvixx_scene_batch_transform_count(TruvixxSceneHandle scene);
+
+#pragma endregion
+
 #pragma region 材质访问
 
 ResType TRUVIXX_INTERFACE_API truvixx_material_get(TruvixxSceneHandle scene, uint32_t mat_index, TruvixxMat* out);
 
 #pragma endregion
 
+#pragma region 批量元数据
+// 一次调用取得所有材质 / instance，字符串以偏移引用同一个字符串 blob，返回的指针在场景释放前有效
+
+/// 字符串 blob，所有 TruvixxStringRef 都相对于它
+const char* TRUVIXX_INTERFACE_API truvixx_scene_get_strings(TruvixxSceneHandle scene);
+
+/// 字符串 blob 的字节数 (包含所有 '\0')
+uint32_t TRUVIXX_INTERFACE_API truvixx_scene_strings_size(TruvixxSceneHandle scene);
+
+/// 填充所有材质记录
+/// @param out [out] 大小 >= truvixx_scene_material_count
+/// @return 成功返回 1, 失败返回 0
+ResType TRUVIXX_INTERFACE_API truvixx_scene_fill_materials(TruvixxSceneHandle scene, TruvixxMaterialRecord* out);
+
+/// 纹理清单的长度 (所有材质所有槽位引用的纹理，已去重)
+uint32_t TRUVIXX_INTERFACE_API truvixx_scene_texture_count(TruvixxSceneHandle scene);
+
+/// 填充纹理清单
+/// 内嵌纹理的 data 直接指向导入器内存，可以交给多个线程同时解码
+/// @param out [out] 大小 >= truvixx_scene_texture_count
+/// @return 成功返回 1, 失败返回 0
+ResType TRUVIXX_INTERFACE_API truvixx_scene_fill_textures(TruvixxSceneHandle scene, TruvixxTextureRecord* out);
+
+/// 填充所有 instance 记录
+/// @param out [out] 大小 >= truvixx_scene_instance_count
+/// @return 成功返回 1, 失败返回 0
+ResType TRUVIXX_INTERFACE_API truvixx_scene_fill_instances(TruvixxSceneHandle scene, TruvixxInstanceRecord* out);
+
+/// 所有 instance 的 mesh / 材质引用总数
+uint32_t TRUVIXX_INTERFACE_API truvixx_scene_instance_ref_count(TruvixxSceneHandle scene);
+
+/// 所有 instance 的 mesh 引用，按 instance 顺序连续存放，没有引用时返回 NULL
+const uint32_t* TRUVIXX_INTERFACE_API truvixx_scene_get_instance_mesh_refs(TruvixxSceneHandle scene);
+
+/// 所有 instance 的材质引用，与 mesh 引用一一对应，没有引用时返回 NULL
+const uint32_t* TRUVIXX_INTERFACE_API truvixx_scene_get_instance_material_refs(TruvixxSceneHandle scene);
+
+#pragma endregion
+
+#pragma region 批量导出
+
+/// 单个 mesh 在 staging buffer 中的布局 (字节偏移，相对 staging buffer 起始)
+///
+/// 顶点流按 position | normal | tangent | uv 紧密排列 (与 Rust 侧 VertexLayoutSoA3D 一致)，
+/// 因此 [vertex_offset, vertex_offset + vertex_size) 可以整体拷贝到一个 SoA vertex buffer
+/// 缺失的 normal / tangent 以 0 填充，保证布局统一
+typedef struct
+{
+    uint64_t vertex_offset; ///< 顶点块起始，按 alignment 对齐
+    uint64_t vertex_size;   ///< 顶点块字节数
+    uint64_t position_offset;
+    uint64_t normal_offset;
+    uint64_t tangent_offset;
+    uint64_t uv_offset;
+    uint64_t index_offset; ///< 索引起始，按 alignment 对齐
+    uint64_t index_size;   ///< 索引字节数, 包含所有 LOD (见 TruvixxMeshLod)
+    uint32_t vertex_count;
+    uint32_t index_count; ///< LOD0 的索引数量
+    uint32_t index_format; ///< TruvixxIndexFormat, 索引按 mesh 自身的格式导出
+} TruvixxMeshRange;
+
+/// 计算导出全部 mesh 所需的 staging buffer 大小
+/// @param scene 场景句柄
+/// @param alignment 每个顶点块 / 索引块的对齐字节数 (2 的幂), 0 表示 16
+/// @return 所需字节数, 失败返回 0
+TRUVIXX_INTERFACE_API uint64_t truvixx_scene_export_size(TruvixxSceneHandle scene, uint32_t alignment);
+
+/// 将全部 mesh 的 SoA 顶点流和索引一次性写入调用方提供的 staging 内存
+///
+/// 数据只从导入器内存拷贝一次，dst 可以是持久映射的 Vulkan upload buffer
+/// @param scene 场景句柄
+/// @param dst [out] staging 内存起始地址
+/// @param dst_size dst 字节数, 必须 >= truvixx_scene_export_size(scene, alignment)
+/// @param alignment 与 truvixx_scene_export_size 相同
+/// @param out_ranges [out] 每个 mesh 的布局表 (大小 >= mesh_count)
+/// @return 成功返回 1, 失败返回 0
+TRUVIXX_INTERFACE_API ResType truvixx_scene_export_meshes(
+    TruvixxSceneHandle scene,
+    void* dst,
+    uint64_t dst_size,
+    uint32_t alignment,
+    TruvixxMeshRange* out_ranges
+);
+
+#pragma endregion
+
 #pragma region Mesh访问
 // SOA 布局, 查询-分配-填充模式
 
@@ -123,13 +753,574 @@ TRUVIXX_INTERFACE_API ResType truvixx_mesh_fill_positions(TruvixxSceneHandle sce
 TRUVIXX_INTERFACE_API ResType truvixx_mesh_fill_normals(TruvixxSceneHandle scene, uint32_t mesh_index, float* out);
 TRUVIXX_INTERFACE_API ResType truvixx_mesh_fill_tangents(TruvixxSceneHandle scene, uint32_t mesh_index, float* out);
 TRUVIXX_INTERFACE_API ResType truvixx_mesh_fill_uvs(TruvixxSceneHandle scene, uint32_t mesh_index, float* out);
+/// 只填充 LOD0 (index_count 个)；16 位索引的 mesh 会扩展为 32 位
 TRUVIXX_INTERFACE_API ResType truvixx_mesh_fill_indices(TruvixxSceneHandle scene, uint32_t mesh_index, uint32_t* out);
+/// 32 位索引的 mesh 仅在顶点数不超过 65536 时可以压缩为 16 位，否则失败
+TRUVIXX_INTERFACE_API ResType truvixx_mesh_fill_indices16(TruvixxSceneHandle scene, uint32_t mesh_index, uint16_t* out);
 
 TRUVIXX_INTERFACE_API const TruvixxFloat3* truvixx_mesh_get_positions(TruvixxSceneHandle scene, uint32_t mesh_index);
 TRUVIXX_INTERFACE_API const TruvixxFloat3* truvixx_mesh_get_normals(TruvixxSceneHandle scene, uint32_t mesh_index);
 TRUVIXX_INTERFACE_API const TruvixxFloat3* truvixx_mesh_get_tangents(TruvixxSceneHandle scene, uint32_t mesh_index);
 TRUVIXX_INTERFACE_API const TruvixxFloat2* truvixx_mesh_get_uvs(TruvixxSceneHandle scene, uint32_t mesh_index);
+/// 仅当 index_format 为 TruvixxIndexFormatUint32 时非 NULL
 TRUVIXX_INTERFACE_API const uint32_t* truvixx_mesh_get_indices(TruvixxSceneHandle scene, uint32_t mesh_index);
+/// 仅当 index_format 为 TruvixxIndexFormatUint16 时非 NULL
+TRUVIXX_INTERFACE_API const uint16_t* truvixx_mesh_get_indices16(TruvixxSceneHandle scene, uint32_t mesh_index);
+
+/// 获取 LOD 层级表
+/// @param out [out] 大小 >= TruvixxMeshInfo::lod_count
+TRUVIXX_INTERFACE_API ResType truvixx_mesh_fill_lods(TruvixxSceneHandle scene, uint32_t mesh_index, TruvixxMeshLod* out);
+
+/// 获取单个 mesh 的优化统计
+TRUVIXX_INTERFACE_API ResType truvixx_mesh_get_optimize_stats(TruvixxSceneHandle scene, uint32_t mesh_index, TruvixxMeshOptimizeStats* out);
+
+/// 获取单个 mesh 的校验结果，命中场景缓存时为写入缓存时的结果
+TRUVIXX_INTERFACE_API ResType truvixx_mesh_get_validation(TruvixxSceneHandle scene, uint32_t mesh_index, TruvixxMeshValidation* out);
+
+/// 获取整个场景的校验结果 (所有 mesh 之和)
+TRUVIXX_INTERFACE_API ResType truvixx_scene_get_validation(TruvixxSceneHandle scene, TruvixxMeshValidation* out);
+
+/// 获取整个场景的优化统计 (按三角形数量加权平均)
+TRUVIXX_INTERFACE_API ResType truvixx_scene_get_optimize_stats(TruvixxSceneHandle scene, TruvixxMeshOptimizeStats* out);
+
+#pragma endregion
+
+#pragma region Meshlet访问
+// SoA 布局: meshlets / spheres / cones / cone_apexes 下标一一对应
+// 需要以 build_meshlets 加载，否则 meshlet_count 为 0
+//
+// meshlet i 的第 t 个三角形的顶点 k (k < 3):
+//     vertex_index = vertices[meshlets[i].vertex_offset + triangles[meshlets[i].triangle_offset + t * 3 + k]]
+// 法线锥剔除 (view 为相机位置):
+//     dot(normalize(cone_apex - view), cone.xyz) >= cone.w 时整个 meshlet 背向相机
+
+/// meshlet 元信息 (用于预分配 buffer)
+typedef struct
+{
+    uint32_t meshlet_count;
+    uint32_t vertex_count;  ///< meshlet 顶点表长度 (uint32 个数)
+    uint32_t triangle_size; ///< meshlet 三角形表字节数
+    uint32_t max_vertices;  ///< 单个 meshlet 的顶点数上限
+    uint32_t max_triangles; ///< 单个 meshlet 的三角形数上限
+} TruvixxMeshletInfo;
+
+/// 获取 mesh 的 meshlet 元信息
+/// @param scene 场景句柄
+/// @param mesh_index mesh 索引
+/// @param out [out] meshlet 元信息
+/// @return 成功返回 1, 失败返回 0
+TRUVIXX_INTERFACE_API ResType truvixx_mesh_get_meshlet_info(TruvixxSceneHandle scene, uint32_t mesh_index, TruvixxMeshletInfo* out);
+
+/// meshlet 描述，长度为 meshlet_count
+TRUVIXX_INTERFACE_API const TruvixxMeshlet* truvixx_mesh_get_meshlets(TruvixxSceneHandle scene, uint32_t mesh_index);
+/// meshlet 局部顶点 -> mesh 顶点索引，长度为 vertex_count
+TRUVIXX_INTERFACE_API const uint32_t* truvixx_mesh_get_meshlet_vertices(TruvixxSceneHandle scene, uint32_t mesh_index);
+/// meshlet 局部三角形 (每个三角形 3 字节)，长度为 triangle_size 字节
+TRUVIXX_INTERFACE_API const uint8_t* truvixx_mesh_get_meshlet_triangles(TruvixxSceneHandle scene, uint32_t mesh_index);
+/// 包围球，xyz = 球心, w = 半径
+TRUVIXX_INTERFACE_API const TruvixxFloat4* truvixx_mesh_get_meshlet_spheres(TruvixxSceneHandle scene, uint32_t mesh_index);
+/// 法线锥，xyz = 轴, w = cutoff
+TRUVIXX_INTERFACE_API const TruvixxFloat4* truvixx_mesh_get_meshlet_cones(TruvixxSceneHandle scene, uint32_t mesh_index);
+/// 法线锥顶点
+TRUVIXX_INTERFACE_API const TruvixxFloat3* truvixx_mesh_get_meshlet_cone_apexes(TruvixxSceneHandle scene, uint32_t mesh_index);
+
+#pragma endregion
+
+#pragma region 量化导出
+// 每顶点 20 字节 (position 8 + normal 4 + tangent 4 + uv 4)，全精度为 44 字节
+
+/// 量化 uv 格式
+typedef enum : uint32_t
+{
+    TruvixxUvFormatHalf = 0,    ///< half2 (R16G16_SFLOAT)，不需要反量化参数，支持 repeat 寻址的大范围 uv
+    TruvixxUvFormatUnorm16 = 1, ///< unorm16x2 (R16G16_UNORM)，相对 uv 包围盒，精度更均匀
+} TruvixxUvFormat;
+
+/// 每个量化顶点流中单个顶点的字节数
+#define TRUVIXX_QUANTIZED_POSITION_STRIDE 8u ///< unorm16x4 (R16G16B16A16_UNORM), w 恒为 0
+#define TRUVIXX_QUANTIZED_NORMAL_STRIDE 4u   ///< 八面体编码 snorm16x2 (R16G16_SNORM)
+#define TRUVIXX_QUANTIZED_TANGENT_STRIDE 4u  ///< 八面体编码 snorm16x2 (R16G16_SNORM)
+#define TRUVIXX_QUANTIZED_UV_STRIDE 4u       ///< half2 或 unorm16x2
+
+/// 单个 mesh 的反量化参数
+///
+/// position = position_offset + q.xyz * position_scale (q 为 unorm 归一化后的 [0, 1])
+/// uv       = uv_offset + q.xy * uv_scale               (仅 TruvixxUvFormatUnorm16)
+/// normal / tangent 八面体解码:
+///     n = (e.x, e.y, 1 - |e.x| - |e.y|); if (n.z < 0) n.xy = (1 - |n.yx|) * sign(n.xy); normalize(n)
+typedef struct
+{
+    TruvixxFloat3 position_offset; ///< mesh AABB 最小值
+    TruvixxFloat3 position_scale;  ///< mesh AABB 尺寸
+    TruvixxFloat2 uv_offset;       ///< uv 包围盒最小值
+    TruvixxFloat2 uv_scale;        ///< uv 包围盒尺寸
+} TruvixxDequantParams;
+
+/// 获取 mesh 的反量化参数
+/// @param scene 场景句柄
+/// @param mesh_index mesh 索引
+/// @param out [out] 反量化参数
+/// @return 成功返回 1, 失败返回 0
+TRUVIXX_INTERFACE_API ResType truvixx_mesh_get_dequant_params(TruvixxSceneHandle scene, uint32_t mesh_index, TruvixxDequantParams* out);
+
+/// 将 mesh 顶点流量化后写入调用方 buffer (SoA)
+///
+/// 每个输出指针可以为 NULL 表示跳过该流；非 NULL 但 mesh 缺少该属性时失败
+/// buffer 大小为 vertex_count * TRUVIXX_QUANTIZED_*_STRIDE
+/// @param scene 场景句柄
+/// @param mesh_index mesh 索引
+/// @param uv_format uv 量化格式
+/// @param out_positions [out] unorm16x4
+/// @param out_normals [out] snorm16x2
+/// @param out_tangents [out] snorm16x2
+/// @param out_uvs [out] half2 / unorm16x2
+/// @param out_params [out] 反量化参数，可以为 NULL
+/// @return 成功返回 1, 失败返回 0
+TRUVIXX_INTERFACE_API ResType truvixx_mesh_fill_quantized(
+    TruvixxSceneHandle scene,
+    uint32_t mesh_index,
+    TruvixxUvFormat uv_format,
+    uint16_t* out_positions,
+    int16_t* out_normals,
+    int16_t* out_tangents,
+    uint16_t* out_uvs,
+    TruvixxDequantParams* out_params
+);
+
+#pragma endregion
+
+#pragma region 交错导出
+// 按调用方描述的格式把顶点交错 (AoS) 写成单个顶点流，适用于只需要一个 vertex binding 的光栅 pass 和第三方中间件
+// 每种格式组合由编译期特化的写入函数处理，逐顶点一次写完所有属性
+
+/// 交错顶点中单个属性的存储格式
+///
+/// 每种属性只支持其中一部分，其余组合视为非法布局:
+/// - position: Float32x3 / Float16x4 (w = 1) / Unorm16x4 (相对 mesh AABB, w = 0, 见 TruvixxDequantParams)
+/// - normal / tangent: Float32x3 / Snorm8x4 (w = 0) / Snorm16x2Octahedral (八面体编码, 解码见 TruvixxDequantParams)
+/// - uv: Float32x2 / Float16x2 / Unorm16x2 (相对 uv 包围盒)
+typedef enum : uint32_t
+{
+    TruvixxVertexFormatNone = 0,                ///< 不输出该属性
+    TruvixxVertexFormatFloat32x2 = 1,           ///< R32G32_SFLOAT
+    TruvixxVertexFormatFloat32x3 = 2,           ///< R32G32B32_SFLOAT
+    TruvixxVertexFormatFloat16x2 = 3,           ///< R16G16_SFLOAT
+    TruvixxVertexFormatFloat16x4 = 4,           ///< R16G16B16A16_SFLOAT
+    TruvixxVertexFormatUnorm16x2 = 5,           ///< R16G16_UNORM
+    TruvixxVertexFormatUnorm16x4 = 6,           ///< R16G16B16A16_UNORM
+    TruvixxVertexFormatSnorm8x4 = 7,            ///< R8G8B8A8_SNORM
+    TruvixxVertexFormatSnorm16x2Octahedral = 8, ///< R16G16_SNORM
+} TruvixxVertexFormat;
+
+/// 交错顶点中的一个属性
+typedef struct
+{
+    TruvixxVertexFormat format;
+    uint32_t offset; ///< 相对顶点起始的字节偏移
+} TruvixxVertexAttributeDesc;
+
+/// 交错顶点格式，属性之间不能重叠，且都必须落在 stride 之内
+typedef struct
+{
+    TruvixxVertexAttributeDesc position;
+    TruvixxVertexAttributeDesc normal;
+    TruvixxVertexAttributeDesc tangent;
+    TruvixxVertexAttributeDesc uv;
+    uint32_t stride; ///< 相邻顶点之间的字节数
+} TruvixxInterleavedLayout;
+
+/// 将 mesh 的顶点按交错格式写入调用方 buffer
+///
+/// mesh 缺少的属性 (normal / tangent / uv) 以 0 填充
+/// @param layout 交错格式
+/// @param out [out] 大小 >= vertex_count * layout->stride
+/// @param out_size out 的字节数
+/// @param out_params [out] 反量化参数 (Unorm16 的 position / uv 需要), 可以为 NULL
+/// @return 成功返回 1, 布局非法或 buffer 不足返回 0
+TRUVIXX_INTERFACE_API ResType truvixx_mesh_fill_interleaved(
+    TruvixxSceneHandle scene,
+    uint32_t mesh_index,
+    const TruvixxInterleavedLayout* layout,
+    void* out,
+    uint64_t out_size,
+    TruvixxDequantParams* out_params
+);
+
+/// 计算以交错格式导出全部 mesh 所需的 staging buffer 大小
+/// @param alignment 每个顶点块 / 索引块的对齐字节数 (2 的幂), 0 表示 16
+/// @return 所需字节数, 布局非法或失败返回 0
+TRUVIXX_INTERFACE_API uint64_t
+truvixx_scene_export_interleaved_size(TruvixxSceneHandle scene, const TruvixxInterleavedLayout* layout, uint32_t alignment);
+
+/// 将全部 mesh 的交错顶点和索引一次性写入 staging 内存
+///
+/// out_ranges 中 vertex_offset / vertex_size 为交错顶点块；position / normal / tangent / uv_offset
+/// 为该属性第一个元素的位置 (步长为 layout->stride)，未输出的属性其值无意义
+/// @param dst [out] staging 内存起始地址
+/// @param dst_size dst 字节数, 必须 >= truvixx_scene_export_interleaved_size(scene, layout, alignment)
+/// @param alignment 与 truvixx_scene_export_interleaved_size 相同
+/// @param out_ranges [out] 每个 mesh 的布局表 (大小 >= mesh_count)
+/// @param out_params [out] 每个 mesh 的反量化参数 (大小 >= mesh_count), 可以为 NULL
+/// @return 成功返回 1, 失败返回 0
+TRUVIXX_INTERFACE_API ResType truvixx_scene_export_interleaved(
+    TruvixxSceneHandle scene,
+    const TruvixxInterleavedLayout* layout,
+    void* dst,
+    uint64_t dst_size,
+    uint32_t alignment,
+    TruvixxMeshRange* out_ranges,
+    TruvixxDequantParams* out_params
+);
+
+#pragma endregion
+
+#pragma region GPU 场景表
+// 直接写出 shader 侧 GPUScene 引用的表 (TruvixxGpuInstance / TruvixxGpuMaterial / TruvixxGpuGeometry 与两个间接索引表)，
+// 所有表位于同一块内存，整块上传后 GPUScene 的各指针为 buffer device address + TruvixxGpuTableLayout 中对应段的偏移:
+//     all_instances = address + instance_offset, all_mats = address + material_offset, ...
+//
+// 每个 mesh 是一个 geometry，instance 的第 i 个 submesh 对应第 i 个 mesh 引用
+
+/// 与 shader 侧 INVALID_TEX_ID 一致
+#define TRUVIXX_INVALID_SRV_HANDLE (-1)
+
+/// 写入 GPU 场景表的参数
+typedef struct
+{
+    uint32_t material_base; ///< 场景第 0 个材质在 all_mats 中的下标 (多个场景共用 GPU buffer 时使用)
+    uint32_t geometry_base; ///< 场景第 0 个 mesh 在 all_geometries 中的下标
+    uint32_t indirect_base; ///< 场景第 0 个引用在两个间接索引表中的下标
+    uint32_t sampler_type;  ///< 所有纹理使用的 ESamplerType, 通常为 LinearRepeat (2)
+
+    /// 纹理清单下标 (truvixx_scene_fill_textures) -> bindless SRV handle，可以为 NULL
+    /// 为 NULL 或下标 >= texture_count 时写入 TRUVIXX_INVALID_SRV_HANDLE
+    const int32_t* texture_srv_handles;
+    uint32_t texture_count;
+
+    /// truvixx_scene_export_meshes 得到的 SoA 布局表 (大小 >= mesh_count)，Geometry 中的顶点流要求紧密排列
+    /// 为 NULL 时 geometry 段全部写 0，由调用方另行填写
+    const TruvixxMeshRange* mesh_ranges;
+
+    /// mesh 导出 buffer 的 device address，geometry 中的地址为 mesh_buffer_address + TruvixxMeshRange 中的偏移
+    uint64_t mesh_buffer_address;
+} TruvixxGpuTableParams;
+
+/// GPU 场景表布局 (字节偏移，相对目标内存起始，每段 16 字节对齐)
+typedef struct
+{
+    uint64_t instance_offset;     ///< TruvixxGpuInstance[instance_count]
+    uint64_t material_offset;     ///< TruvixxGpuMaterial[material_count]
+    uint64_t geometry_offset;     ///< TruvixxGpuGeometry[geometry_count]
+    uint64_t geometry_map_offset; ///< uint32_t[ref_count], instance_geometry_map
+    uint64_t material_map_offset; ///< uint32_t[ref_count], instance_material_map
+    uint64_t total_size;          ///< 所需字节数
+
+    uint32_t instance_count;
+    uint32_t material_count;
+    uint32_t geometry_count; ///< 即 mesh 数量
+    uint32_t ref_count;      ///< 所有 instance 的 mesh 引用总数
+} TruvixxGpuTableLayout;
+
+/// 计算 GPU 场景表的布局
+/// @param out [out] 布局
+/// @return 成功返回 1, 失败返回 0
+TRUVIXX_INTERFACE_API ResType truvixx_scene_gpu_table_layout(TruvixxSceneHandle scene, TruvixxGpuTableLayout* out);
+
+/// 将 GPU 场景表一次性写入调用方内存 (可以是持久映射的 upload buffer)
+///
+/// Geometry 要求 SoA 顶点流和 32 位索引，mesh_ranges 不是 truvixx_scene_export_meshes 的布局
+/// (例如 truvixx_scene_export_interleaved 的交错布局，或 vertex_count 与 mesh 不符) 或有 16 位索引的 mesh
+/// (compact_indices 加载) 时失败
+/// @param params 下标偏移、纹理 handle 和 mesh 布局
+/// @param dst [out] 目标内存，16 字节对齐
+/// @param dst_size dst 字节数, 必须 >= TruvixxGpuTableLayout::total_size
+/// @return 成功返回 1, 失败返回 0
+TRUVIXX_INTERFACE_API ResType truvixx_scene_write_gpu_tables(
+    TruvixxSceneHandle scene,
+    const TruvixxGpuTableParams* params,
+    void* dst,
+    uint64_t dst_size
+);
+
+#pragma endregion
+
+#pragma region 蒙皮与动画
+// 需要以 import_animation 加载，否则节点、动画数量为 0，mesh 没有蒙皮和变形目标
+//
+// 每帧的典型流程 (不分配内存，可以在多个线程中对不同的输出 buffer 同时调用):
+//     truvixx_animation_sample(scene, clip, t, 1, pose)               // 节点局部变换
+//     truvixx_scene_compute_node_matrices(scene, pose, node_matrices) // 节点全局矩阵
+//     truvixx_mesh_compute_skin_matrices(scene, mesh, node_matrices, joint_matrices)
+// 蒙皮矩阵把绑定姿态的顶点变换到场景空间 (与 glTF 一致)，不需要再乘 mesh 所在 instance 的 world_transform
+//
+// 顶点着色器中: skinned = sum(weights[k] / 255 * joint_matrices[joints[k]] * position)
+// 变形: position += sum(weight[i] * delta_i.position)，偏移只对 delta.vertex 所指的顶点有效
+
+/// 没有对应的节点 (根节点的父节点、找不到节点的关节、未导入动画时的 instance)
+#define TRUVIXX_NO_NODE 0xFFFFFFFFu
+
+/// 节点记录，父节点总在子节点之前，顺序与 instance 的遍历顺序一致
+typedef struct
+{
+    TruvixxStringRef name;
+    uint32_t parent;           ///< 父节点下标, 根节点为 TRUVIXX_NO_NODE
+    TruvixxNodeTransform rest; ///< 没有动画时的局部变换
+} TruvixxNodeRecord;
+
+/// mesh 的蒙皮 / 变形目标信息 (用于预分配 buffer)
+typedef struct
+{
+    uint32_t skinned;            ///< 非 0 时有 vertex_count 个 TruvixxSkinVertex
+    uint32_t joint_count;        ///< 关节表长度, 不超过 256
+    uint32_t morph_target_count; ///< 变形目标数量
+    uint32_t morph_delta_count;  ///< 所有变形目标的顶点偏移总数
+} TruvixxMeshSkinInfo;
+
+/// 变形目标，顶点偏移为 truvixx_mesh_get_morph_deltas 中的 [delta_offset, delta_offset + delta_count)
+typedef struct
+{
+    uint32_t delta_offset;
+    uint32_t delta_count;
+    float default_weight; ///< 没有动画时的权重
+} TruvixxMorphTarget;
+
+/// 动画片段记录
+typedef struct
+{
+    TruvixxStringRef name;
+    float duration;                   ///< 秒
+    float sample_rate;                ///< 实际帧率, 帧 i 的时刻为 i / sample_rate; 只有一帧时为 0
+    uint32_t frame_count;
+    uint32_t channel_count;           ///< 节点通道数, 每帧 channel_count 个关键帧
+    uint32_t morph_channel_count;     ///< 变形通道数
+    uint32_t morph_weights_per_frame; ///< 每帧的变形权重数
+    uint32_t quantized;               ///< 非 0 时关键帧为 TruvixxQuantizedTransform
+} TruvixxAnimationRecord;
+
+/// 变形权重通道，对应一个 mesh 的所有变形目标
+typedef struct
+{
+    uint32_t mesh;          ///< mesh 下标
+    uint32_t weight_offset; ///< 在每帧权重中的起始下标
+    uint32_t weight_count;  ///< 即该 mesh 的变形目标数量
+} TruvixxMorphChannel;
+
+TRUVIXX_INTERFACE_API uint32_t truvixx_scene_node_count(TruvixxSceneHandle scene);
+/// @param out [out] 节点记录 (大小 >= node_count), 字符串引用见 truvixx_scene_get_strings
+TRUVIXX_INTERFACE_API ResType truvixx_scene_fill_nodes(TruvixxSceneHandle scene, TruvixxNodeRecord* out);
+
+/// 获取 mesh 的蒙皮 / 变形目标信息
+TRUVIXX_INTERFACE_API ResType truvixx_mesh_get_skin_info(TruvixxSceneHandle scene, uint32_t mesh_index, TruvixxMeshSkinInfo* out);
+
+/// 每个顶点的关节和权重, 长度为 vertex_count; 不是蒙皮 mesh 时返回 NULL
+TRUVIXX_INTERFACE_API const TruvixxSkinVertex* truvixx_mesh_get_skin(TruvixxSceneHandle scene, uint32_t mesh_index);
+/// 关节表: TruvixxSkinVertex::joints -> 节点下标, 长度为 joint_count
+TRUVIXX_INTERFACE_API const uint32_t* truvixx_mesh_get_joint_nodes(TruvixxSceneHandle scene, uint32_t mesh_index);
+/// 每个关节的逆绑定矩阵 (列主序), 长度为 joint_count
+TRUVIXX_INTERFACE_API const TruvixxFloat4x4* truvixx_mesh_get_inverse_binds(TruvixxSceneHandle scene, uint32_t mesh_index);
+
+/// @param out [out] 变形目标 (大小 >= morph_target_count)
+TRUVIXX_INTERFACE_API ResType truvixx_mesh_fill_morph_targets(TruvixxSceneHandle scene, uint32_t mesh_index, TruvixxMorphTarget* out);
+/// 所有变形目标的顶点偏移, 长度为 morph_delta_count; 没有变形目标时返回 NULL
+TRUVIXX_INTERFACE_API const TruvixxMorphDelta* truvixx_mesh_get_morph_deltas(TruvixxSceneHandle scene, uint32_t mesh_index);
+
+TRUVIXX_INTERFACE_API uint32_t truvixx_scene_animation_count(TruvixxSceneHandle scene);
+/// @param out [out] 动画片段记录 (大小 >= animation_count)
+TRUVIXX_INTERFACE_API ResType truvixx_scene_fill_animations(TruvixxSceneHandle scene, TruvixxAnimationRecord* out);
+
+/// 节点通道 -> 节点下标, 长度为 channel_count
+TRUVIXX_INTERFACE_API const uint32_t* truvixx_animation_get_channels(TruvixxSceneHandle scene, uint32_t clip_index);
+/// 关键帧 [frame][channel], 长度为 frame_count * channel_count; 量化片段返回 NULL
+TRUVIXX_INTERFACE_API const TruvixxNodeTransform* truvixx_animation_get_keys(TruvixxSceneHandle scene, uint32_t clip_index);
+/// 量化关键帧 [frame][channel], 长度为 frame_count * channel_count; 未量化片段返回 NULL
+TRUVIXX_INTERFACE_API const TruvixxQuantizedTransform*
+truvixx_animation_get_quantized_keys(TruvixxSceneHandle scene, uint32_t clip_index);
+/// 量化片段每个通道的取值范围, 长度为 channel_count; 未量化片段返回 NULL
+TRUVIXX_INTERFACE_API const TruvixxTransformRange* truvixx_animation_get_ranges(TruvixxSceneHandle scene, uint32_t clip_index);
+
+/// @param out [out] 变形通道 (大小 >= morph_channel_count)
+TRUVIXX_INTERFACE_API ResType
+truvixx_animation_fill_morph_channels(TruvixxSceneHandle scene, uint32_t clip_index, TruvixxMorphChannel* out);
+/// 变形权重 [frame][morph_weights_per_frame], 没有变形通道时返回 NULL
+TRUVIXX_INTERFACE_API const float* truvixx_animation_get_morph_weights(TruvixxSceneHandle scene, uint32_t clip_index);
+
+/// 采样片段在 time 时刻所有节点的局部变换，没有动画通道的节点为 rest
+/// @param time 秒; loop 非 0 时对 duration 取模, 否则限制在 [0, duration]
+/// @param out_pose [out] 局部变换 (大小 >= node_count)
+/// @return 成功返回 1, 失败返回 0
+TRUVIXX_INTERFACE_API ResType
+truvixx_animation_sample(TruvixxSceneHandle scene, uint32_t clip_index, float time, uint32_t loop, TruvixxNodeTransform* out_pose);
+
+/// 采样片段在 time 时刻某个 mesh 的变形权重，片段不影响该 mesh 时为 default_weight
+/// @param out_weights [out] 权重 (大小 >= 该 mesh 的 morph_target_count)
+TRUVIXX_INTERFACE_API ResType truvixx_animation_sample_morph_weights(
+    TruvixxSceneHandle scene,
+    uint32_t clip_index,
+    uint32_t mesh_index,
+    float time,
+    uint32_t loop,
+    float* out_weights
+);
+
+/// 由局部变换计算所有节点的全局矩阵 (列主序)
+/// @param pose 局部变换 (大小 >= node_count)
+/// @param out_matrices [out] 全局矩阵 (大小 >= node_count)
+TRUVIXX_INTERFACE_API ResType truvixx_scene_compute_node_matrices(
+    TruvixxSceneHandle scene,
+    const TruvixxNodeTransform* pose,
+    TruvixxFloat4x4* out_matrices
+);
+
+/// 蒙皮矩阵 = 节点全局矩阵 * 逆绑定矩阵，与关节表一一对应；找不到节点的关节为单位矩阵
+/// @param node_matrices truvixx_scene_compute_node_matrices 的结果 (大小 >= node_count)
+/// @param out_matrices [out] 蒙皮矩阵 (大小 >= joint_count)
+TRUVIXX_INTERFACE_API ResType truvixx_mesh_compute_skin_matrices(
+    TruvixxSceneHandle scene,
+    uint32_t mesh_index,
+    const TruvixxFloat4x4* node_matrices,
+    TruvixxFloat4x4* out_matrices
+);
+
+#pragma endregion
+
+#pragma region 分块流式场景
+// 超出内存的大场景先一次性转换为分块场景文件，运行时按 tile 在固定的内存预算下换入换出 mesh:
+//     truvixx_scene_convert_tiled(path, "scene.tvxtiled", &load_options, NULL)
+//     tiled = truvixx_tiled_scene_open("scene.tvxtiled", budget_bytes)
+//     每帧: truvixx_tiled_scene_update_camera(tiled, &camera, radius)
+//           上传 get_loaded_meshes 中的 mesh，释放 get_evicted_meshes 中的 mesh 的 GPU 资源
+//
+// tile 由 instance 包围盒空间划分得到，每个有 mesh 的 instance 恰好属于一个 tile，mesh 可以被多个 tile 共享
+// 材质、纹理、instance 和字符串在打开时全部读入，含义与 TruvixxSceneHandle 的同名函数一致 (instance 的 node 为 TRUVIXX_NO_NODE)；
+// mesh 数据只在常驻时可访问，未常驻时 truvixx_tiled_mesh_get_* 返回 NULL (truvixx_tiled_mesh_get_info 总是可用)
+// meshlet、蒙皮、变形目标和动画不写入分块场景
+//
+// 线程安全: update / set_budget / free 需要独占句柄，并使被淘汰 mesh 的指针失效；
+// 两次 update 之间其余函数可以在多个线程中同时调用
+
+/// 分块参数，字段为 0 时使用默认值
+typedef struct
+{
+    uint32_t max_instances_per_tile; ///< tile 中的 instance 数上限, 0 表示 256
+    uint64_t max_tile_bytes;         ///< tile 引用的 mesh 数据上限, 0 表示 64 MiB; 只有一个 instance 时无法再切分
+} TruvixxTileBuildOptions;
+
+/// tile 记录
+typedef struct
+{
+    TruvixxAabb bounds;       ///< 所有 instance world_bounds 的并集
+    uint32_t instance_offset; ///< truvixx_tiled_scene_get_tile_instances 中的区间
+    uint32_t instance_count;
+    uint32_t mesh_offset; ///< truvixx_tiled_scene_get_tile_meshes 中的区间, 去重后升序
+    uint32_t mesh_count;
+    uint64_t bytes; ///< 全部 mesh 常驻所需的内存
+} TruvixxTileRecord;
+
+/// 流式加载统计
+typedef struct
+{
+    uint64_t budget_bytes;        ///< 0 表示不限
+    uint64_t resident_bytes;      ///< 常驻 mesh 占用的内存, 不超过 budget_bytes
+    uint32_t resident_mesh_count;
+    uint32_t resident_tile_count; ///< 全部 mesh 常驻的 tile
+
+    uint32_t loaded_mesh_count;  ///< 最近一次 update 读入的 mesh
+    uint32_t evicted_mesh_count; ///< 最近一次 update 淘汰的 mesh
+    uint64_t loaded_bytes;       ///< 最近一次 update 读入的字节数
+    uint32_t skipped_tile_count; ///< 最近一次 update 中因预算不足被跳过的 tile
+} TruvixxTileStreamStats;
+
+/// 导入场景并转换为分块场景文件
+///
+/// 转换期间源场景完整导入，内存占用与 truvixx_scene_load_ex 相同；只有运行时受预算限制
+/// @param path 源场景文件
+/// @param out_path 输出的分块场景文件, 先写入临时文件再重命名
+/// @param options 加载选项, 可为 NULL
+/// @param tile_options 分块参数, 可为 NULL
+/// @return 成功返回 1, 失败返回 0
+TRUVIXX_INTERFACE_API ResType truvixx_scene_convert_tiled(
+    const char* path,
+    const char* out_path,
+    const TruvixxSceneLoadOptions* options,
+    const TruvixxTileBuildOptions* tile_options
+);
+
+/// 打开分块场景文件, 初始时没有常驻的 mesh
+/// @param budget_bytes mesh 的内存预算, 0 表示不限
+/// @return 文件不存在、版本不匹配或损坏时返回 NULL
+TRUVIXX_INTERFACE_API TruvixxTiledSceneHandle truvixx_tiled_scene_open(const char* path, uint64_t budget_bytes);
+
+TRUVIXX_INTERFACE_API void truvixx_tiled_scene_free(TruvixxTiledSceneHandle tiled);
+
+/// 修改预算, 下一次 update 时生效
+TRUVIXX_INTERFACE_API ResType truvixx_tiled_scene_set_budget(TruvixxTiledSceneHandle tiled, uint64_t budget_bytes);
+
+/// 请求包围盒与 camera 距离不超过 radius 的 tile 常驻, 由近到远分配预算
+///
+/// 装不下的 tile 被跳过；淘汰未被请求的 mesh (最久未使用的优先) 直到新 mesh 能放下, 然后并行读入缺失的 mesh
+TRUVIXX_INTERFACE_API ResType truvixx_tiled_scene_update_camera(
+    TruvixxTiledSceneHandle tiled,
+    const TruvixxFloat3* camera,
+    float radius
+);
+
+/// 请求一组 tile 常驻, 规则与 truvixx_tiled_scene_update_camera 相同
+/// @param tiles 按优先级排列的 tile 下标, 越界的下标被忽略; count 为 0 时可为 NULL (淘汰所有超出预算的 mesh)
+TRUVIXX_INTERFACE_API ResType truvixx_tiled_scene_update_tiles(
+    TruvixxTiledSceneHandle tiled,
+    const uint32_t* tiles,
+    uint32_t count
+);
+
+/// 最近一次 update 读入的 mesh 下标, 按请求顺序
+TRUVIXX_INTERFACE_API uint32_t truvixx_tiled_scene_loaded_mesh_count(TruvixxTiledSceneHandle tiled);
+TRUVIXX_INTERFACE_API const uint32_t* truvixx_tiled_scene_get_loaded_meshes(TruvixxTiledSceneHandle tiled);
+/// 最近一次 update 淘汰的 mesh 下标, 指向这些 mesh 的指针已失效
+TRUVIXX_INTERFACE_API uint32_t truvixx_tiled_scene_evicted_mesh_count(TruvixxTiledSceneHandle tiled);
+TRUVIXX_INTERFACE_API const uint32_t* truvixx_tiled_scene_get_evicted_meshes(TruvixxTiledSceneHandle tiled);
+
+TRUVIXX_INTERFACE_API ResType truvixx_tiled_scene_get_stats(TruvixxTiledSceneHandle tiled, TruvixxTileStreamStats* out);
+
+TRUVIXX_INTERFACE_API uint32_t truvixx_tiled_scene_tile_count(TruvixxTiledSceneHandle tiled);
+/// @param out [out] tile 记录 (大小 >= tile_count)
+TRUVIXX_INTERFACE_API ResType truvixx_tiled_scene_fill_tiles(TruvixxTiledSceneHandle tiled, TruvixxTileRecord* out);
+/// 所有 tile 的 instance 下标, 按 TruvixxTileRecord::instance_offset / instance_count 划分
+TRUVIXX_INTERFACE_API const uint32_t* truvixx_tiled_scene_get_tile_instances(TruvixxTiledSceneHandle tiled);
+/// 所有 tile 的 mesh 下标, 按 TruvixxTileRecord::mesh_offset / mesh_count 划分
+TRUVIXX_INTERFACE_API const uint32_t* truvixx_tiled_scene_get_tile_meshes(TruvixxTiledSceneHandle tiled);
+/// @return tile 的全部 mesh 都已常驻时返回 1
+TRUVIXX_INTERFACE_API uint32_t truvixx_tiled_scene_tile_resident(TruvixxTiledSceneHandle tiled, uint32_t tile);
+
+TRUVIXX_INTERFACE_API uint32_t truvixx_tiled_scene_mesh_count(TruvixxTiledSceneHandle tiled);
+TRUVIXX_INTERFACE_API uint32_t truvixx_tiled_scene_material_count(TruvixxTiledSceneHandle tiled);
+TRUVIXX_INTERFACE_API uint32_t truvixx_tiled_scene_instance_count(TruvixxTiledSceneHandle tiled);
+TRUVIXX_INTERFACE_API uint32_t truvixx_tiled_scene_texture_count(TruvixxTiledSceneHandle tiled);
+
+TRUVIXX_INTERFACE_API const char* truvixx_tiled_scene_get_strings(TruvixxTiledSceneHandle tiled);
+TRUVIXX_INTERFACE_API uint32_t truvixx_tiled_scene_strings_size(TruvixxTiledSceneHandle tiled);
+/// @param out [out] 材质记录 (大小 >= material_count)
+TRUVIXX_INTERFACE_API ResType truvixx_tiled_scene_fill_materials(TruvixxTiledSceneHandle tiled, TruvixxMaterialRecord* out);
+/// @param out [out] 纹理记录 (大小 >= texture_count)
+TRUVIXX_INTERFACE_API ResType truvixx_tiled_scene_fill_textures(TruvixxTiledSceneHandle tiled, TruvixxTextureRecord* out);
+/// @param out [out] instance 记录 (大小 >= instance_count)
+TRUVIXX_INTERFACE_API ResType truvixx_tiled_scene_fill_instances(TruvixxTiledSceneHandle tiled, TruvixxInstanceRecord* out);
+TRUVIXX_INTERFACE_API uint32_t truvixx_tiled_scene_instance_ref_count(TruvixxTiledSceneHandle tiled);
+TRUVIXX_INTERFACE_API const uint32_t* truvixx_tiled_scene_get_instance_mesh_refs(TruvixxTiledSceneHandle tiled);
+TRUVIXX_INTERFACE_API const uint32_t* truvixx_tiled_scene_get_instance_material_refs(TruvixxTiledSceneHandle tiled);
+
+/// 获取 mesh 元信息, 不要求 mesh 常驻
+TRUVIXX_INTERFACE_API ResType truvixx_tiled_mesh_get_info(TruvixxTiledSceneHandle tiled, uint32_t mesh_index, TruvixxMeshInfo* out);
+
+TRUVIXX_INTERFACE_API const TruvixxFloat3* truvixx_tiled_mesh_get_positions(TruvixxTiledSceneHandle tiled, uint32_t mesh_index);
+TRUVIXX_INTERFACE_API const TruvixxFloat3* truvixx_tiled_mesh_get_normals(TruvixxTiledSceneHandle tiled, uint32_t mesh_index);
+TRUVIXX_INTERFACE_API const TruvixxFloat3* truvixx_tiled_mesh_get_tangents(TruvixxTiledSceneHandle tiled, uint32_t mesh_index);
+TRUVIXX_INTERFACE_API const TruvixxFloat2* truvixx_tiled_mesh_get_uvs(TruvixxTiledSceneHandle tiled, uint32_t mesh_index);
+/// 仅当 index_format 为 TruvixxIndexFormatUint32 时非 NULL
+TRUVIXX_INTERFACE_API const uint32_t* truvixx_tiled_mesh_get_indices(TruvixxTiledSceneHandle tiled, uint32_t mesh_index);
+/// 仅当 index_format 为 TruvixxIndexFormatUint16 时非 NULL
+TRUVIXX_INTERFACE_API const uint16_t* truvixx_tiled_mesh_get_indices16(TruvixxTiledSceneHandle tiled, uint32_t mesh_index);
+/// @param out [out] 大小 >= TruvixxMeshInfo::lod_count; mesh 未常驻时失败
+TRUVIXX_INTERFACE_API ResType truvixx_tiled_mesh_fill_lods(TruvixxTiledSceneHandle tiled, uint32_t mesh_index, TruvixxMeshLod* out);
 
 #pragma endregion
 
@@ -1,147 +1,2058 @@
 #include "TruvixxInterface/truvixx_api.h"
+#include "TruvixxAssimp/animation.hpp"
+#include "TruvixxAssimp/gpu_tables.hpp"
+#include "TruvixxAssimp/mesh_optimize.hpp"
+#include "TruvixxAssimp/meshlet.hpp"
 #include "TruvixxAssimp/scene_importer.hpp"
+#include "TruvixxAssimp/shared_materials.hpp"
+#include "TruvixxAssimp/thread_pool.hpp"
+#include "TruvixxAssimp/tiled_scene.hpp"
+#include "TruvixxAssimp/utf8_path.hpp"
+#include "TruvixxAssimp/vertex_interleave.hpp"
+#include "TruvixxAssimp/vertex_quantize.hpp"
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
 
 /// 场景句柄的实际类型
+///
+/// status 变为 Success 之后 importer 不再被修改 (直到 reload / free)，访问函数只通过
+/// get_importer() 等取得 const 引用，因此可以被任意多个线程同时调用；
+/// 唯一的可变状态是就绪队列，由 ready_mutex 保护
 struct TruvixxScene
 {
     truvixx::SceneImporter importer;
+
+    /// 加载状态，Loading 期间只能访问已就绪的 mesh
+    std::atomic<uint32_t> status{ TruvixxLoadStatusLoading };
+
+    // 异步加载
+    std::thread load_thread;
+    TruvixxMeshReadyCallback mesh_ready_callback = nullptr;
+    void* mesh_ready_user_data = nullptr;
+
+    /// mesh 数组分配后发布，mesh_ready 在此之前分配完成
+    std::atomic<uint32_t> published_mesh_count{ 0 };
+    std::unique_ptr<std::atomic<bool>[]> mesh_ready;
+
+    /// 就绪 mesh 队列
+    std::mutex ready_mutex;
+    std::condition_variable ready_cv;
+    std::deque<uint32_t> ready_queue;
+};
+
+/// 批量加载的场景集合
+struct TruvixxSceneSet
+{
+    std::vector<std::unique_ptr<TruvixxScene>> scenes;
+
+    /// 所有场景去重后的材质和纹理
+    truvixx::SharedMaterials materials;
 };
 
-namespace
+/// 分块流式场景，update 之外只读
+struct TruvixxTiledScene
+{
+    truvixx::TiledScene scene;
+};
+
+static_assert(
+    uint32_t{ TruvixxPostProcessGenNormals } == truvixx::PostProcessGenNormals &&
+        uint32_t{ TruvixxPostProcessCalcTangents } == truvixx::PostProcessCalcTangents &&
+        uint32_t{ TruvixxPostProcessImproveCacheLocality } == truvixx::PostProcessImproveCacheLocality &&
+        uint32_t{ TruvixxPostProcessOptimizeMeshes } == truvixx::PostProcessOptimizeMeshes &&
+        uint32_t{ TruvixxPostProcessRemoveRedundantMaterials } == truvixx::PostProcessRemoveRedundantMaterials,
+    "TruvixxPostProcess mismatch"
+);
+
+static_assert(
+    uint32_t{ TruvixxLoadPhaseCacheWrite } == static_cast<uint32_t>(truvixx::LoadPhase::CacheWrite) &&
+        uint32_t{ TruvixxLoadPhaseMeshConvert } == static_cast<uint32_t>(truvixx::LoadPhase::MeshConvert) &&
+        uint32_t{ TruvixxLoadPhaseAnimations } == static_cast<uint32_t>(truvixx::LoadPhase::Animations) &&
+        uint32_t{ TruvixxLoadPhaseMeshValidate } == static_cast<uint32_t>(truvixx::LoadPhase::MeshValidate) &&
+        uint32_t{ TruvixxLoadPhaseCount } == truvixx::LOAD_PHASE_COUNT,
+    "TruvixxLoadPhase mismatch"
+);
+
+static_assert(
+    uint32_t{ TruvixxTextureSlotNormal } == static_cast<uint32_t>(truvixx::TextureSlot::Normal) &&
+        uint32_t{ TruvixxTextureSlotOcclusion } == static_cast<uint32_t>(truvixx::TextureSlot::Occlusion) &&
+        uint32_t{ TruvixxTextureSlotCount } == truvixx::TEXTURE_SLOT_COUNT && TRUVIXX_NO_TEXTURE == truvixx::NO_TEXTURE,
+    "TruvixxTextureSlot mismatch"
+);
+
+static_assert(
+    uint32_t{ TruvixxVertexAttributeNormal } == truvixx::VertexAttributeNormal &&
+        uint32_t{ TruvixxVertexAttributeTangent } == truvixx::VertexAttributeTangent &&
+        uint32_t{ TruvixxVertexAttributeUv } == truvixx::VertexAttributeUv,
+    "TruvixxVertexAttribute mismatch"
+);
+
+static_assert(
+    uint32_t{ TruvixxVertexFormatFloat32x3 } == static_cast<uint32_t>(truvixx::VertexFormat::Float32x3) &&
+        uint32_t{ TruvixxVertexFormatUnorm16x4 } == static_cast<uint32_t>(truvixx::VertexFormat::Unorm16x4) &&
+        uint32_t{ TruvixxVertexFormatSnorm16x2Octahedral } ==
+            static_cast<uint32_t>(truvixx::VertexFormat::Snorm16x2Octahedral),
+    "TruvixxVertexFormat mismatch"
+);
+
+static_assert(
+    sizeof(TruvixxMeshValidation) == sizeof(truvixx::MeshValidation) &&
+        offsetof(TruvixxMeshValidation, non_finite_uvs) == offsetof(truvixx::MeshValidation, non_finite_uvs),
+    "TruvixxMeshValidation layout mismatch"
+);
+
+static_assert(TRUVIXX_INVALID_SRV_HANDLE == truvixx::INVALID_SRV_HANDLE, "TruvixxGpuTable mismatch");
+
+static_assert(
+    TRUVIXX_NO_NODE == truvixx::NO_NODE && sizeof(TruvixxMorphTarget) == sizeof(truvixx::MorphTarget) &&
+        offsetof(TruvixxMorphTarget, default_weight) == offsetof(truvixx::MorphTarget, default_weight) &&
+        sizeof(TruvixxMorphChannel) == sizeof(truvixx::MorphChannel) &&
+        offsetof(TruvixxMorphChannel, weight_count) == offsetof(truvixx::MorphChannel, weight_count),
+    "Truvixx animation layout mismatch"
+);
+
+namespace
+{
+
+/// 安全复制字符串到固定大小缓冲区
+void safe_strcpy(char* dest, const size_t dest_size, const std::string_view src)
+{
+    if (dest_size == 0)
+        return;
+
+    size_t copy_len = std::min(src.size(), dest_size - 1);
+    std::memcpy(dest, src.data(), copy_len);
+    dest[copy_len] = '\0';
+}
+
+TruvixxStringRef to_string_ref(const truvixx::StringRef ref)
+{
+    return { .offset = ref.offset, .length = ref.length };
+}
+
+/// 字符串引用所在的字符串表由调用方决定 (场景或场景集合)
+TruvixxTextureRecord to_texture_record(const truvixx::TextureData& texture)
+{
+    return TruvixxTextureRecord{
+        .path = to_string_ref(texture.path),
+        .format_hint = to_string_ref(texture.format_hint),
+        .data = texture.data,
+        .size = texture.size,
+        .hash = texture.hash,
+        .width = texture.width,
+        .height = texture.height,
+        .embedded = texture.embedded ? 1u : 0u,
+    };
+}
+
+/// C 加载选项 -> C++ 加载选项
+truvixx::SceneLoadOptions to_load_options(const TruvixxSceneLoadOptions* options)
+{
+    truvixx::SceneLoadOptions result;
+    if (!options)
+        return result;
+
+    result.parallel = options->parallel != 0;
+    if (options->override_post_process)
+        result.post_process = options->post_process;
+    result.attributes = truvixx::VertexAttributeAll & ~options->strip_attributes;
+    result.optimize_meshes = options->optimize_meshes != 0;
+    result.compact_indices = options->compact_indices != 0;
+    result.build_meshlets = options->build_meshlets != 0;
+    result.release_source = options->release_source != 0;
+    result.build_instance_batches = options->build_instance_batches != 0;
+    result.skip_empty_nodes = options->skip_empty_nodes != 0;
+    result.merge_static_meshes = options->merge_static_meshes != 0;
+    result.build_instance_bvh = options->build_instance_bvh != 0;
+    result.import_animation = options->import_animation != 0;
+    if (options->animation_sample_rate > 0.f)
+        result.animation_sample_rate = options->animation_sample_rate;
+    result.quantize_animation = options->quantize_animation != 0;
+    result.validate_meshes = options->validate_meshes != 0;
+    if (options->profile_zone_callback)
+    {
+        result.on_profile_zone = [callback = options->profile_zone_callback,
+                                  user_data = options->profile_user_data](const char* name, const bool begin) {
+            callback(user_data, name, begin ? 1 : 0);
+        };
+    }
+    if (options->texture_ready_callback)
+    {
+        // string_view 来自以 '\0' 结尾的字符串表，可以直接作为 C 字符串传出
+        result.on_texture_ready = [callback = options->texture_ready_callback, user_data = options->texture_user_data](
+                                      const uint32_t texture_idx,
+                                      const truvixx::TextureData& texture,
+                                      const std::string_view path,
+                                      const std::string_view format_hint
+                                  ) {
+            const TruvixxTextureRecord record = to_texture_record(texture);
+            callback(user_data, texture_idx, &record, path.data(), format_hint.data());
+        };
+    }
+    if (options->lod_levels && options->lod_level_count > 0)
+    {
+        result.lod_levels.reserve(options->lod_level_count);
+        for (uint32_t i = 0; i < options->lod_level_count; ++i)
+        {
+            result.lod_levels.push_back(truvixx::LodLevelSettings{
+                .target_ratio = options->lod_levels[i].target_ratio,
+                .target_error = options->lod_levels[i].target_error,
+            });
+        }
+    }
+    return result;
+}
+
+
+/// 字符串引用所在的字符串表由调用方决定 (场景或场景集合)
+TruvixxMaterialRecord to_material_record(const truvixx::MaterialData& mat)
+{
+    TruvixxMaterialRecord record{
+        .base_color = mat.base_color,
+        .emissive = mat.emissive,
+        .roughness = mat.roughness,
+        .metallic = mat.metallic,
+        .opacity = mat.opacity,
+        .name = to_string_ref(mat.name),
+        .diffuse_map = to_string_ref(mat.diffuse_map),
+        .normal_map = to_string_ref(mat.normal_map),
+        .textures = {},
+    };
+    std::ranges::copy(mat.textures, record.textures);
+    return record;
+}
+
+TruvixxInstanceRecord to_instance_record(const truvixx::InstanceData& inst)
+{
+    return TruvixxInstanceRecord{
+        .world_transform = inst.world_transform,
+        .name = to_string_ref(inst.name),
+        .ref_offset = inst.ref_offset,
+        .mesh_count = inst.mesh_count(),
+        .world_bounds = inst.world_bounds,
+        .node = inst.node,
+    };
+}
+
+/// 没有生成 LOD 时只有原始网格一级
+void fill_lods(const truvixx::MeshInfo& mesh_info, TruvixxMeshLod* out)
+{
+    if (mesh_info.lods.empty())
+    {
+        out[0] = TruvixxMeshLod{ .index_offset = 0, .index_count = mesh_info.index_count(), .error = 0.f };
+        return;
+    }
+
+    for (size_t i = 0; i < mesh_info.lods.size(); ++i)
+    {
+        const auto& lod = mesh_info.lods[i];
+        out[i] = TruvixxMeshLod{ .index_offset = lod.index_offset, .index_count = lod.index_count, .error = lod.error };
+    }
+}
+
+/// 查询结果写入调用方 buffer，返回总数
+uint32_t copy_query_result(const std::vector<uint32_t>& result, uint32_t* out, const uint32_t capacity)
+{
+    if (out)
+        std::copy_n(result.begin(), std::min<size_t>(result.size(), capacity), out);
+    return static_cast<uint32_t>(result.size());
+}
+
+/// 未经优化的 mesh 没有记录 ACMR，按需计算
+TruvixxMeshOptimizeStats mesh_optimize_stats(const truvixx::MeshInfo& mesh_info)
+{
+    if (mesh_info.acmr_before > 0.f)
+        return { .acmr_before = mesh_info.acmr_before, .acmr_after = mesh_info.acmr_after };
+
+    const float acmr = truvixx::compute_acmr(mesh_info);
+    return { .acmr_before = acmr, .acmr_after = acmr };
+}
+
+/// 批量导出的默认对齐
+constexpr uint32_t DEFAULT_EXPORT_ALIGNMENT = 16;
+
+uint64_t align_up(const uint64_t value, const uint64_t alignment)
+{
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+truvixx::InterleavedAttribute to_interleaved_attribute(const TruvixxVertexAttributeDesc& desc)
+{
+    return { .format = static_cast<truvixx::VertexFormat>(desc.format), .offset = desc.offset };
+}
+
+truvixx::InterleavedLayout to_interleaved_layout(const TruvixxInterleavedLayout& layout)
+{
+    return truvixx::InterleavedLayout{
+        .position = to_interleaved_attribute(layout.position),
+        .normal = to_interleaved_attribute(layout.normal),
+        .tangent = to_interleaved_attribute(layout.tangent),
+        .uv = to_interleaved_attribute(layout.uv),
+        .stride = layout.stride,
+    };
+}
+
+/// 计算所有 mesh 在 staging buffer 中的布局
+/// @param interleaved 交错顶点格式，nullptr 表示 SoA 布局
+/// @return 总字节数
+uint64_t compute_export_layout(
+    const truvixx::SceneData& data,
+    const uint64_t alignment,
+    std::vector<TruvixxMeshRange>& out_ranges,
+    const truvixx::InterleavedLayout* interleaved = nullptr
+)
+{
+    out_ranges.resize(data.mesh_count());
+
+    uint64_t offset = 0;
+    for (uint32_t mesh_idx = 0; mesh_idx < data.mesh_count(); ++mesh_idx)
+    {
+        const auto& mesh_info = data.mesh_infos[mesh_idx];
+        const uint64_t vertex_cnt = mesh_info.vertex_cnt;
+        auto& range = out_ranges[mesh_idx];
+
+        range.vertex_count = mesh_info.vertex_cnt;
+        range.index_count = mesh_info.index_count();
+        range.index_format = mesh_info.is_index16() ? TruvixxIndexFormatUint16 : TruvixxIndexFormatUint32;
+
+        range.vertex_offset = align_up(offset, alignment);
+        if (interleaved)
+        {
+            range.position_offset = range.vertex_offset + interleaved->position.offset;
+            range.normal_offset = range.vertex_offset + interleaved->normal.offset;
+            range.tangent_offset = range.vertex_offset + interleaved->tangent.offset;
+            range.uv_offset = range.vertex_offset + interleaved->uv.offset;
+            range.vertex_size = vertex_cnt * interleaved->stride;
+        }
+        else
+        {
+            range.position_offset = range.vertex_offset;
+            range.normal_offset = range.position_offset + vertex_cnt * sizeof(TruvixxFloat3);
+            range.tangent_offset = range.normal_offset + vertex_cnt * sizeof(TruvixxFloat3);
+            range.uv_offset = range.tangent_offset + vertex_cnt * sizeof(TruvixxFloat3);
+            range.vertex_size = vertex_cnt * (sizeof(TruvixxFloat3) * 3 + sizeof(TruvixxFloat2));
+        }
+
+        range.index_offset = align_up(range.vertex_offset + range.vertex_size, alignment);
+        const uint64_t index_stride = mesh_info.is_index16() ? sizeof(uint16_t) : sizeof(uint32_t);
+        range.index_size = static_cast<uint64_t>(mesh_info.total_index_count()) * index_stride;
+
+        offset = range.index_offset + range.index_size;
+    }
+
+    return offset;
+}
+
+/// range 是否为 compute_export_layout() 的 SoA 布局 (顶点流按 position | normal | tangent | uv 紧密排列)
+bool is_soa_range(const TruvixxMeshRange& range)
+{
+    const uint64_t float3_size = uint64_t{ range.vertex_count } * sizeof(TruvixxFloat3);
+    return range.position_offset == range.vertex_offset &&
+        range.normal_offset == range.position_offset + float3_size &&
+        range.tangent_offset == range.normal_offset + float3_size &&
+        range.uv_offset == range.tangent_offset + float3_size &&
+        range.vertex_size == uint64_t{ range.vertex_count } * (sizeof(TruvixxFloat3) * 3 + sizeof(TruvixxFloat2));
+}
+
+/// 导出 mesh 顶点流；缺失的流以 0 填充
+void export_stream(std::byte* dst, const void* src, const size_t size)
+{
+    if (src)
+        std::memcpy(dst, src, size);
+    else
+        std::memset(dst, 0, size);
+}
+
+/// 导出 mesh 索引 (包含所有 LOD)，按 mesh 自身的索引格式
+void export_indices(std::byte* dst_bytes, const truvixx::MeshInfo& mesh_info, const TruvixxMeshRange& range)
+{
+    const void* indices = mesh_info.is_index16() ? static_cast<const void*>(mesh_info.indices16.data())
+                                                 : static_cast<const void*>(mesh_info.indices.data());
+    export_stream(dst_bytes + range.index_offset, indices, range.index_size);
+}
+
+TruvixxDequantParams to_dequant_params(const truvixx::QuantizationParams& params)
+{
+    return TruvixxDequantParams{
+        .position_offset = params.position_offset,
+        .position_scale = params.position_scale,
+        .uv_offset = params.uv_offset,
+        .uv_scale = params.uv_scale,
+    };
+}
+
+/// 加载完成的导入器 (只读)，加载完成前返回 NULL
+/// status 的 acquire 与加载线程发布结果时的 release 配对，之后读取的数据都是完整的
+const truvixx::SceneImporter* get_importer(const TruvixxScene* scene)
+{
+    if (!scene || scene->status.load(std::memory_order_acquire) != TruvixxLoadStatusSuccess)
+        return nullptr;
+    return &scene->importer;
+}
+
+/// 获取场景数据 (带空检查)，加载完成前返回 NULL
+const truvixx::SceneData* get_scene_data(const TruvixxScene* scene)
+{
+    const auto* importer = get_importer(scene);
+    return importer ? &importer->get_scene() : nullptr;
+}
+
+/// 获取动画片段 (带空检查)
+const truvixx::AnimationClip* get_animation(const TruvixxScene* scene, const uint32_t clip_index)
+{
+    const auto* data = get_scene_data(scene);
+    if (!data || clip_index >= data->animation_count())
+        return nullptr;
+    return &data->animations[clip_index];
+}
+
+/// 获取 mesh 数据 (带空检查)
+/// 异步加载期间只返回已就绪的 mesh
+const truvixx::MeshInfo* get_mesh_info(const TruvixxScene* scene, const uint32_t mesh_index)
+{
+    if (const auto* data = get_scene_data(scene))
+        return mesh_index < data->mesh_count() ? &data->mesh_infos[mesh_index] : nullptr;
+
+    if (!scene || mesh_index >= scene->published_mesh_count.load(std::memory_order_acquire))
+        return nullptr;
+    if (!scene->mesh_ready[mesh_index].load(std::memory_order_acquire))
+        return nullptr;
+
+    // 已就绪的 mesh 不会再被加载线程修改
+    return &scene->importer.get_scene().mesh_infos[mesh_index];
+}
+
+/// mesh 未常驻时返回 nullptr
+const truvixx::MeshInfo* get_resident_mesh(const TruvixxTiledScene* tiled, const uint32_t mesh_index)
+{
+    return tiled ? tiled->scene.resident_mesh(mesh_index) : nullptr;
+}
+
+/// 为加载过程挂接就绪通知
+void attach_ready_hooks(TruvixxScene* scene, truvixx::SceneLoadOptions& options)
+{
+    options.on_meshes_allocated = [scene](const uint32_t mesh_count) {
+        scene->mesh_ready = std::make_unique<std::atomic<bool>[]>(mesh_count);
+        scene->published_mesh_count.store(mesh_count, std::memory_order_release);
+    };
+
+    options.on_mesh_ready = [scene](const uint32_t mesh_idx) {
+        scene->mesh_ready[mesh_idx].store(true, std::memory_order_release);
+        {
+            std::lock_guard lock(scene->ready_mutex);
+            scene->ready_queue.push_back(mesh_idx);
+        }
+        scene->ready_cv.notify_all();
+
+        if (scene->mesh_ready_callback)
+            scene->mesh_ready_callback(scene->mesh_ready_user_data, scene, mesh_idx);
+    };
+}
+
+/// 发布加载的最终状态，唤醒 truvixx_scene_wait
+void publish_status(TruvixxScene* scene, const bool success)
+{
+    {
+        std::lock_guard lock(scene->ready_mutex);
+        scene->status.store(success ? TruvixxLoadStatusSuccess : TruvixxLoadStatusFailed, std::memory_order_release);
+    }
+    scene->ready_cv.notify_all();
+}
+
+/// 变化列表的长度 (changed / added / removed 三者不重叠)
+uint32_t change_count(
+    const std::vector<uint32_t>& added,
+    const std::vector<uint32_t>& removed,
+    const std::vector<uint32_t>& changed
+)
+{
+    return static_cast<uint32_t>(added.size() + removed.size() + changed.size());
+}
+
+/// 写出变化列表：changed 下标都小于 added / removed，因此依次写出即为升序
+void fill_changes(
+    const std::vector<uint32_t>& added,
+    const std::vector<uint32_t>& removed,
+    const std::vector<uint32_t>& changed,
+    TruvixxSceneChange* out
+)
+{
+    for (const uint32_t index : changed)
+        *out++ = { .index = index, .kind = TruvixxSceneChangeChanged };
+    for (const uint32_t index : added)
+        *out++ = { .index = index, .kind = TruvixxSceneChangeAdded };
+    for (const uint32_t index : removed)
+        *out++ = { .index = index, .kind = TruvixxSceneChangeRemoved };
+}
+
+/// 执行加载并发布最终状态
+/// @param track_ready 是否跟踪单个 mesh 的就绪状态 (仅异步加载需要)
+void run_load(TruvixxScene* scene, const std::string& path, truvixx::SceneLoadOptions options, const bool track_ready)
+{
+    if (track_ready)
+        attach_ready_hooks(scene, options);
+
+    publish_status(scene, scene->importer.load(truvixx::utf8_to_path(path), options));
+}
+
+} // namespace
+
+TruvixxSceneHandle truvixx_scene_load(const char* path)
+{
+    return truvixx_scene_load_ex(path, nullptr);
+}
+
+TruvixxSceneHandle truvixx_scene_load_ex(const char* path, const TruvixxSceneLoadOptions* options)
+{
+    if (!path)
+        return nullptr;
+
+    // 加载失败时保留句柄 (状态为 Failed)，不立即删除
+    auto* scene = new TruvixxScene;
+    run_load(scene, path, to_load_options(options), false);
+    return scene;
+}
+
+TruvixxSceneHandle truvixx_scene_load_from_memory(
+    const void* data,
+    const uint64_t size,
+    const char* format_hint,
+    const char* base_dir,
+    const TruvixxSceneLoadOptions* options
+)
+{
+    if (!data || !format_hint)
+        return nullptr;
+
+    auto* scene = new TruvixxScene;
+    const std::span bytes(static_cast<const std::byte*>(data), static_cast<size_t>(size));
+    const std::filesystem::path dir = base_dir ? truvixx::utf8_to_path(base_dir) : std::filesystem::path{};
+    publish_status(scene, scene->importer.load_from_memory(bytes, format_hint, to_load_options(options), dir));
+    return scene;
+}
+
+TruvixxSceneHandle truvixx_scene_load_async(
+    const char* path,
+    const TruvixxSceneLoadOptions* options,
+    const TruvixxMeshReadyCallback callback,
+    void* user_data
+)
+{
+    if (!path)
+        return nullptr;
+
+    auto* scene = new TruvixxScene;
+    scene->mesh_ready_callback = callback;
+    scene->mesh_ready_user_data = user_data;
+    scene->load_thread = std::thread(run_load, scene, std::string(path), to_load_options(options), true);
+    return scene;
+}
+
+TruvixxLoadStatus truvixx_scene_poll(const TruvixxSceneHandle scene)
+{
+    if (!scene)
+        return TruvixxLoadStatusFailed;
+    return static_cast<TruvixxLoadStatus>(scene->status.load(std::memory_order_acquire));
+}
+
+TruvixxLoadStatus truvixx_scene_wait(const TruvixxSceneHandle scene)
+{
+    if (!scene)
+        return TruvixxLoadStatusFailed;
+
+    std::unique_lock lock(scene->ready_mutex);
+    scene->ready_cv.wait(lock, [&] {
+        return scene->status.load(std::memory_order_acquire) != TruvixxLoadStatusLoading;
+    });
+    return static_cast<TruvixxLoadStatus>(scene->status.load(std::memory_order_acquire));
+}
+
+uint32_t truvixx_scene_pending_mesh_count(const TruvixxSceneHandle scene)
+{
+    return scene ? scene->published_mesh_count.load(std::memory_order_acquire) : 0;
+}
+
+ResType truvixx_scene_pop_ready_mesh(const TruvixxSceneHandle scene, const uint32_t timeout_ms, uint32_t* out_mesh_index)
+{
+    if (!scene || !out_mesh_index)
+        return ResTypeFail;
+
+    std::unique_lock lock(scene->ready_mutex);
+    auto has_result = [&] {
+        return !scene->ready_queue.empty() || scene->status.load(std::memory_order_acquire) != TruvixxLoadStatusLoading;
+    };
+
+    if (timeout_ms == TRUVIXX_WAIT_INFINITE)
+        scene->ready_cv.wait(lock, has_result);
+    else
+        scene->ready_cv.wait_for(lock, std::chrono::milliseconds(timeout_ms), has_result);
+
+    if (scene->ready_queue.empty())
+        return ResTypeFail;
+
+    *out_mesh_index = scene->ready_queue.front();
+    scene->ready_queue.pop_front();
+    return ResTypeSuccess;
+}
+
+void truvixx_scene_free(const TruvixxSceneHandle scene)
+{
+    if (!scene)
+        return;
+
+    // Assimp 导入无法中途取消，等待加载线程结束
+    if (scene->load_thread.joinable())
+        scene->load_thread.join();
+    delete scene;
+}
+
+ResType truvixx_scene_reload(const TruvixxSceneHandle scene, const char* path, const TruvixxSceneLoadOptions* options)
+{
+    if (!scene || !path)
+        return ResTypeFail;
+
+    if (scene->load_thread.joinable())
+        scene->load_thread.join();
+
+    // 旧数据在重新加载开始时即被清空，期间所有访问函数返回失败
+    {
+        std::lock_guard lock(scene->ready_mutex);
+        scene->status.store(TruvixxLoadStatusLoading, std::memory_order_release);
+        scene->ready_queue.clear();
+    }
+    scene->published_mesh_count.store(0, std::memory_order_release);
+    scene->mesh_ready.reset();
+
+    const bool success = scene->importer.reload(truvixx::utf8_to_path(path), to_load_options(options));
+    publish_status(scene, success);
+    return success ? ResTypeSuccess : ResTypeFail;
+}
+
+uint32_t truvixx_scene_mesh_change_count(const TruvixxSceneHandle scene)
+{
+    const auto* importer = get_importer(scene);
+    if (!importer)
+        return 0;
+    const auto& diff = importer->get_diff();
+    return change_count(diff.added_meshes, diff.removed_meshes, diff.changed_meshes);
+}
+
+ResType truvixx_scene_fill_mesh_changes(const TruvixxSceneHandle scene, TruvixxSceneChange* out)
+{
+    const auto* importer = get_importer(scene);
+    if (!importer || !out)
+        return ResTypeFail;
+    const auto& diff = importer->get_diff();
+    fill_changes(diff.added_meshes, diff.removed_meshes, diff.changed_meshes, out);
+    return ResTypeSuccess;
+}
+
+uint32_t truvixx_scene_material_change_count(const TruvixxSceneHandle scene)
+{
+    const auto* importer = get_importer(scene);
+    if (!importer)
+        return 0;
+    const auto& diff = importer->get_diff();
+    return change_count(diff.added_materials, diff.removed_materials, diff.changed_materials);
+}
+
+ResType truvixx_scene_fill_material_changes(const TruvixxSceneHandle scene, TruvixxSceneChange* out)
+{
+    const auto* importer = get_importer(scene);
+    if (!importer || !out)
+        return ResTypeFail;
+    const auto& diff = importer->get_diff();
+    fill_changes(diff.added_materials, diff.removed_materials, diff.changed_materials, out);
+    return ResTypeSuccess;
+}
+
+uint32_t truvixx_scene_instances_changed(const TruvixxSceneHandle scene)
+{
+    const auto* importer = get_importer(scene);
+    if (!importer)
+        return 0;
+    return importer->get_diff().instances_changed ? 1 : 0;
+}
+
+TruvixxSceneSetHandle truvixx_scene_set_load(
+    const char* const* paths,
+    const uint32_t path_count,
+    const TruvixxSceneLoadOptions* options
+)
+{
+    if (!paths)
+        return nullptr;
+
+    auto* set = new TruvixxSceneSet;
+    set->scenes.resize(path_count);
+    for (auto& scene : set->scenes)
+        scene = std::make_unique<TruvixxScene>();
+
+    // 每个文件一个任务；文件内部的并行任务 (options.parallel) 共用同一个线程池
+    // 记录 mesh 就绪状态，使 truvixx_scene_pop_ready_mesh 对集合中的场景同样可用
+    const auto load_options = to_load_options(options);
+    truvixx::parallel_for(path_count, [&](const uint32_t i) {
+        TruvixxScene* scene = set->scenes[i].get();
+        if (paths[i])
+            run_load(scene, paths[i], load_options, true);
+        else
+            scene->status.store(TruvixxLoadStatusFailed, std::memory_order_release);
+    });
+
+    std::vector<const truvixx::SceneData*> scene_data(path_count);
+    for (uint32_t i = 0; i < path_count; ++i)
+        scene_data[i] = get_scene_data(set->scenes[i].get());
+    set->materials = truvixx::build_shared_materials(scene_data);
+
+    return set;
+}
+
+uint32_t truvixx_scene_set_count(const TruvixxSceneSetHandle set)
+{
+    return set ? static_cast<uint32_t>(set->scenes.size()) : 0;
+}
+
+TruvixxSceneHandle truvixx_scene_set_get(const TruvixxSceneSetHandle set, const uint32_t index)
+{
+    if (!set || index >= set->scenes.size())
+        return nullptr;
+    return set->scenes[index].get();
+}
+
+uint32_t truvixx_scene_set_material_count(const TruvixxSceneSetHandle set)
+{
+    return set ? static_cast<uint32_t>(set->materials.materials.size()) : 0;
+}
+
+ResType truvixx_scene_set_fill_materials(const TruvixxSceneSetHandle set, TruvixxMaterialRecord* out)
+{
+    if (!set || !out)
+        return ResTypeFail;
+
+    std::ranges::transform(set->materials.materials, out, to_material_record);
+    return ResTypeSuccess;
+}
+
+uint32_t truvixx_scene_set_texture_count(const TruvixxSceneSetHandle set)
+{
+    return set ? static_cast<uint32_t>(set->materials.textures.size()) : 0;
+}
+
+ResType truvixx_scene_set_fill_textures(const TruvixxSceneSetHandle set, TruvixxTextureRecord* out)
+{
+    if (!set || !out)
+        return ResTypeFail;
+
+    std::ranges::transform(set->materials.textures, out, to_texture_record);
+    return ResTypeSuccess;
+}
+
+const char* truvixx_scene_set_get_strings(const TruvixxSceneSetHandle set)
+{
+    return set ? set->materials.strings.data() : nullptr;
+}
+
+uint32_t truvixx_scene_set_strings_size(const TruvixxSceneSetHandle set)
+{
+    return set ? static_cast<uint32_t>(set->materials.strings.size()) : 0;
+}
+
+const uint32_t* truvixx_scene_set_get_material_remap(const TruvixxSceneSetHandle set, const uint32_t index)
+{
+    if (!set || index >= set->scenes.size())
+        return nullptr;
+
+    const auto remap = set->materials.scene_remap(index);
+    return remap.empty() ? nullptr : remap.data();
+}
+
+void truvixx_scene_set_free(const TruvixxSceneSetHandle set)
+{
+    delete set;
+}
+
+uint32_t truvixx_scene_mesh_count(const TruvixxSceneHandle scene)
+{
+    const auto* data = get_scene_data(scene);
+    return data ? data->mesh_count() : 0;
+}
+
+uint32_t truvixx_scene_material_count(const TruvixxSceneHandle scene)
+{
+    const auto* data = get_scene_data(scene);
+    return data ? data->material_count() : 0;
+}
+
+uint32_t truvixx_scene_instance_count(const TruvixxSceneHandle scene)
+{
+    const auto* data = get_scene_data(scene);
+    return data ? data->instance_count() : 0;
+}
+
+ResType truvixx_scene_get_bounds(const TruvixxSceneHandle scene, TruvixxAabb* out)
+{
+    if (!out)
+        return ResTypeFail;
+
+    const auto* data = get_scene_data(scene);
+    if (!data)
+        return ResTypeFail;
+
+    *out = data->bounds;
+    return ResTypeSuccess;
+}
+
+ResType truvixx_instance_get_bounds(const TruvixxSceneHandle scene, const uint32_t index, TruvixxAabb* out)
+{
+    if (!out)
+        return ResTypeFail;
+
+    const auto* data = get_scene_data(scene);
+    if (!data || index >= data->instance_count())
+        return ResTypeFail;
+
+    *out = data->instances[index].world_bounds;
+    return ResTypeSuccess;
+}
+
+ResType truvixx_scene_get_stats(const TruvixxSceneHandle scene, TruvixxLoadStats* out)
+{
+    const auto* importer = get_importer(scene);
+    if (!out || !importer)
+        return ResTypeFail;
+
+    const truvixx::LoadStats& stats = importer->get_stats();
+    std::copy(stats.phase_ns.begin(), stats.phase_ns.end(), out->phase_ns);
+    out->total_ns = stats.total_ns;
+    out->mesh_count = stats.mesh_count;
+    out->material_count = stats.material_count;
+    out->instance_count = stats.instance_count;
+    out->meshlet_count = stats.meshlet_count;
+    out->texture_count = stats.texture_count;
+    out->embedded_texture_count = stats.embedded_texture_count;
+    out->vertex_count = stats.vertex_count;
+    out->index_count = stats.index_count;
+    out->dropped_face_count = stats.dropped_face_count;
+    out->repaired_mesh_count = stats.repaired_mesh_count;
+    out->removed_triangle_count = stats.removed_triangle_count;
+    out->scene_bytes = stats.scene_bytes;
+    out->source_bytes = stats.source_bytes;
+    out->mapped_bytes = stats.mapped_bytes;
+    out->from_cache = stats.from_cache ? 1 : 0;
+    return ResTypeSuccess;
+}
+
+const char* truvixx_load_phase_name(const TruvixxLoadPhase phase)
+{
+    return truvixx::load_phase_name(static_cast<truvixx::LoadPhase>(phase));
+}
+
+ResType truvixx_material_get(const TruvixxSceneHandle scene, const uint32_t mat_index, TruvixxMat* out)
+{
+    if (!out)
+        return ResTypeFail;
+
+    const auto* data = get_scene_data(scene);
+    if (!data || mat_index >= data->material_count())
+        return ResTypeFail;
+
+    const auto& mat = data->materials[mat_index];
+
+    safe_strcpy(out->name, sizeof(out->name), data->strings.view(mat.name));
+
+    out->base_color = mat.base_color;
+    out->roughness = mat.roughness;
+    out->metallic = mat.metallic;
+    out->emissive = mat.emissive;
+    out->opacity = mat.opacity;
+
+    safe_strcpy(out->diffuse_map, sizeof(out->diffuse_map), data->strings.view(mat.diffuse_map));
+    safe_strcpy(out->normal_map, sizeof(out->normal_map), data->strings.view(mat.normal_map));
+
+    return ResTypeSuccess;
+}
+
+ResType truvixx_instance_get(const TruvixxSceneHandle scene, const uint32_t index, TruvixxInstance* out)
+{
+    if (!out)
+        return ResTypeFail;
+
+    const auto* data = get_scene_data(scene);
+    if (!data || index >= data->instance_count())
+        return ResTypeFail;
+
+    const auto& inst = data->instances[index];
+
+    safe_strcpy(out->name, sizeof(out->name), data->strings.view(inst.name));
+    out->world_transform = inst.world_transform;
+    out->mesh_count = inst.mesh_count();
+
+    return ResTypeSuccess;
+}
+
+ResType truvixx_instance_get_refs(
+    const TruvixxSceneHandle scene,
+    const uint32_t instance_index,
+    uint32_t* out_mesh_indices,
+    uint32_t* out_material_indices
+)
+{
+    const auto* data = get_scene_data(scene);
+    if (!data || instance_index >= data->instance_count())
+        return ResTypeFail;
+
+    const auto& inst = data->instances[instance_index];
+
+    if (out_mesh_indices)
+    {
+        const auto refs = data->mesh_refs(inst);
+        std::memcpy(out_mesh_indices, refs.data(), refs.size_bytes());
+    }
+
+    if (out_material_indices)
+    {
+        const auto refs = data->material_refs(inst);
+        std::memcpy(out_material_indices, refs.data(), refs.size_bytes());
+    }
+
+    return ResTypeSuccess;
+}
+
+const char* truvixx_scene_get_strings(const TruvixxSceneHandle scene)
+{
+    const auto* data = get_scene_data(scene);
+    return data ? data->strings.data() : nullptr;
+}
+
+uint32_t truvixx_scene_strings_size(const TruvixxSceneHandle scene)
+{
+    const auto* data = get_scene_data(scene);
+    return data ? static_cast<uint32_t>(data->strings.size()) : 0;
+}
+
+ResType truvixx_scene_fill_materials(const TruvixxSceneHandle scene, TruvixxMaterialRecord* out)
+{
+    if (!out)
+        return ResTypeFail;
+
+    const auto* data = get_scene_data(scene);
+    if (!data)
+        return ResTypeFail;
+
+    std::ranges::transform(data->materials, out, to_material_record);
+    return ResTypeSuccess;
+}
+
+uint32_t truvixx_scene_texture_count(const TruvixxSceneHandle scene)
+{
+    const auto* data = get_scene_data(scene);
+    return data ? data->texture_count() : 0;
+}
+
+ResType truvixx_scene_fill_textures(const TruvixxSceneHandle scene, TruvixxTextureRecord* out)
+{
+    if (!out)
+        return ResTypeFail;
+
+    const auto* data = get_scene_data(scene);
+    if (!data)
+        return ResTypeFail;
+
+    std::ranges::transform(data->textures, out, to_texture_record);
+    return ResTypeSuccess;
+}
+
+ResType truvixx_scene_fill_instances(const TruvixxSceneHandle scene, TruvixxInstanceRecord* out)
+{
+    if (!out)
+        return ResTypeFail;
+
+    const auto* data = get_scene_data(scene);
+    if (!data)
+        return ResTypeFail;
+
+    std::ranges::transform(data->instances, out, to_instance_record);
+    return ResTypeSuccess;
+}
+
+uint32_t truvixx_scene_instance_ref_count(const TruvixxSceneHandle scene)
+{
+    const auto* data = get_scene_data(scene);
+    return data ? static_cast<uint32_t>(data->instance_mesh_refs.size()) : 0;
+}
+
+const uint32_t* truvixx_scene_get_instance_mesh_refs(const TruvixxSceneHandle scene)
+{
+    const auto* data = get_scene_data(scene);
+    if (!data || data->instance_mesh_refs.empty())
+        return nullptr;
+
+    return data->instance_mesh_refs.data();
+}
+
+const uint32_t* truvixx_scene_get_instance_material_refs(const TruvixxSceneHandle scene)
+{
+    const auto* data = get_scene_data(scene);
+    if (!data || data->instance_material_refs.empty())
+        return nullptr;
+
+    return data->instance_material_refs.data();
+}
+
+uint32_t truvixx_scene_has_bvh(const TruvixxSceneHandle scene)
+{
+    const auto* data = get_scene_data(scene);
+    return data && !data->instance_bvh.empty();
+}
+
+uint32_t truvixx_scene_query_ray(
+    const TruvixxSceneHandle scene,
+    const TruvixxRay* ray,
+    TruvixxRayHit* out_hits,
+    const uint32_t capacity
+)
+{
+    const auto* data = get_scene_data(scene);
+    if (!data || !ray)
+        return 0;
+
+    std::vector<truvixx::BvhRayHit> hits;
+    truvixx::query_ray(
+        data->instance_bvh,
+        { .origin = ray->origin, .direction = ray->direction, .t_min = ray->t_min, .t_max = ray->t_max },
+        hits
+    );
+
+    if (out_hits)
+    {
+        const size_t count = std::min<size_t>(hits.size(), capacity);
+        for (size_t i = 0; i < count; ++i)
+            out_hits[i] = { .instance_index = hits[i].instance_index, .t = hits[i].t };
+    }
+    return static_cast<uint32_t>(hits.size());
+}
+
+uint32_t truvixx_scene_query_frustum(
+    const TruvixxSceneHandle scene,
+    const TruvixxFloat4* planes,
+    uint32_t* out_instances,
+    const uint32_t capacity
+)
+{
+    const auto* data = get_scene_data(scene);
+    if (!data || !planes)
+        return 0;
+
+    std::vector<uint32_t> result;
+    truvixx::query_frustum(data->instance_bvh, planes, result);
+    return copy_query_result(result, out_instances, capacity);
+}
+
+uint32_t truvixx_scene_query_aabb(
+    const TruvixxSceneHandle scene,
+    const TruvixxAabb* box,
+    uint32_t* out_instances,
+    const uint32_t capacity
+)
+{
+    const auto* data = get_scene_data(scene);
+    if (!data || !box)
+        return 0;
+
+    std::vector<uint32_t> result;
+    truvixx::query_aabb(data->instance_bvh, *box, result);
+    return copy_query_result(result, out_instances, capacity);
+}
+
+uint32_t truvixx_scene_batch_count(const TruvixxSceneHandle scene)
+{
+    const auto* data = get_scene_data(scene);
+    return data ? static_cast<uint32_t>(data->instance_batches.size()) : 0;
+}
+
+const TruvixxInstanceBatch* truvixx_scene_get_batches(const TruvixxSceneHandle scene)
+{
+    const auto* data = get_scene_data(scene);
+    if (!data || data->instance_batches.empty())
+        return nullptr;
+
+    return data->instance_batches.data();
+}
+
+const TruvixxFloat4x4* truvixx_scene_get_batch_transforms(const TruvixxSceneHandle scene)
+{
+    const auto* data = get_scene_data(scene);
+    if (!data || data->batch_transforms.empty())
+        return nullptr;
+
+    return data->batch_transforms.data();
+}
+
+uint32_t truvixx_scene_batch_transform_count(const TruvixxSceneHandle scene)
+{
+    const auto* data = get_scene_data(scene);
+    return data ? static_cast<uint32_t>(data->batch_transforms.size()) : 0;
+}
+
+ResType truvixx_mesh_get_info(const TruvixxSceneHandle scene, const uint32_t mesh_index, TruvixxMeshInfo* out)
+{
+    if (!out)
+        return ResTypeFail;
+
+    const auto* mesh_info = get_mesh_info(scene, mesh_index);
+    if (!mesh_info)
+        return ResTypeFail;
+
+    out->vertex_count = mesh_info->vertex_cnt;
+    out->index_count = mesh_info->index_count();
+    out->total_index_count = mesh_info->total_index_count();
+    out->lod_count = mesh_info->lods.empty() ? 1 : static_cast<uint32_t>(mesh_info->lods.size());
+    out->has_normals = mesh_info->has_normal;
+    out->has_tangents = mesh_info->has_tangent;
+    out->has_uvs = mesh_info->has_uv();
+    out->index_format = mesh_info->is_index16() ? TruvixxIndexFormatUint16 : TruvixxIndexFormatUint32;
+    out->bounds = mesh_info->bounds;
+
+    return ResTypeSuccess;
+}
+
+ResType truvixx_mesh_fill_positions(const TruvixxSceneHandle scene, const uint32_t mesh_index, float* out)
+{
+    if (!out)
+        return ResTypeFail;
+
+    const auto* mesh_info = get_mesh_info(scene, mesh_index);
+    if (!mesh_info || !mesh_info->positions)
+        return ResTypeFail;
+
+    std::memcpy(out, mesh_info->positions, mesh_info->vertex_cnt * sizeof(TruvixxFloat3));
+
+    return ResTypeSuccess;
+}
+
+ResType truvixx_mesh_fill_normals(const TruvixxSceneHandle scene, const uint32_t mesh_index, float* out)
+{
+    if (!out)
+        return ResTypeFail;
+
+    const auto* mesh_info = get_mesh_info(scene, mesh_index);
+    if (!mesh_info || !mesh_info->has_normal || !mesh_info->normals)
+        return ResTypeFail;
+
+    std::memcpy(out, mesh_info->normals, mesh_info->vertex_cnt * sizeof(TruvixxFloat3));
+
+    return ResTypeSuccess;
+}
+
+ResType truvixx_mesh_fill_tangents(const TruvixxSceneHandle scene, const uint32_t mesh_index, float* out)
+{
+    if (!out)
+        return ResTypeFail;
+
+    const auto* mesh_info = get_mesh_info(scene, mesh_index);
+    if (!mesh_info || !mesh_info->has_tangent || !mesh_info->tangents)
+        return ResTypeFail;
+
+    std::memcpy(out, mesh_info->tangents, mesh_info->vertex_cnt * sizeof(TruvixxFloat3));
+
+    return ResTypeSuccess;
+}
+
+ResType truvixx_mesh_fill_uvs(const TruvixxSceneHandle scene, const uint32_t mesh_index, float* out)
+{
+    if (!out)
+        return ResTypeFail;
+
+    const auto* mesh_info = get_mesh_info(scene, mesh_index);
+    if (!mesh_info || !mesh_info->uvs)
+        return ResTypeFail;
+
+    std::memcpy(out, mesh_info->uvs, mesh_info->vertex_cnt * sizeof(TruvixxFloat2));
+
+    return ResTypeSuccess;
+}
+
+ResType truvixx_mesh_fill_indices(const TruvixxSceneHandle scene, const uint32_t mesh_index, uint32_t* out)
+{
+    if (!out)
+        return ResTypeFail;
+
+    const auto* mesh_info = get_mesh_info(scene, mesh_index);
+    if (!mesh_info || mesh_info->index_count() == 0)
+        return ResTypeFail;
+
+    // 只填充 LOD0
+    const size_t index_count = mesh_info->index_count();
+    if (mesh_info->is_index16())
+        std::copy_n(mesh_info->indices16.begin(), index_count, out);
+    else
+        std::memcpy(out, mesh_info->indices.data(), index_count * sizeof(uint32_t));
+
+    return ResTypeSuccess;
+}
+
+ResType truvixx_mesh_fill_indices16(const TruvixxSceneHandle scene, const uint32_t mesh_index, uint16_t* out)
+{
+    if (!out)
+        return ResTypeFail;
+
+    const auto* mesh_info = get_mesh_info(scene, mesh_index);
+    if (!mesh_info || mesh_info->index_count() == 0)
+        return ResTypeFail;
+
+    const size_t index_count = mesh_info->index_count();
+    if (mesh_info->is_index16())
+    {
+        std::memcpy(out, mesh_info->indices16.data(), index_count * sizeof(uint16_t));
+        return ResTypeSuccess;
+    }
+
+    if (mesh_info->vertex_cnt > 65536)
+        return ResTypeFail;
+
+    std::transform(
+        mesh_info->indices.begin(),
+        mesh_info->indices.begin() + static_cast<ptrdiff_t>(index_count),
+        out,
+        [](const uint32_t index) { return static_cast<uint16_t>(index); }
+    );
+
+    return ResTypeSuccess;
+}
+
+const TruvixxFloat3* truvixx_mesh_get_positions(const TruvixxSceneHandle scene, const uint32_t mesh_index)
+{
+    const auto* mesh_info = get_mesh_info(scene, mesh_index);
+    if (!mesh_info)
+        return nullptr;
+
+    return mesh_info->vertex_cnt == 0 ? nullptr : mesh_info->positions;
+}
+
+const TruvixxFloat3* truvixx_mesh_get_normals(const TruvixxSceneHandle scene, const uint32_t mesh_index)
+{
+    const auto* mesh_info = get_mesh_info(scene, mesh_index);
+    if (!mesh_info)
+        return nullptr;
+
+    return mesh_info->has_normal ? mesh_info->normals : nullptr;
+}
+
+const TruvixxFloat3* truvixx_mesh_get_tangents(const TruvixxSceneHandle scene, const uint32_t mesh_index)
+{
+    const auto* mesh_info = get_mesh_info(scene, mesh_index);
+    if (!mesh_info)
+        return nullptr;
+
+    return mesh_info->has_tangent ? mesh_info->tangents : nullptr;
+}
+
+const TruvixxFloat2* truvixx_mesh_get_uvs(const TruvixxSceneHandle scene, const uint32_t mesh_index)
+{
+    const auto* mesh_info = get_mesh_info(scene, mesh_index);
+    if (!mesh_info)
+        return nullptr;
+
+    return mesh_info->vertex_cnt == 0 ? nullptr : mesh_info->uvs;
+}
+
+const uint32_t* truvixx_mesh_get_indices(const TruvixxSceneHandle scene, const uint32_t mesh_index)
+{
+    const auto* mesh_info = get_mesh_info(scene, mesh_index);
+    if (!mesh_info)
+        return nullptr;
+
+    return mesh_info->indices.empty() ? nullptr : mesh_info->indices.data();
+}
+
+const uint16_t* truvixx_mesh_get_indices16(const TruvixxSceneHandle scene, const uint32_t mesh_index)
+{
+    const auto* mesh_info = get_mesh_info(scene, mesh_index);
+    if (!mesh_info)
+        return nullptr;
+
+    return mesh_info->is_index16() ? mesh_info->indices16.data() : nullptr;
+}
+
+ResType truvixx_mesh_get_optimize_stats(const TruvixxSceneHandle scene, const uint32_t mesh_index, TruvixxMeshOptimizeStats* out)
+{
+    if (!out)
+        return ResTypeFail;
+
+    const auto* mesh_info = get_mesh_info(scene, mesh_index);
+    if (!mesh_info)
+        return ResTypeFail;
+
+    *out = mesh_optimize_stats(*mesh_info);
+    return ResTypeSuccess;
+}
+
+ResType truvixx_scene_get_optimize_stats(const TruvixxSceneHandle scene, TruvixxMeshOptimizeStats* out)
+{
+    if (!out)
+        return ResTypeFail;
+
+    const auto* data = get_scene_data(scene);
+    if (!data)
+        return ResTypeFail;
+
+    double weighted_before = 0.0;
+    double weighted_after = 0.0;
+    size_t triangle_count = 0;
+    for (const auto& mesh_info : data->mesh_infos)
+    {
+        const size_t mesh_triangles = mesh_info.index_count() / 3;
+        const auto stats = mesh_optimize_stats(mesh_info);
+        weighted_before += static_cast<double>(stats.acmr_before) * static_cast<double>(mesh_triangles);
+        weighted_after += static_cast<double>(stats.acmr_after) * static_cast<double>(mesh_triangles);
+        triangle_count += mesh_triangles;
+    }
+
+    out->acmr_before = triangle_count ? static_cast<float>(weighted_before / static_cast<double>(triangle_count)) : 0.f;
+    out->acmr_after = triangle_count ? static_cast<float>(weighted_after / static_cast<double>(triangle_count)) : 0.f;
+    return ResTypeSuccess;
+}
+
+ResType truvixx_mesh_get_validation(const TruvixxSceneHandle scene, const uint32_t mesh_index, TruvixxMeshValidation* out)
+{
+    if (!out)
+        return ResTypeFail;
+
+    const auto* mesh_info = get_mesh_info(scene, mesh_index);
+    if (!mesh_info)
+        return ResTypeFail;
+
+    std::memcpy(out, &mesh_info->validation, sizeof(TruvixxMeshValidation));
+    return ResTypeSuccess;
+}
+
+ResType truvixx_scene_get_validation(const TruvixxSceneHandle scene, TruvixxMeshValidation* out)
+{
+    if (!out)
+        return ResTypeFail;
+
+    const auto* data = get_scene_data(scene);
+    if (!data)
+        return ResTypeFail;
+
+    truvixx::MeshValidation total;
+    for (const auto& mesh_info : data->mesh_infos)
+    {
+        const truvixx::MeshValidation& v = mesh_info.validation;
+        total.dropped_faces += v.dropped_faces;
+        total.out_of_range_triangles += v.out_of_range_triangles;
+        total.non_finite_triangles += v.non_finite_triangles;
+        total.degenerate_triangles += v.degenerate_triangles;
+        total.removed_vertices += v.removed_vertices;
+        total.denormal_positions += v.denormal_positions;
+        total.repaired_normals += v.repaired_normals;
+        total.repaired_tangents += v.repaired_tangents;
+        total.non_finite_uvs += v.non_finite_uvs;
+    }
+    std::memcpy(out, &total, sizeof(TruvixxMeshValidation));
+    return ResTypeSuccess;
+}
+
+ResType truvixx_mesh_fill_lods(const TruvixxSceneHandle scene, const uint32_t mesh_index, TruvixxMeshLod* out)
+{
+    if (!out)
+        return ResTypeFail;
+
+    const auto* mesh_info = get_mesh_info(scene, mesh_index);
+    if (!mesh_info)
+        return ResTypeFail;
+
+    fill_lods(*mesh_info, out);
+    return ResTypeSuccess;
+}
+
+ResType truvixx_mesh_get_meshlet_info(const TruvixxSceneHandle scene, const uint32_t mesh_index, TruvixxMeshletInfo* out)
+{
+    if (!out)
+        return ResTypeFail;
+
+    const auto* mesh_info = get_mesh_info(scene, mesh_index);
+    if (!mesh_info)
+        return ResTypeFail;
+
+    const auto& meshlets = mesh_info->meshlets;
+    out->meshlet_count = meshlets.count();
+    out->vertex_count = static_cast<uint32_t>(meshlets.vertices.size());
+    out->triangle_size = static_cast<uint32_t>(meshlets.triangles.size());
+    out->max_vertices = truvixx::MESHLET_MAX_VERTICES;
+    out->max_triangles = truvixx::MESHLET_MAX_TRIANGLES;
+
+    return ResTypeSuccess;
+}
+
+const TruvixxMeshlet* truvixx_mesh_get_meshlets(const TruvixxSceneHandle scene, const uint32_t mesh_index)
+{
+    const auto* mesh_info = get_mesh_info(scene, mesh_index);
+    if (!mesh_info)
+        return nullptr;
+
+    return mesh_info->meshlets.meshlets.empty() ? nullptr : mesh_info->meshlets.meshlets.data();
+}
+
+const uint32_t* truvixx_mesh_get_meshlet_vertices(const TruvixxSceneHandle scene, const uint32_t mesh_index)
+{
+    const auto* mesh_info = get_mesh_info(scene, mesh_index);
+    if (!mesh_info)
+        return nullptr;
+
+    return mesh_info->meshlets.vertices.empty() ? nullptr : mesh_info->meshlets.vertices.data();
+}
+
+const uint8_t* truvixx_mesh_get_meshlet_triangles(const TruvixxSceneHandle scene, const uint32_t mesh_index)
+{
+    const auto* mesh_info = get_mesh_info(scene, mesh_index);
+    if (!mesh_info)
+        return nullptr;
+
+    return mesh_info->meshlets.triangles.empty() ? nullptr : mesh_info->meshlets.triangles.data();
+}
+
+const TruvixxFloat4* truvixx_mesh_get_meshlet_spheres(const TruvixxSceneHandle scene, const uint32_t mesh_index)
+{
+    const auto* mesh_info = get_mesh_info(scene, mesh_index);
+    if (!mesh_info)
+        return nullptr;
+
+    return mesh_info->meshlets.spheres.empty() ? nullptr : mesh_info->meshlets.spheres.data();
+}
+
+const TruvixxFloat4* truvixx_mesh_get_meshlet_cones(const TruvixxSceneHandle scene, const uint32_t mesh_index)
+{
+    const auto* mesh_info = get_mesh_info(scene, mesh_index);
+    if (!mesh_info)
+        return nullptr;
+
+    return mesh_info->meshlets.cones.empty() ? nullptr : mesh_info->meshlets.cones.data();
+}
+
+const TruvixxFloat3* truvixx_mesh_get_meshlet_cone_apexes(const TruvixxSceneHandle scene, const uint32_t mesh_index)
+{
+    const auto* mesh_info = get_mesh_info(scene, mesh_index);
+    if (!mesh_info)
+        return nullptr;
+
+    return mesh_info->meshlets.cone_apexes.empty() ? nullptr : mesh_info->meshlets.cone_apexes.data();
+}
+
+ResType truvixx_mesh_get_dequant_params(const TruvixxSceneHandle scene, const uint32_t mesh_index, TruvixxDequantParams* out)
+{
+    if (!out)
+        return ResTypeFail;
+
+    const auto* mesh_info = get_mesh_info(scene, mesh_index);
+    if (!mesh_info)
+        return ResTypeFail;
+
+    *out = to_dequant_params(truvixx::compute_quantization_params(*mesh_info));
+    return ResTypeSuccess;
+}
+
+ResType truvixx_mesh_fill_quantized(
+    const TruvixxSceneHandle scene,
+    const uint32_t mesh_index,
+    const TruvixxUvFormat uv_format,
+    uint16_t* out_positions,
+    int16_t* out_normals,
+    int16_t* out_tangents,
+    uint16_t* out_uvs,
+    TruvixxDequantParams* out_params
+)
+{
+    if (uv_format != TruvixxUvFormatHalf && uv_format != TruvixxUvFormatUnorm16)
+        return ResTypeFail;
+
+    const auto* mesh_info = get_mesh_info(scene, mesh_index);
+    if (!mesh_info)
+        return ResTypeFail;
+
+    // 先检查全部请求的流，避免部分写入后才失败
+    if (out_positions && !mesh_info->positions)
+        return ResTypeFail;
+    if (out_normals && (!mesh_info->has_normal || !mesh_info->normals))
+        return ResTypeFail;
+    if (out_tangents && (!mesh_info->has_tangent || !mesh_info->tangents))
+        return ResTypeFail;
+    if (out_uvs && !mesh_info->uvs)
+        return ResTypeFail;
+
+    const auto params = truvixx::compute_quantization_params(*mesh_info);
+
+    if (out_positions)
+        truvixx::quantize_positions(*mesh_info, params, out_positions);
+    if (out_normals)
+        truvixx::encode_octahedral_snorm16(mesh_info->normals, mesh_info->vertex_cnt, out_normals);
+    if (out_tangents)
+        truvixx::encode_octahedral_snorm16(mesh_info->tangents, mesh_info->vertex_cnt, out_tangents);
+    if (out_uvs)
+    {
+        if (uv_format == TruvixxUvFormatHalf)
+            truvixx::quantize_uvs_half(*mesh_info, out_uvs);
+        else
+            truvixx::quantize_uvs_unorm16(*mesh_info, params, out_uvs);
+    }
+
+    if (out_params)
+        *out_params = to_dequant_params(params);
+
+    return ResTypeSuccess;
+}
+
+uint64_t truvixx_scene_export_size(const TruvixxSceneHandle scene, uint32_t alignment)
+{
+    const auto* data = get_scene_data(scene);
+    if (!data)
+        return 0;
+
+    if (alignment == 0)
+        alignment = DEFAULT_EXPORT_ALIGNMENT;
+    if ((alignment & (alignment - 1)) != 0)
+        return 0;
+
+    std::vector<TruvixxMeshRange> ranges;
+    return compute_export_layout(*data, alignment, ranges);
+}
+
+ResType truvixx_scene_export_meshes(
+    const TruvixxSceneHandle scene,
+    void* dst,
+    const uint64_t dst_size,
+    uint32_t alignment,
+    TruvixxMeshRange* out_ranges
+)
+{
+    if (!dst || !out_ranges)
+        return ResTypeFail;
+
+    const auto* data = get_scene_data(scene);
+    if (!data)
+        return ResTypeFail;
+
+    if (alignment == 0)
+        alignment = DEFAULT_EXPORT_ALIGNMENT;
+    if ((alignment & (alignment - 1)) != 0)
+        return ResTypeFail;
+
+    std::vector<TruvixxMeshRange> ranges;
+    const uint64_t total_size = compute_export_layout(*data, alignment, ranges);
+    if (dst_size < total_size)
+        return ResTypeFail;
+
+    // 各 mesh 写入互不重叠的区域，可以并行
+    auto* dst_bytes = static_cast<std::byte*>(dst);
+    truvixx::parallel_for(data->mesh_count(), [&](const uint32_t mesh_idx) {
+        const auto& mesh_info = data->mesh_infos[mesh_idx];
+        const auto& range = ranges[mesh_idx];
+        const size_t float3_size = static_cast<size_t>(range.vertex_count) * sizeof(TruvixxFloat3);
+        const size_t float2_size = static_cast<size_t>(range.vertex_count) * sizeof(TruvixxFloat2);
+
+        export_stream(dst_bytes + range.position_offset, mesh_info.positions, float3_size);
+        export_stream(dst_bytes + range.normal_offset, mesh_info.has_normal ? mesh_info.normals : nullptr, float3_size);
+        export_stream(dst_bytes + range.tangent_offset, mesh_info.has_tangent ? mesh_info.tangents : nullptr, float3_size);
+        export_stream(dst_bytes + range.uv_offset, mesh_info.uvs, float2_size);
+        export_indices(dst_bytes, mesh_info, range);
+    });
+
+    std::memcpy(out_ranges, ranges.data(), ranges.size() * sizeof(TruvixxMeshRange));
+    return ResTypeSuccess;
+}
+
+ResType truvixx_mesh_fill_interleaved(
+    const TruvixxSceneHandle scene,
+    const uint32_t mesh_index,
+    const TruvixxInterleavedLayout* layout,
+    void* out,
+    const uint64_t out_size,
+    TruvixxDequantParams* out_params
+)
+{
+    if (!layout || !out)
+        return ResTypeFail;
+
+    const auto* mesh_info = get_mesh_info(scene, mesh_index);
+    if (!mesh_info)
+        return ResTypeFail;
+
+    const auto interleaved = to_interleaved_layout(*layout);
+    if (!truvixx::is_valid_layout(interleaved))
+        return ResTypeFail;
+    if (out_size < static_cast<uint64_t>(mesh_info->vertex_cnt) * interleaved.stride)
+        return ResTypeFail;
+
+    const auto params = truvixx::needs_quantization_params(interleaved) || out_params
+                            ? truvixx::compute_quantization_params(*mesh_info)
+                            : truvixx::QuantizationParams{};
+    truvixx::write_interleaved(*mesh_info, interleaved, params, static_cast<std::byte*>(out));
+
+    if (out_params)
+        *out_params = to_dequant_params(params);
+    return ResTypeSuccess;
+}
+
+uint64_t truvixx_scene_export_interleaved_size(
+    const TruvixxSceneHandle scene,
+    const TruvixxInterleavedLayout* layout,
+    uint32_t alignment
+)
+{
+    const auto* data = get_scene_data(scene);
+    if (!data || !layout)
+        return 0;
+
+    if (alignment == 0)
+        alignment = DEFAULT_EXPORT_ALIGNMENT;
+    if ((alignment & (alignment - 1)) != 0)
+        return 0;
+
+    const auto interleaved = to_interleaved_layout(*layout);
+    if (!truvixx::is_valid_layout(interleaved))
+        return 0;
+
+    std::vector<TruvixxMeshRange> ranges;
+    return compute_export_layout(*data, alignment, ranges, &interleaved);
+}
+
+ResType truvixx_scene_export_interleaved(
+    const TruvixxSceneHandle scene,
+    const TruvixxInterleavedLayout* layout,
+    void* dst,
+    const uint64_t dst_size,
+    uint32_t alignment,
+    TruvixxMeshRange* out_ranges,
+    TruvixxDequantParams* out_params
+)
+{
+    if (!layout || !dst || !out_ranges)
+        return ResTypeFail;
+
+    const auto* data = get_scene_data(scene);
+    if (!data)
+        return ResTypeFail;
+
+    if (alignment == 0)
+        alignment = DEFAULT_EXPORT_ALIGNMENT;
+    if ((alignment & (alignment - 1)) != 0)
+        return ResTypeFail;
+
+    const auto interleaved = to_interleaved_layout(*layout);
+    if (!truvixx::is_valid_layout(interleaved))
+        return ResTypeFail;
+
+    std::vector<TruvixxMeshRange> ranges;
+    const uint64_t total_size = compute_export_layout(*data, alignment, ranges, &interleaved);
+    if (dst_size < total_size)
+        return ResTypeFail;
+
+    // 各 mesh 写入互不重叠的区域，可以并行
+    const bool need_params = truvixx::needs_quantization_params(interleaved) || out_params;
+    auto* dst_bytes = static_cast<std::byte*>(dst);
+    truvixx::parallel_for(data->mesh_count(), [&](const uint32_t mesh_idx) {
+        const auto& mesh_info = data->mesh_infos[mesh_idx];
+        const auto& range = ranges[mesh_idx];
+
+        const auto params = need_params ? truvixx::compute_quantization_params(mesh_info) : truvixx::QuantizationParams{};
+        truvixx::write_interleaved(mesh_info, interleaved, params, dst_bytes + range.vertex_offset);
+        export_indices(dst_bytes, mesh_info, range);
+
+        if (out_params)
+            out_params[mesh_idx] = to_dequant_params(params);
+    });
+
+    std::memcpy(out_ranges, ranges.data(), ranges.size() * sizeof(TruvixxMeshRange));
+    return ResTypeSuccess;
+}
+
+ResType truvixx_scene_gpu_table_layout(const TruvixxSceneHandle scene, TruvixxGpuTableLayout* out)
+{
+    const auto* data = get_scene_data(scene);
+    if (!data || !out)
+        return ResTypeFail;
+
+    const auto layout = truvixx::compute_gpu_table_layout(*data);
+    *out = TruvixxGpuTableLayout{
+        .instance_offset = layout.instance_offset,
+        .material_offset = layout.material_offset,
+        .geometry_offset = layout.geometry_offset,
+        .geometry_map_offset = layout.geometry_map_offset,
+        .material_map_offset = layout.material_map_offset,
+        .total_size = layout.total_size,
+        .instance_count = layout.instance_count,
+        .material_count = layout.material_count,
+        .geometry_count = layout.geometry_count,
+        .ref_count = layout.ref_count,
+    };
+    return ResTypeSuccess;
+}
+
+ResType truvixx_scene_write_gpu_tables(
+    const TruvixxSceneHandle scene,
+    const TruvixxGpuTableParams* params,
+    void* dst,
+    const uint64_t dst_size
+)
+{
+    const auto* data = get_scene_data(scene);
+    if (!data || !params || !dst)
+        return ResTypeFail;
+
+    const auto layout = truvixx::compute_gpu_table_layout(*data);
+    if (dst_size < layout.total_size || reinterpret_cast<uintptr_t>(dst) % truvixx::GPU_TABLE_ALIGNMENT != 0)
+        return ResTypeFail;
+
+    const std::span<const TruvixxMeshRange> ranges =
+        params->mesh_ranges ? std::span{ params->mesh_ranges, data->mesh_count() } : std::span<const TruvixxMeshRange>{};
+    // Geometry 只能描述 SoA 顶点流和 32 位索引，交错布局 (truvixx_scene_export_interleaved) 的偏移没有意义
+    for (uint32_t mesh_idx = 0; mesh_idx < ranges.size(); ++mesh_idx)
+    {
+        const auto& range = ranges[mesh_idx];
+        if (range.index_format != TruvixxIndexFormatUint32 || !is_soa_range(range) ||
+            range.vertex_count != data->mesh_infos[mesh_idx].vertex_cnt)
+            return ResTypeFail;
+    }
+
+    const truvixx::GpuTableParams table_params{
+        .material_base = params->material_base,
+        .geometry_base = params->geometry_base,
+        .indirect_base = params->indirect_base,
+        .sampler_type = params->sampler_type,
+        .texture_handles = params->texture_srv_handles
+                               ? std::span{ params->texture_srv_handles, params->texture_count }
+                               : std::span<const int32_t>{},
+    };
+
+    auto* dst_bytes = static_cast<std::byte*>(dst);
+    truvixx::write_gpu_instances(
+        *data,
+        table_params,
+        reinterpret_cast<TruvixxGpuInstance*>(dst_bytes + layout.instance_offset)
+    );
+    truvixx::write_gpu_materials(
+        *data,
+        table_params,
+        reinterpret_cast<TruvixxGpuMaterial*>(dst_bytes + layout.material_offset)
+    );
+    truvixx::write_gpu_indirect_maps(
+        *data,
+        table_params,
+        reinterpret_cast<uint32_t*>(dst_bytes + layout.geometry_map_offset),
+        reinterpret_cast<uint32_t*>(dst_bytes + layout.material_map_offset)
+    );
+
+    // geometry 的地址由 mesh 导出布局决定，核心库不知道 device address，因此在这里写入
+    auto* geometries = reinterpret_cast<TruvixxGpuGeometry*>(dst_bytes + layout.geometry_offset);
+    for (uint32_t mesh_idx = 0; mesh_idx < layout.geometry_count; ++mesh_idx)
+    {
+        if (ranges.empty())
+        {
+            geometries[mesh_idx] = TruvixxGpuGeometry{};
+            continue;
+        }
+
+        const auto& range = ranges[mesh_idx];
+        const uint64_t base = params->mesh_buffer_address;
+        geometries[mesh_idx] = TruvixxGpuGeometry{
+            .position_buffer = base + range.position_offset,
+            .normal_buffer = base + range.normal_offset,
+            .tangent_buffer = base + range.tangent_offset,
+            .uv_buffer = base + range.uv_offset,
+            .index_buffer = base + range.index_offset,
+        };
+    }
+
+    return ResTypeSuccess;
+}
+
+uint32_t truvixx_scene_node_count(const TruvixxSceneHandle scene)
+{
+    const auto* data = get_scene_data(scene);
+    return data ? data->node_count() : 0;
+}
+
+ResType truvixx_scene_fill_nodes(const TruvixxSceneHandle scene, TruvixxNodeRecord* out)
+{
+    if (!out)
+        return ResTypeFail;
+
+    const auto* data = get_scene_data(scene);
+    if (!data)
+        return ResTypeFail;
+
+    for (const auto& node : data->skeleton_nodes)
+    {
+        *out++ = TruvixxNodeRecord{
+            .name = to_string_ref(node.name),
+            .parent = node.parent,
+            .rest = node.rest,
+        };
+    }
+
+    return ResTypeSuccess;
+}
+
+ResType truvixx_mesh_get_skin_info(const TruvixxSceneHandle scene, const uint32_t mesh_index, TruvixxMeshSkinInfo* out)
+{
+    if (!out)
+        return ResTypeFail;
+
+    const auto* mesh_info = get_mesh_info(scene, mesh_index);
+    if (!mesh_info)
+        return ResTypeFail;
+
+    out->skinned = mesh_info->is_skinned() ? 1 : 0;
+    out->joint_count = static_cast<uint32_t>(mesh_info->joint_nodes.size());
+    out->morph_target_count = static_cast<uint32_t>(mesh_info->morph_targets.size());
+    out->morph_delta_count = static_cast<uint32_t>(mesh_info->morph_deltas.size());
+
+    return ResTypeSuccess;
+}
+
+const TruvixxSkinVertex* truvixx_mesh_get_skin(const TruvixxSceneHandle scene, const uint32_t mesh_index)
+{
+    const auto* mesh_info = get_mesh_info(scene, mesh_index);
+    if (!mesh_info)
+        return nullptr;
+
+    return mesh_info->skin.empty() ? nullptr : mesh_info->skin.data();
+}
+
+const uint32_t* truvixx_mesh_get_joint_nodes(const TruvixxSceneHandle scene, const uint32_t mesh_index)
+{
+    const auto* mesh_info = get_mesh_info(scene, mesh_index);
+    if (!mesh_info)
+        return nullptr;
+
+    return mesh_info->joint_nodes.empty() ? nullptr : mesh_info->joint_nodes.data();
+}
+
+const TruvixxFloat4x4* truvixx_mesh_get_inverse_binds(const TruvixxSceneHandle scene, const uint32_t mesh_index)
 {
+    const auto* mesh_info = get_mesh_info(scene, mesh_index);
+    if (!mesh_info)
+        return nullptr;
 
-/// 安全复制字符串到固定大小缓冲区
-void safe_strcpy(char* dest, const size_t dest_size, const std::string& src)
+    return mesh_info->inverse_binds.empty() ? nullptr : mesh_info->inverse_binds.data();
+}
+
+ResType truvixx_mesh_fill_morph_targets(const TruvixxSceneHandle scene, const uint32_t mesh_index, TruvixxMorphTarget* out)
 {
-    if (dest_size == 0)
-        return;
+    if (!out)
+        return ResTypeFail;
 
-    size_t copy_len = std::min(src.size(), dest_size - 1);
-    std::memcpy(dest, src.data(), copy_len);
-    dest[copy_len] = '\0';
+    const auto* mesh_info = get_mesh_info(scene, mesh_index);
+    if (!mesh_info)
+        return ResTypeFail;
+
+    for (const auto& target : mesh_info->morph_targets)
+    {
+        *out++ = TruvixxMorphTarget{
+            .delta_offset = target.delta_offset,
+            .delta_count = target.delta_count,
+            .default_weight = target.default_weight,
+        };
+    }
+
+    return ResTypeSuccess;
 }
 
-/// 获取场景数据 (带空检查)
-const truvixx::SceneData* get_scene_data(TruvixxSceneHandle scene)
+const TruvixxMorphDelta* truvixx_mesh_get_morph_deltas(const TruvixxSceneHandle scene, const uint32_t mesh_index)
 {
-    if (!scene || !scene->importer.is_loaded())
+    const auto* mesh_info = get_mesh_info(scene, mesh_index);
+    if (!mesh_info)
         return nullptr;
-    return &scene->importer.get_scene();
+
+    return mesh_info->morph_deltas.empty() ? nullptr : mesh_info->morph_deltas.data();
 }
 
-} // namespace
+uint32_t truvixx_scene_animation_count(const TruvixxSceneHandle scene)
+{
+    const auto* data = get_scene_data(scene);
+    return data ? data->animation_count() : 0;
+}
 
-TruvixxSceneHandle truvixx_scene_load(const char* path)
+ResType truvixx_scene_fill_animations(const TruvixxSceneHandle scene, TruvixxAnimationRecord* out)
 {
-    if (!path)
-        return nullptr;
+    if (!out)
+        return ResTypeFail;
 
-    auto* scene = new TruvixxScene;
-    if (!scene->importer.load(path))
+    const auto* data = get_scene_data(scene);
+    if (!data)
+        return ResTypeFail;
+
+    for (const auto& clip : data->animations)
     {
-        // 保留错误信息，不立即删除
-        return scene;
+        *out++ = TruvixxAnimationRecord{
+            .name = to_string_ref(clip.name),
+            .duration = clip.duration,
+            .sample_rate = clip.sample_rate,
+            .frame_count = clip.frame_count,
+            .channel_count = clip.channel_count,
+            .morph_channel_count = clip.morph_channel_count,
+            .morph_weights_per_frame = clip.morph_weights_per_frame,
+            .quantized = clip.quantized ? 1u : 0u,
+        };
     }
-    return scene;
+
+    return ResTypeSuccess;
 }
 
-void truvixx_scene_free(const TruvixxSceneHandle scene)
+const uint32_t* truvixx_animation_get_channels(const TruvixxSceneHandle scene, const uint32_t clip_index)
 {
-    delete scene;
+    const auto* clip = get_animation(scene, clip_index);
+    if (!clip || clip->channel_count == 0)
+        return nullptr;
+
+    return get_scene_data(scene)->animation_channels.data() + clip->channel_offset;
 }
 
-uint32_t truvixx_scene_mesh_count(const TruvixxSceneHandle scene)
+const TruvixxNodeTransform* truvixx_animation_get_keys(const TruvixxSceneHandle scene, const uint32_t clip_index)
 {
-    const auto* data = get_scene_data(scene);
-    return data ? data->mesh_count() : 0;
+    const auto* clip = get_animation(scene, clip_index);
+    if (!clip || clip->quantized || clip->channel_count == 0 || clip->frame_count == 0)
+        return nullptr;
+
+    return get_scene_data(scene)->animation_keys.data() + clip->key_offset;
 }
 
-uint32_t truvixx_scene_material_count(const TruvixxSceneHandle scene)
+const TruvixxQuantizedTransform* truvixx_animation_get_quantized_keys(const TruvixxSceneHandle scene, const uint32_t clip_index)
 {
-    const auto* data = get_scene_data(scene);
-    return data ? data->material_count() : 0;
+    const auto* clip = get_animation(scene, clip_index);
+    if (!clip || !clip->quantized || clip->channel_count == 0 || clip->frame_count == 0)
+        return nullptr;
+
+    return get_scene_data(scene)->animation_quantized_keys.data() + clip->key_offset;
 }
 
-uint32_t truvixx_scene_instance_count(const TruvixxSceneHandle scene)
+const TruvixxTransformRange* truvixx_animation_get_ranges(const TruvixxSceneHandle scene, const uint32_t clip_index)
 {
-    const auto* data = get_scene_data(scene);
-    return data ? data->instance_count() : 0;
+    const auto* clip = get_animation(scene, clip_index);
+    if (!clip || !clip->quantized || clip->channel_count == 0)
+        return nullptr;
+
+    return get_scene_data(scene)->animation_ranges.data() + clip->channel_offset;
 }
 
-ResType truvixx_material_get(const TruvixxSceneHandle scene, const uint32_t mat_index, TruvixxMat* out)
+ResType truvixx_animation_fill_morph_channels(const TruvixxSceneHandle scene, const uint32_t clip_index, TruvixxMorphChannel* out)
 {
     if (!out)
         return ResTypeFail;
 
-    const auto* data = get_scene_data(scene);
-    if (!data || mat_index >= data->material_count())
+    const auto* clip = get_animation(scene, clip_index);
+    if (!clip)
         return ResTypeFail;
 
-    const auto& mat = data->materials[mat_index];
-
-    safe_strcpy(out->name, sizeof(out->name), mat.name);
+    const auto* data = get_scene_data(scene);
+    for (uint32_t c = 0; c < clip->morph_channel_count; ++c)
+    {
+        const auto& channel = data->morph_channels[clip->morph_channel_offset + c];
+        *out++ = TruvixxMorphChannel{
+            .mesh = channel.mesh,
+            .weight_offset = channel.weight_offset,
+            .weight_count = channel.weight_count,
+        };
+    }
 
-    out->base_color = mat.base_color;
-    out->roughness = mat.roughness;
-    out->metallic = mat.metallic;
-    out->emissive = mat.emissive;
-    out->opacity = mat.opacity;
+    return ResTypeSuccess;
+}
 
-    safe_strcpy(out->diffuse_map, sizeof(out->diffuse_map), mat.diffuse_map);
-    safe_strcpy(out->normal_map, sizeof(out->normal_map), mat.normal_map);
+const float* truvixx_animation_get_morph_weights(const TruvixxSceneHandle scene, const uint32_t clip_index)
+{
+    const auto* clip = get_animation(scene, clip_index);
+    if (!clip || clip->morph_weights_per_frame == 0 || clip->frame_count == 0)
+        return nullptr;
 
-    return ResTypeSuccess;
+    return get_scene_data(scene)->morph_weights.data() + clip->morph_weight_offset;
 }
 
-ResType truvixx_instance_get(const TruvixxSceneHandle scene, const uint32_t index, TruvixxInstance* out)
+ResType truvixx_animation_sample(
+    const TruvixxSceneHandle scene,
+    const uint32_t clip_index,
+    const float time,
+    const uint32_t loop,
+    TruvixxNodeTransform* out_pose
+)
 {
-    if (!out)
+    if (!out_pose)
         return ResTypeFail;
 
-    const auto* data = get_scene_data(scene);
-    if (!data || index >= data->instance_count())
+    const auto* clip = get_animation(scene, clip_index);
+    if (!clip)
         return ResTypeFail;
 
-    const auto& inst = data->instances[index];
-
-    safe_strcpy(out->name, sizeof(out->name), inst.name);
-    out->world_transform = inst.world_transform;
-    out->mesh_count = inst.mesh_count();
-
+    const auto* data = get_scene_data(scene);
+    truvixx::sample_animation(*data, *clip, time, loop != 0, std::span(out_pose, data->node_count()));
     return ResTypeSuccess;
 }
 
-ResType truvixx_instance_get_refs(
+ResType truvixx_animation_sample_morph_weights(
     const TruvixxSceneHandle scene,
-    const uint32_t instance_index,
-    uint32_t* out_mesh_indices,
-    uint32_t* out_material_indices
+    const uint32_t clip_index,
+    const uint32_t mesh_index,
+    const float time,
+    const uint32_t loop,
+    float* out_weights
 )
 {
+    if (!out_weights)
+        return ResTypeFail;
+
+    const auto* clip = get_animation(scene, clip_index);
+    if (!clip)
+        return ResTypeFail;
+
     const auto* data = get_scene_data(scene);
-    if (!data || instance_index >= data->instance_count())
+    if (mesh_index >= data->mesh_count())
         return ResTypeFail;
 
-    const auto& inst = data->instances[instance_index];
+    const size_t target_count = data->mesh_infos[mesh_index].morph_targets.size();
+    truvixx::sample_morph_weights(*data, *clip, time, loop != 0, mesh_index, std::span(out_weights, target_count));
+    return ResTypeSuccess;
+}
 
-    if (out_mesh_indices)
-    {
-        std::memcpy(out_mesh_indices, inst.mesh_indices.data(), inst.mesh_indices.size() * sizeof(uint32_t));
-    }
+ResType truvixx_scene_compute_node_matrices(
+    const TruvixxSceneHandle scene,
+    const TruvixxNodeTransform* pose,
+    TruvixxFloat4x4* out_matrices
+)
+{
+    if (!pose || !out_matrices)
+        return ResTypeFail;
 
-    if (out_material_indices)
-    {
-        std::memcpy(out_material_indices, inst.material_indices.data(), inst.material_indices.size() * sizeof(uint32_t));
-    }
+    const auto* data = get_scene_data(scene);
+    if (!data)
+        return ResTypeFail;
 
+    const uint32_t node_count = data->node_count();
+    truvixx::compute_node_matrices(*data, std::span(pose, node_count), std::span(out_matrices, node_count));
     return ResTypeSuccess;
 }
 
-ResType truvixx_mesh_get_info(const TruvixxSceneHandle scene, const uint32_t mesh_index, TruvixxMeshInfo* out)
+ResType truvixx_mesh_compute_skin_matrices(
+    const TruvixxSceneHandle scene,
+    const uint32_t mesh_index,
+    const TruvixxFloat4x4* node_matrices,
+    TruvixxFloat4x4* out_matrices
+)
 {
-    if (!out)
+    if (!node_matrices || !out_matrices)
         return ResTypeFail;
 
     const auto* data = get_scene_data(scene);
@@ -149,161 +2060,328 @@ ResType truvixx_mesh_get_info(const TruvixxSceneHandle scene, const uint32_t mes
         return ResTypeFail;
 
     const auto& mesh_info = data->mesh_infos[mesh_index];
-
-    out->vertex_count = mesh_info.vertex_cnt;
-    out->index_count = static_cast<uint32_t>(mesh_info.indices.size());
-    out->has_normals = mesh_info.has_normal;
-    out->has_tangents = mesh_info.has_tangent;
-    out->has_uvs = !mesh_info.uvs.empty();
-
+    truvixx::compute_skin_matrices(
+        mesh_info,
+        std::span(node_matrices, data->node_count()),
+        std::span(out_matrices, mesh_info.joint_nodes.size())
+    );
     return ResTypeSuccess;
 }
 
-ResType truvixx_mesh_fill_positions(const TruvixxSceneHandle scene, const uint32_t mesh_index, float* out)
+ResType truvixx_scene_convert_tiled(
+    const char* path,
+    const char* out_path,
+    const TruvixxSceneLoadOptions* options,
+    const TruvixxTileBuildOptions* tile_options
+)
 {
-    if (!out)
+    if (!path || !out_path)
         return ResTypeFail;
 
-    const auto* scene_data = get_scene_data(scene);
-    if (!scene_data || mesh_index >= scene_data->mesh_count())
+    truvixx::SceneImporter importer;
+    if (!importer.load(truvixx::utf8_to_path(path), to_load_options(options)))
         return ResTypeFail;
 
-    const auto position_ptr = scene->importer.get_position(mesh_index);
-    if (!position_ptr)
-        return ResTypeFail;
+    truvixx::TileBuildSettings settings;
+    if (tile_options && tile_options->max_instances_per_tile > 0)
+        settings.max_instances_per_tile = tile_options->max_instances_per_tile;
+    if (tile_options && tile_options->max_tile_bytes > 0)
+        settings.max_tile_bytes = tile_options->max_tile_bytes;
 
-    const auto& mesh_info = scene_data->mesh_infos[mesh_index];
-    std::memcpy(out, position_ptr, mesh_info.vertex_cnt * sizeof(TruvixxFloat3));
+    const bool written = truvixx::write_tiled_scene(truvixx::utf8_to_path(out_path), importer.get_scene(), settings);
+    return written ? ResTypeSuccess : ResTypeFail;
+}
 
-    return ResTypeSuccess;
+TruvixxTiledSceneHandle truvixx_tiled_scene_open(const char* path, const uint64_t budget_bytes)
+{
+    if (!path)
+        return nullptr;
+
+    auto tiled = std::make_unique<TruvixxTiledScene>();
+    if (!tiled->scene.open(truvixx::utf8_to_path(path), budget_bytes))
+        return nullptr;
+    return tiled.release();
 }
 
-ResType truvixx_mesh_fill_normals(const TruvixxSceneHandle scene, const uint32_t mesh_index, float* out)
+void truvixx_tiled_scene_free(const TruvixxTiledSceneHandle tiled)
 {
-    if (!out)
-        return ResTypeFail;
+    delete tiled;
+}
 
-    const auto* scene_data = get_scene_data(scene);
-    if (!scene_data || mesh_index >= scene_data->mesh_count())
+ResType truvixx_tiled_scene_set_budget(const TruvixxTiledSceneHandle tiled, const uint64_t budget_bytes)
+{
+    if (!tiled)
         return ResTypeFail;
 
-    const auto& mesh_info = scene_data->mesh_infos[mesh_index];
-    const auto normal_ptr = scene->importer.get_normal(mesh_index);
-    if (!mesh_info.has_normal || !normal_ptr)
-        return ResTypeFail;
+    tiled->scene.set_budget(budget_bytes);
+    return ResTypeSuccess;
+}
 
-    std::memcpy(out, normal_ptr, mesh_info.vertex_cnt * sizeof(TruvixxFloat3));
+ResType truvixx_tiled_scene_update_camera(
+    const TruvixxTiledSceneHandle tiled,
+    const TruvixxFloat3* camera,
+    const float radius
+)
+{
+    if (!tiled || !camera)
+        return ResTypeFail;
 
+    tiled->scene.update(*camera, radius);
     return ResTypeSuccess;
 }
 
-ResType truvixx_mesh_fill_tangents(const TruvixxSceneHandle scene, const uint32_t mesh_index, float* out)
+ResType truvixx_tiled_scene_update_tiles(const TruvixxTiledSceneHandle tiled, const uint32_t* tiles, const uint32_t count)
 {
-    if (!out)
+    if (!tiled || (!tiles && count > 0))
         return ResTypeFail;
 
-    const auto* scene_data = get_scene_data(scene);
-    if (!scene_data || mesh_index >= scene_data->mesh_count())
-        return ResTypeFail;
+    tiled->scene.update(std::span(tiles, count));
+    return ResTypeSuccess;
+}
 
-    const auto& mesh_info = scene_data->mesh_infos[mesh_index];
-    const auto tangent_ptr = scene->importer.get_normal(mesh_index);
-    if (!mesh_info.has_tangent || !tangent_ptr)
-        return ResTypeFail;
+uint32_t truvixx_tiled_scene_loaded_mesh_count(const TruvixxTiledSceneHandle tiled)
+{
+    return tiled ? static_cast<uint32_t>(tiled->scene.loaded_meshes().size()) : 0;
+}
 
-    std::memcpy(out, tangent_ptr, mesh_info.vertex_cnt * sizeof(TruvixxFloat3));
+const uint32_t* truvixx_tiled_scene_get_loaded_meshes(const TruvixxTiledSceneHandle tiled)
+{
+    if (!tiled || tiled->scene.loaded_meshes().empty())
+        return nullptr;
+    return tiled->scene.loaded_meshes().data();
+}
 
-    return ResTypeSuccess;
+uint32_t truvixx_tiled_scene_evicted_mesh_count(const TruvixxTiledSceneHandle tiled)
+{
+    return tiled ? static_cast<uint32_t>(tiled->scene.evicted_meshes().size()) : 0;
 }
 
-ResType truvixx_mesh_fill_uvs(const TruvixxSceneHandle scene, const uint32_t mesh_index, float* out)
+const uint32_t* truvixx_tiled_scene_get_evicted_meshes(const TruvixxTiledSceneHandle tiled)
 {
-    if (!out)
-        return ResTypeFail;
+    if (!tiled || tiled->scene.evicted_meshes().empty())
+        return nullptr;
+    return tiled->scene.evicted_meshes().data();
+}
 
-    const auto* scene_data = get_scene_data(scene);
-    if (!scene_data || mesh_index >= scene_data->mesh_count())
+ResType truvixx_tiled_scene_get_stats(const TruvixxTiledSceneHandle tiled, TruvixxTileStreamStats* out)
+{
+    if (!tiled || !out)
         return ResTypeFail;
 
-    const auto& mesh_info = scene_data->mesh_infos[mesh_index];
-    if (mesh_info.uvs.empty())
-        return ResTypeFail;
+    const truvixx::TileStreamStats stats = tiled->scene.stats();
+    *out = TruvixxTileStreamStats{
+        .budget_bytes = stats.budget_bytes,
+        .resident_bytes = stats.resident_bytes,
+        .resident_mesh_count = stats.resident_mesh_count,
+        .resident_tile_count = stats.resident_tile_count,
+        .loaded_mesh_count = stats.loaded_mesh_count,
+        .evicted_mesh_count = stats.evicted_mesh_count,
+        .loaded_bytes = stats.loaded_bytes,
+        .skipped_tile_count = stats.skipped_tile_count,
+    };
+    return ResTypeSuccess;
+}
+
+uint32_t truvixx_tiled_scene_tile_count(const TruvixxTiledSceneHandle tiled)
+{
+    return tiled ? tiled->scene.tile_count() : 0;
+}
 
-    std::memcpy(out, mesh_info.uvs.data(), mesh_info.uvs.size() * sizeof(TruvixxFloat2));
+ResType truvixx_tiled_scene_fill_tiles(const TruvixxTiledSceneHandle tiled, TruvixxTileRecord* out)
+{
+    if (!tiled || !out)
+        return ResTypeFail;
 
+    std::ranges::transform(tiled->scene.tiles(), out, [](const truvixx::TileInfo& tile) {
+        return TruvixxTileRecord{
+            .bounds = tile.bounds,
+            .instance_offset = tile.instance_offset,
+            .instance_count = tile.instance_count,
+            .mesh_offset = tile.mesh_offset,
+            .mesh_count = tile.mesh_count,
+            .bytes = tile.bytes,
+        };
+    });
     return ResTypeSuccess;
 }
 
-ResType truvixx_mesh_fill_indices(const TruvixxSceneHandle scene, const uint32_t mesh_index, uint32_t* out)
+const uint32_t* truvixx_tiled_scene_get_tile_instances(const TruvixxTiledSceneHandle tiled)
 {
-    if (!out)
-        return ResTypeFail;
+    if (!tiled || tiled->scene.tile_instances().empty())
+        return nullptr;
+    return tiled->scene.tile_instances().data();
+}
+
+const uint32_t* truvixx_tiled_scene_get_tile_meshes(const TruvixxTiledSceneHandle tiled)
+{
+    if (!tiled || tiled->scene.tile_meshes().empty())
+        return nullptr;
+    return tiled->scene.tile_meshes().data();
+}
+
+uint32_t truvixx_tiled_scene_tile_resident(const TruvixxTiledSceneHandle tiled, const uint32_t tile)
+{
+    return tiled && tiled->scene.is_tile_resident(tile) ? 1 : 0;
+}
+
+uint32_t truvixx_tiled_scene_mesh_count(const TruvixxTiledSceneHandle tiled)
+{
+    return tiled ? tiled->scene.mesh_count() : 0;
+}
+
+uint32_t truvixx_tiled_scene_material_count(const TruvixxTiledSceneHandle tiled)
+{
+    return tiled ? tiled->scene.metadata().material_count() : 0;
+}
+
+uint32_t truvixx_tiled_scene_instance_count(const TruvixxTiledSceneHandle tiled)
+{
+    return tiled ? tiled->scene.metadata().instance_count() : 0;
+}
+
+uint32_t truvixx_tiled_scene_texture_count(const TruvixxTiledSceneHandle tiled)
+{
+    return tiled ? tiled->scene.metadata().texture_count() : 0;
+}
+
+const char* truvixx_tiled_scene_get_strings(const TruvixxTiledSceneHandle tiled)
+{
+    return tiled ? tiled->scene.metadata().strings.data() : nullptr;
+}
+
+uint32_t truvixx_tiled_scene_strings_size(const TruvixxTiledSceneHandle tiled)
+{
+    return tiled ? static_cast<uint32_t>(tiled->scene.metadata().strings.size()) : 0;
+}
 
-    const auto* scene_data = get_scene_data(scene);
-    if (!scene_data || mesh_index >= scene_data->mesh_count())
+ResType truvixx_tiled_scene_fill_materials(const TruvixxTiledSceneHandle tiled, TruvixxMaterialRecord* out)
+{
+    if (!tiled || !out)
         return ResTypeFail;
 
-    const auto& mesh_info = scene_data->mesh_infos[mesh_index];
-    if (mesh_info.indices.empty())
+    std::ranges::transform(tiled->scene.metadata().materials, out, to_material_record);
+    return ResTypeSuccess;
+}
+
+ResType truvixx_tiled_scene_fill_textures(const TruvixxTiledSceneHandle tiled, TruvixxTextureRecord* out)
+{
+    if (!tiled || !out)
         return ResTypeFail;
 
-    std::memcpy(out, mesh_info.indices.data(), mesh_info.indices.size() * sizeof(uint32_t));
+    std::ranges::transform(tiled->scene.metadata().textures, out, to_texture_record);
+    return ResTypeSuccess;
+}
+
+ResType truvixx_tiled_scene_fill_instances(const TruvixxTiledSceneHandle tiled, TruvixxInstanceRecord* out)
+{
+    if (!tiled || !out)
+        return ResTypeFail;
 
+    std::ranges::transform(tiled->scene.metadata().instances, out, to_instance_record);
     return ResTypeSuccess;
 }
 
-const TruvixxFloat3* truvixx_mesh_get_positions(const TruvixxSceneHandle scene, const uint32_t mesh_index)
+uint32_t truvixx_tiled_scene_instance_ref_count(const TruvixxTiledSceneHandle tiled)
 {
-    const auto* data = get_scene_data(scene);
-    if (!data || mesh_index >= data->mesh_count())
+    return tiled ? static_cast<uint32_t>(tiled->scene.metadata().instance_mesh_refs.size()) : 0;
+}
+
+const uint32_t* truvixx_tiled_scene_get_instance_mesh_refs(const TruvixxTiledSceneHandle tiled)
+{
+    if (!tiled || tiled->scene.metadata().instance_mesh_refs.empty())
         return nullptr;
+    return tiled->scene.metadata().instance_mesh_refs.data();
+}
 
-    const auto& mesh_info = data->mesh_infos[mesh_index];
-    const auto position_ptr = scene->importer.get_position(mesh_index);
+const uint32_t* truvixx_tiled_scene_get_instance_material_refs(const TruvixxTiledSceneHandle tiled)
+{
+    if (!tiled || tiled->scene.metadata().instance_material_refs.empty())
+        return nullptr;
+    return tiled->scene.metadata().instance_material_refs.data();
+}
+
+ResType truvixx_tiled_mesh_get_info(const TruvixxTiledSceneHandle tiled, const uint32_t mesh_index, TruvixxMeshInfo* out)
+{
+    if (!tiled || !out || mesh_index >= tiled->scene.mesh_count())
+        return ResTypeFail;
+
+    const truvixx::TiledMeshInfo& info = tiled->scene.mesh_info(mesh_index);
+    out->vertex_count = info.vertex_cnt;
+    out->index_count = info.lod_index_cnt;
+    out->total_index_count = info.index_cnt;
+    out->lod_count = info.lod_count == 0 ? 1 : info.lod_count;
+    out->has_normals = info.has_normal;
+    out->has_tangents = info.has_tangent;
+    out->has_uvs = info.has_uv;
+    out->index_format = info.index16 ? TruvixxIndexFormatUint16 : TruvixxIndexFormatUint32;
+    out->bounds = info.bounds;
 
-    return mesh_info.vertex_cnt == 0 ? nullptr : position_ptr;
+    return ResTypeSuccess;
 }
 
-const TruvixxFloat3* truvixx_mesh_get_normals(const TruvixxSceneHandle scene, const uint32_t mesh_index)
+const TruvixxFloat3* truvixx_tiled_mesh_get_positions(const TruvixxTiledSceneHandle tiled, const uint32_t mesh_index)
 {
-    const auto* data = get_scene_data(scene);
-    if (!data || mesh_index >= data->mesh_count())
+    const auto* mesh_info = get_resident_mesh(tiled, mesh_index);
+    if (!mesh_info)
         return nullptr;
 
-    const auto& mesh_info = data->mesh_infos[mesh_index];
-    const auto normal_ptr = scene->importer.get_normal(mesh_index);
+    return mesh_info->vertex_cnt == 0 ? nullptr : mesh_info->positions;
+}
 
-    return mesh_info.has_normal ? normal_ptr : nullptr;
+const TruvixxFloat3* truvixx_tiled_mesh_get_normals(const TruvixxTiledSceneHandle tiled, const uint32_t mesh_index)
+{
+    const auto* mesh_info = get_resident_mesh(tiled, mesh_index);
+    if (!mesh_info)
+        return nullptr;
+
+    return mesh_info->has_normal ? mesh_info->normals : nullptr;
 }
 
-const TruvixxFloat3* truvixx_mesh_get_tangents(const TruvixxSceneHandle scene, const uint32_t mesh_index)
+const TruvixxFloat3* truvixx_tiled_mesh_get_tangents(const TruvixxTiledSceneHandle tiled, const uint32_t mesh_index)
 {
-    const auto* data = get_scene_data(scene);
-    if (!data || mesh_index >= data->mesh_count())
+    const auto* mesh_info = get_resident_mesh(tiled, mesh_index);
+    if (!mesh_info)
         return nullptr;
 
-    const auto& mesh_info = data->mesh_infos[mesh_index];
-    const auto tangent_ptr = scene->importer.get_tangent(mesh_index);
+    return mesh_info->has_tangent ? mesh_info->tangents : nullptr;
+}
 
-    return mesh_info.has_tangent ? tangent_ptr : nullptr;
+const TruvixxFloat2* truvixx_tiled_mesh_get_uvs(const TruvixxTiledSceneHandle tiled, const uint32_t mesh_index)
+{
+    const auto* mesh_info = get_resident_mesh(tiled, mesh_index);
+    if (!mesh_info)
+        return nullptr;
+
+    return mesh_info->vertex_cnt == 0 ? nullptr : mesh_info->uvs;
 }
 
-const TruvixxFloat2* truvixx_mesh_get_uvs(const TruvixxSceneHandle scene, const uint32_t mesh_index)
+const uint32_t* truvixx_tiled_mesh_get_indices(const TruvixxTiledSceneHandle tiled, const uint32_t mesh_index)
 {
-    const auto* data = get_scene_data(scene);
-    if (!data || mesh_index >= data->mesh_count())
+    const auto* mesh_info = get_resident_mesh(tiled, mesh_index);
+    if (!mesh_info)
         return nullptr;
 
-    const auto& mesh_info = data->mesh_infos[mesh_index];
-    return mesh_info.uvs.empty() ? nullptr : mesh_info.uvs.data();
+    return mesh_info->indices.empty() ? nullptr : mesh_info->indices.data();
 }
 
-const uint32_t* truvixx_mesh_get_indices(const TruvixxSceneHandle scene, const uint32_t mesh_index)
+const uint16_t* truvixx_tiled_mesh_get_indices16(const TruvixxTiledSceneHandle tiled, const uint32_t mesh_index)
 {
-    const auto* data = get_scene_data(scene);
-    if (!data || mesh_index >= data->mesh_count())
+    const auto* mesh_info = get_resident_mesh(tiled, mesh_index);
+    if (!mesh_info)
         return nullptr;
 
-    const auto& mesh_info = data->mesh_infos[mesh_index];
-    return mesh_info.indices.empty() ? nullptr : mesh_info.indices.data();
+    return mesh_info->is_index16() ? mesh_info->indices16.data() : nullptr;
+}
+
+ResType truvixx_tiled_mesh_fill_lods(const TruvixxTiledSceneHandle tiled, const uint32_t mesh_index, TruvixxMeshLod* out)
+{
+    if (!out)
+        return ResTypeFail;
+
+    const auto* mesh_info = get_resident_mesh(tiled, mesh_index);
+    if (!mesh_info)
+        return ResTypeFail;
+
+    fill_lods(*mesh_info, out);
+    return ResTypeSuccess;
 }